@@ -0,0 +1,131 @@
+/**
+ * @file graph_benchmark.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Benchmarks of the CDAG generators and of the Graph operations the MCIS
+ * finders depend on: copying, DAG checks, tag filtering and building the
+ * modular product of two graphs.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <mcis/compact_graph.h>
+#include <mcis/dense_product_graph.h>
+#include <mcis/graph.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "memory_tracker.h"
+#include "workloads.h"
+
+namespace {
+
+void set_graph_counters(benchmark::State& state, const Graph& graph) {
+    state.counters["nodes"] = graph.get_num_nodes();
+    state.counters["edges"] = static_cast<double>(
+        graph.freeze().get_num_edges());
+}
+
+void BM_Construct(benchmark::State& state, Workload workload) {
+    MemoryTracker memory;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(make_workload(workload, state));
+    }
+    memory.report(state);
+    set_graph_counters(state, make_workload(workload, state));
+}
+
+void BM_Copy(benchmark::State& state, Workload workload) {
+    const Graph graph = make_workload(workload, state);
+    MemoryTracker memory;
+    for (auto _ : state) {
+        Graph copy = graph;
+        benchmark::DoNotOptimize(copy);
+    }
+    memory.report(state);
+    set_graph_counters(state, graph);
+}
+
+void BM_IsDag(benchmark::State& state, Workload workload) {
+    const Graph graph = make_workload(workload, state);
+    MemoryTracker memory;
+    for (auto _ : state) {
+        // A copy starts without the cached analysis, so each check is cold
+        state.PauseTiming();
+        Graph copy = graph;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(copy.is_dag());
+    }
+    memory.report(state);
+    set_graph_counters(state, graph);
+}
+
+void BM_SubgraphWithTag(benchmark::State& state, Workload workload) {
+    const Graph graph = make_workload(workload, state);
+    const std::string tag = workload_tag(workload);
+    MemoryTracker memory;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.get_subgraph_with_tag(tag));
+    }
+    memory.report(state);
+    set_graph_counters(state, graph);
+}
+
+void BM_ProductGraph(benchmark::State& state, Workload workload) {
+    const Graph graph = make_workload(workload, state);
+    const CompactGraph& compact = graph.freeze();
+    const std::vector<const CompactGraph*> pair = {&compact, &compact};
+    CandidateFilterStats stats;
+    size_t vertices = 0;
+    MemoryTracker memory;
+    for (auto _ : state) {
+        auto product = DenseProductGraph::build(
+            pair, CandidateFilterOptions{}, size_t{1} << 30, &stats);
+        if (!product) {
+            state.SkipWithError("product graph too large");
+            break;
+        }
+        vertices = product->num_vertices;
+        benchmark::DoNotOptimize(product);
+    }
+    memory.report(state);
+    set_graph_counters(state, graph);
+    state.counters["product_vertices"] = static_cast<double>(vertices);
+}
+
+using GraphBenchmark = void (*)(benchmark::State&, Workload);
+
+const bool registered = [] {
+    const std::pair<const char*, GraphBenchmark> benchmarks[] = {
+        {"BM_Construct", BM_Construct},
+        {"BM_Copy", BM_Copy},
+        {"BM_IsDag", BM_IsDag},
+        {"BM_SubgraphWithTag", BM_SubgraphWithTag},
+        {"BM_ProductGraph", BM_ProductGraph}};
+    for (const auto& [name, function] : benchmarks) {
+        for (const auto workload : ALL_WORKLOADS) {
+            // The modular product of the larger kernels does not fit
+            const auto scale = function == BM_ProductGraph
+                                   ? WorkloadScale::MCIS
+                                   : WorkloadScale::LIBRARY;
+            apply_workload_args(
+                benchmark::RegisterBenchmark(
+                    (std::string(name) + "/" + workload_name(workload))
+                        .c_str(),
+                    function, workload)
+                    ->Unit(benchmark::kMicrosecond),
+                workload, scale);
+        }
+    }
+    return true;
+}();
+
+}  // namespace
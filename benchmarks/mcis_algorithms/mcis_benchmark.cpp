@@ -0,0 +1,92 @@
+/**
+ * @file mcis_benchmark.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Benchmarks of every MCIS finder on pairs of BCI kernel CDAGs. Besides time
+ * and memory, each case reports the size of the common subgraph found and
+ * whether the search completed, so quality regressions show up alongside
+ * speed.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <mcis/graph.h>
+#include <mcis/mcis_algorithm.h>
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "memory_tracker.h"
+#include "workloads.h"
+
+namespace {
+
+/**
+ * @brief Time limit of each finder call, so a case that regresses badly
+ * still finishes and reports its incumbent.
+ */
+constexpr std::chrono::seconds MCIS_BENCHMARK_TIME_LIMIT{10};
+
+void BM_Mcis(benchmark::State& state, Workload workload, AlgorithmType type) {
+    const auto [left, right] = make_workload_pair(workload, state);
+    MCISAlgorithm algorithm;
+    SearchReport report;
+    RunOptions options;
+    options.time_limit = MCIS_BENCHMARK_TIME_LIMIT;
+    options.report = &report;
+    size_t mcis_size = 0;
+    MemoryTracker memory;
+    for (auto _ : state) {
+        auto result = algorithm.run({&left, &right}, type, std::nullopt,
+                                    options);
+        if (!result) {
+            std::ostringstream error;
+            error << result.error();
+            state.SkipWithError(error.str().c_str());
+            break;
+        }
+        mcis_size = result->empty() ? 0 : (*result)[0]->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+    }
+    memory.report(state);
+    state.counters["mcis_size"] = static_cast<double>(mcis_size);
+    state.counters["upper_bound"] = static_cast<double>(report.upper_bound);
+    state.counters["complete"] = report.status == SearchStatus::COMPLETE;
+    state.counters["expansions"] = static_cast<double>(report.expansions);
+}
+
+const bool registered = [] {
+    const std::pair<const char*, AlgorithmType> algorithms[] = {
+        {"bron_kerbosch_serial", AlgorithmType::BRON_KERBOSCH_SERIAL},
+        {"kpt", AlgorithmType::KPT},
+        {"bron_kerbosch_bitset", AlgorithmType::BRON_KERBOSCH_BITSET},
+        {"max_clique", AlgorithmType::MAX_CLIQUE},
+        {"max_clique_parallel", AlgorithmType::MAX_CLIQUE_PARALLEL},
+        {"mcsplit", AlgorithmType::MCSPLIT}};
+    for (const auto& [name, type] : algorithms) {
+        for (const auto workload : ALL_WORKLOADS) {
+            apply_workload_args(
+                benchmark::RegisterBenchmark(
+                    ("BM_Mcis/" + std::string(name) + "/"
+                     + workload_name(workload))
+                        .c_str(),
+                    BM_Mcis, workload, type)
+                    ->Unit(benchmark::kMillisecond)
+                    ->UseRealTime(),
+                workload, WorkloadScale::MCIS);
+        }
+    }
+    return true;
+}();
+
+}  // namespace
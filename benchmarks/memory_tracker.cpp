@@ -0,0 +1,137 @@
+/**
+ * @file memory_tracker.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "memory_tracker.h"
+
+#include <sys/resource.h>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__GLIBC__) || defined(__linux__)
+#include <malloc.h>
+#else
+// Configure with -DMCIS_BUILD_BENCHMARKS=OFF on other platforms
+#error "memory_tracker needs malloc_usable_size or malloc_size"
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> allocated_bytes{0};
+std::atomic<int64_t> live_bytes{0};
+std::atomic<int64_t> peak_live_bytes{0};
+
+int64_t usable_size(void* pointer) {
+#if defined(__APPLE__)
+    return static_cast<int64_t>(malloc_size(pointer));
+#else
+    return static_cast<int64_t>(malloc_usable_size(pointer));
+#endif
+}
+
+void* allocate(size_t size, size_t alignment) {
+    size = size == 0 ? 1 : size;
+    void* pointer
+        = alignment > alignof(std::max_align_t)
+              ? std::aligned_alloc(alignment,
+                                   (size + alignment - 1) / alignment
+                                       * alignment)
+              : std::malloc(size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    // Count what the allocator handed out, so deallocation can subtract
+    // the same amount without being told the size
+    const int64_t usable = usable_size(pointer);
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(usable, std::memory_order_relaxed);
+    const int64_t live
+        = live_bytes.fetch_add(usable, std::memory_order_relaxed) + usable;
+    int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak
+           && !peak_live_bytes.compare_exchange_weak(
+               peak, live, std::memory_order_relaxed)) {
+    }
+    return pointer;
+}
+
+void deallocate(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    live_bytes.fetch_sub(usable_size(pointer), std::memory_order_relaxed);
+    std::free(pointer);
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return allocate(size, 0); }
+void* operator new[](size_t size) { return allocate(size, 0); }
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, size_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, size_t) noexcept {
+    deallocate(pointer);
+}
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    deallocate(pointer);
+}
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    deallocate(pointer);
+}
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    deallocate(pointer);
+}
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept {
+    deallocate(pointer);
+}
+
+MemoryTracker::MemoryTracker()
+    : start_allocations(allocations.load()),
+      start_bytes(allocated_bytes.load()),
+      start_live_bytes(live_bytes.load()) {
+    peak_live_bytes.store(start_live_bytes);
+}
+
+void MemoryTracker::report(benchmark::State& state) const {
+    state.counters["allocs"] = benchmark::Counter(
+        static_cast<double>(allocations.load() - start_allocations),
+        benchmark::Counter::kAvgIterations);
+    state.counters["alloc_bytes"] = benchmark::Counter(
+        static_cast<double>(allocated_bytes.load() - start_bytes),
+        benchmark::Counter::kAvgIterations, benchmark::Counter::kIs1024);
+    state.counters["peak_heap_bytes"] = benchmark::Counter(
+        static_cast<double>(peak_live_bytes.load() - start_live_bytes),
+        benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    // ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+    state.counters["peak_rss_kb"]
+        = static_cast<double>(usage.ru_maxrss) / 1024;
+#else
+    state.counters["peak_rss_kb"] = static_cast<double>(usage.ru_maxrss);
+#endif
+}
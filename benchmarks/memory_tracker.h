@@ -0,0 +1,52 @@
+/**
+ * @file memory_tracker.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Heap and resident-set measurements for the benchmark suite. The suite
+ * replaces the global operator new and delete to count every allocation,
+ * including those made by the library's OpenMP workers.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef BENCHMARKS_MEMORY_TRACKER_H_
+#define BENCHMARKS_MEMORY_TRACKER_H_
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+/**
+ * @class MemoryTracker
+ * @brief Measures the heap use of one benchmark case, from construction to
+ * report().
+ */
+class MemoryTracker {
+ public:
+    /**
+     * @brief Records the current counts and restarts the heap peak.
+     */
+    MemoryTracker();
+
+    /**
+     * @brief Adds the case's counters to the state:
+     * - allocs: allocations per iteration
+     * - alloc_bytes: bytes allocated per iteration
+     * - peak_heap_bytes: highest live heap reached above the starting point
+     * - peak_rss_kb: the process's resident-set high-water mark, which only
+     *   grows, so run one case per process to attribute it to that case
+     * @param state The benchmark state to report to.
+     */
+    void report(benchmark::State& state) const;
+
+ private:
+    uint64_t start_allocations;
+    uint64_t start_bytes;
+    int64_t start_live_bytes;
+};
+
+#endif  // BENCHMARKS_MEMORY_TRACKER_H_
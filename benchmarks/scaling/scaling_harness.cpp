@@ -0,0 +1,632 @@
+/**
+ * @file scaling_harness.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Sweeps the MCIS finders over growing CDAG pairs and thread counts and
+ * writes one row per run: runtime, peak memory, speedup over one thread and
+ * solution quality. Each run happens in a forked child whose resident set is
+ * watched by the parent, and whose data segment is capped as a backstop, so
+ * a finder that outgrows the memory cap, overruns its time limit or crashes
+ * is recorded as such and the sweep carries on.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <mcis/graph.h>
+#include <mcis/mcis_algorithm.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "synthetic_dags.h"
+
+namespace {
+
+/**
+ * @brief One input pair of the sweep. The graphs are built by the child
+ * that runs the finder, so the parent never starts an OpenMP pool before it
+ * forks.
+ */
+struct Case {
+    std::string family;
+    std::string size;
+    std::function<std::pair<Graph, Graph>()> make;
+};
+
+/**
+ * @brief What a child sends back through its pipe.
+ */
+struct ChildOutcome {
+    bool ok = false;
+    int error = 0;
+    SearchStatus status = SearchStatus::COMPLETE;
+    uint32_t left_nodes = 0;
+    uint32_t right_nodes = 0;
+    uint64_t mcis_size = 0;
+    uint64_t upper_bound = 0;
+    uint64_t expansions = 0;
+    double runtime_ms = 0;
+};
+
+struct Row {
+    std::string family;
+    std::string size;
+    std::string algorithm;
+    int threads = 0;
+    std::string status;
+    ChildOutcome outcome;
+    long peak_rss_kb = 0;
+    std::optional<double> speedup;
+    std::optional<double> quality;
+};
+
+struct Config {
+    std::vector<std::string> families = {"layered", "series_parallel", "fft",
+                                         "dwt", "mvm"};
+    std::vector<std::string> algorithms;
+    std::vector<int> threads;
+    size_t steps = SIZE_MAX;
+    std::chrono::seconds time_limit{10};
+    long memory_limit_mb = 4096;
+    uint64_t seed = 1;
+    std::string csv_path;
+    std::string json_path;
+};
+
+const std::pair<const char*, AlgorithmType> ALGORITHMS[] = {
+    {"bron_kerbosch_serial", AlgorithmType::BRON_KERBOSCH_SERIAL},
+    {"kpt", AlgorithmType::KPT},
+    {"bron_kerbosch_bitset", AlgorithmType::BRON_KERBOSCH_BITSET},
+    {"max_clique", AlgorithmType::MAX_CLIQUE},
+    {"max_clique_parallel", AlgorithmType::MAX_CLIQUE_PARALLEL},
+    {"mcsplit", AlgorithmType::MCSPLIT}};
+
+/**
+ * @brief Edge probability of the layered DAGs and series-step probability of
+ * the series-parallel DAGs.
+ */
+constexpr double LAYERED_EDGE_PROBABILITY = 0.3;
+constexpr double SERIES_PROBABILITY = 0.5;
+
+/**
+ * @brief How often the parent samples a child's resident set.
+ */
+constexpr std::chrono::milliseconds RSS_POLL_INTERVAL{5};
+
+/**
+ * @brief Grace the parent gives a child past twice its time limit before
+ * killing it: the limit only bounds the search, not product construction.
+ */
+constexpr std::chrono::seconds KILL_GRACE{30};
+
+// The generators only fail on invalid dimensions, which the ladders below
+// never contain
+template <typename T>
+T checked(std::expected<T, mcis::GraphError> graph) {
+    if (!graph) {
+        std::cerr << graph.error() << '\n';
+        std::abort();
+    }
+    return std::move(*graph);
+}
+
+std::vector<Case> family_cases(const std::string& family, uint64_t seed) {
+    std::vector<Case> cases;
+    if (family == "layered") {
+        for (const auto& [layers, width] : std::vector<std::pair<int, int>>{
+                 {4, 4}, {6, 6}, {8, 8}, {12, 12}, {16, 16}, {24, 24}}) {
+            cases.push_back(
+                {family, std::to_string(layers) + "x" + std::to_string(width),
+                 [=] {
+                     return std::pair{
+                         make_layered_dag(layers, width,
+                                          LAYERED_EDGE_PROBABILITY, seed),
+                         make_layered_dag(layers, width,
+                                          LAYERED_EDGE_PROBABILITY,
+                                          seed + 1)};
+                 }});
+        }
+    } else if (family == "series_parallel") {
+        for (const int n : {16, 32, 64, 128, 256, 512}) {
+            cases.push_back({family, std::to_string(n), [=] {
+                                 return std::pair{
+                                     make_series_parallel_dag(
+                                         n, SERIES_PROBABILITY, seed),
+                                     make_series_parallel_dag(
+                                         n, SERIES_PROBABILITY, seed + 1)};
+                             }});
+        }
+    } else if (family == "fft") {
+        for (const int n : {4, 8, 16, 32, 64}) {
+            cases.push_back(
+                {family, std::to_string(n), [=] {
+                     return std::pair{
+                         checked(Graph::create_fft_graph_from_dimensions(n)),
+                         checked(
+                             Graph::create_fft_graph_from_dimensions(n / 2))};
+                 }});
+        }
+    } else if (family == "dwt") {
+        for (const auto& [n, d, k] : std::vector<std::tuple<int, int, int>>{
+                 {8, 2, 1}, {16, 3, 1}, {32, 4, 2}, {64, 5, 2}}) {
+            cases.push_back(
+                {family,
+                 std::to_string(n) + "x" + std::to_string(d) + "x"
+                     + std::to_string(k),
+                 [=] {
+                     std::vector<Graph> graphs = checked(
+                         Graph::
+                             create_haar_wavelet_transform_graph_from_dimensions(
+                                 n, d, k));
+                     return std::pair{std::move(graphs[0]),
+                                      std::move(graphs[1])};
+                 }});
+        }
+    } else if (family == "mvm") {
+        for (const auto& [m, n] : std::vector<std::pair<int, int>>{
+                 {2, 3}, {3, 4}, {4, 5}, {6, 6}, {8, 8}}) {
+            cases.push_back(
+                {family, std::to_string(m) + "x" + std::to_string(n), [=] {
+                     return std::pair{
+                         checked(Graph::create_mvm_graph_from_dimensions(m, n)),
+                         checked(
+                             Graph::create_mvm_graph_from_dimensions(n, m))};
+                 }});
+        }
+    }
+    return cases;
+}
+
+std::optional<AlgorithmType> algorithm_type(const std::string& name) {
+    for (const auto& [known, type] : ALGORITHMS) {
+        if (name == known) {
+            return type;
+        }
+    }
+    return std::nullopt;
+}
+
+std::string search_status_name(SearchStatus status) {
+    switch (status) {
+        case SearchStatus::COMPLETE:
+            return "complete";
+        case SearchStatus::TIME_LIMIT:
+            return "time_limit";
+        case SearchStatus::BUDGET_EXHAUSTED:
+            return "budget_exhausted";
+        case SearchStatus::CANCELLED:
+            break;
+    }
+    return "cancelled";
+}
+
+// Runs in the child: builds the pair, runs the finder and writes the outcome
+// to fd
+[[noreturn]] void run_child(const Case& test_case, AlgorithmType type,
+                            int threads, const Config& config, int fd) {
+    if (config.memory_limit_mb > 0) {
+        // Backstop for the parent's RSS polling, which cannot see the child
+        // where /proc is missing and can miss a spike between samples
+        const auto limit_bytes
+            = static_cast<rlim_t>(config.memory_limit_mb) * 1024 * 1024;
+        const rlimit limit{limit_bytes, limit_bytes};
+        setrlimit(RLIMIT_DATA, &limit);
+    }
+    ChildOutcome outcome;
+    try {
+        const auto [left, right] = test_case.make();
+        outcome.left_nodes = static_cast<uint32_t>(left.get_num_nodes());
+        outcome.right_nodes = static_cast<uint32_t>(right.get_num_nodes());
+
+        MCISAlgorithm algorithm;
+        SearchReport report;
+        RunOptions options;
+        options.num_threads = threads;
+        options.time_limit = config.time_limit;
+        options.report = &report;
+        const auto start = std::chrono::steady_clock::now();
+        auto results = algorithm.run_results({&left, &right}, type,
+                                             std::nullopt, options);
+        outcome.runtime_ms = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+        if (results) {
+            outcome.ok = true;
+            outcome.status = report.status;
+            outcome.mcis_size = results->empty() ? 0 : results->front().size();
+            outcome.upper_bound = report.upper_bound;
+            outcome.expansions = report.expansions;
+        } else {
+            outcome.error = static_cast<int>(results.error());
+        }
+    } catch (const std::bad_alloc&) {
+        outcome.error = -1;
+    }
+    const ssize_t written = write(fd, &outcome, sizeof(outcome));
+    _exit(written == sizeof(outcome) ? 0 : 1);
+}
+
+// Reads the resident set from /proc, which only Linux has
+std::optional<long> resident_kb(pid_t pid) {
+    std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+    long size_pages = 0;
+    long resident_pages = 0;
+    if (!(statm >> size_pages >> resident_pages)) {
+        return std::nullopt;
+    }
+    return resident_pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+Row run_case(const Case& test_case, const std::string& algorithm_name,
+             int threads, const Config& config) {
+    Row row;
+    row.family = test_case.family;
+    row.size = test_case.size;
+    row.algorithm = algorithm_name;
+    row.threads = threads;
+    const AlgorithmType type = *algorithm_type(algorithm_name);
+
+    int fds[2];
+    if (pipe(fds) != 0) {
+        row.status = "error:pipe";
+        return row;
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    const pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        row.status = "error:fork";
+        return row;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        run_child(test_case, type, threads, config, fds[1]);
+    }
+    close(fds[1]);
+
+    const long limit_kb = config.memory_limit_mb * 1024;
+    const auto kill_at = std::chrono::steady_clock::now()
+                         + 2 * config.time_limit + KILL_GRACE;
+    std::optional<std::string> killed;
+    int wait_status = 0;
+    rusage usage{};
+    while (true) {
+        const pid_t done = wait4(pid, &wait_status, WNOHANG, &usage);
+        if (done == pid) {
+            break;
+        }
+        if (!killed) {
+            const long rss = resident_kb(pid).value_or(0);
+            row.peak_rss_kb = std::max(row.peak_rss_kb, rss);
+            if (limit_kb > 0 && rss > limit_kb) {
+                killed = "memory_limit";
+            } else if (std::chrono::steady_clock::now() > kill_at) {
+                killed = "timeout";
+            }
+            if (killed) {
+                kill(pid, SIGKILL);
+            }
+        }
+        std::this_thread::sleep_for(RSS_POLL_INTERVAL);
+    }
+    // ru_maxrss is the child's high-water mark, in bytes on macOS and in
+    // kilobytes elsewhere
+#if defined(__APPLE__)
+    row.peak_rss_kb = std::max(row.peak_rss_kb, usage.ru_maxrss / 1024);
+#else
+    row.peak_rss_kb = std::max(row.peak_rss_kb, usage.ru_maxrss);
+#endif
+
+    ChildOutcome outcome;
+    const ssize_t got = read(fds[0], &outcome, sizeof(outcome));
+    close(fds[0]);
+    if (killed) {
+        row.status = *killed;
+    } else if (WIFSIGNALED(wait_status)) {
+        row.status = "crashed:" + std::string(strsignal(WTERMSIG(wait_status)));
+    } else if (got != sizeof(outcome)) {
+        row.status = "crashed:no_result";
+    } else if (outcome.error < 0 && config.memory_limit_mb > 0) {
+        // An allocation failed against the data segment cap set in the child
+        row.status = "memory_limit";
+    } else if (!outcome.ok) {
+        std::ostringstream error;
+        if (outcome.error < 0) {
+            error << "bad_alloc";
+        } else {
+            error << static_cast<mcis::AlgorithmError>(outcome.error);
+        }
+        row.status = "error:" + error.str();
+        row.outcome = outcome;
+    } else {
+        row.status = search_status_name(outcome.status);
+        row.outcome = outcome;
+    }
+    return row;
+}
+
+bool finished(const Row& row) { return row.outcome.ok; }
+
+// The serial Bron-Kerbosch product lets components repeat, so its sizes are
+// not comparable with the other finders'
+bool comparable(const Row& row) {
+    return row.algorithm != "bron_kerbosch_serial";
+}
+
+// Speedup against the one-thread run of the same finder on the same pair,
+// and quality against the largest result a comparable finder reached on the
+// pair
+void fill_derived(std::vector<Row>& rows) {
+    std::map<std::tuple<std::string, std::string, std::string>, double>
+        serial_ms;
+    std::map<std::pair<std::string, std::string>, uint64_t> best_size;
+    for (const Row& row : rows) {
+        if (!finished(row)) {
+            continue;
+        }
+        if (row.threads == 1) {
+            serial_ms[{row.family, row.size, row.algorithm}]
+                = row.outcome.runtime_ms;
+        }
+        if (comparable(row)) {
+            uint64_t& best = best_size[{row.family, row.size}];
+            best = std::max(best, row.outcome.mcis_size);
+        }
+    }
+    for (Row& row : rows) {
+        if (!finished(row)) {
+            continue;
+        }
+        const auto serial
+            = serial_ms.find({row.family, row.size, row.algorithm});
+        if (serial != serial_ms.end() && row.outcome.runtime_ms > 0) {
+            row.speedup = serial->second / row.outcome.runtime_ms;
+        }
+        const uint64_t best = best_size[{row.family, row.size}];
+        if (comparable(row) && best > 0) {
+            row.quality = static_cast<double>(row.outcome.mcis_size)
+                          / static_cast<double>(best);
+        }
+    }
+}
+
+std::string optional_field(const std::optional<double>& value,
+                           const char* missing) {
+    if (!value) {
+        return missing;
+    }
+    std::ostringstream out;
+    out << *value;
+    return out.str();
+}
+
+bool proven(const Row& row) {
+    return finished(row) && row.outcome.status == SearchStatus::COMPLETE
+           && row.outcome.upper_bound == row.outcome.mcis_size;
+}
+
+void write_csv(std::ostream& out, const std::vector<Row>& rows) {
+    out << "family,size,algorithm,threads,status,left_nodes,right_nodes,"
+           "runtime_ms,peak_rss_kb,speedup,mcis_size,upper_bound,proven,"
+           "quality,expansions\n";
+    for (const Row& row : rows) {
+        const ChildOutcome& o = row.outcome;
+        out << row.family << ',' << row.size << ',' << row.algorithm << ','
+            << row.threads << ',' << row.status << ',' << o.left_nodes << ','
+            << o.right_nodes << ',' << o.runtime_ms << ',' << row.peak_rss_kb
+            << ',' << optional_field(row.speedup, "") << ',' << o.mcis_size
+            << ',' << o.upper_bound << ',' << (proven(row) ? 1 : 0) << ','
+            << optional_field(row.quality, "") << ',' << o.expansions
+            << '\n';
+    }
+}
+
+std::string json_string(const std::string& value) {
+    std::string quoted = "\"";
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void write_json(std::ostream& out, const std::vector<Row>& rows) {
+    out << "[\n";
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const Row& row = rows[i];
+        const ChildOutcome& o = row.outcome;
+        out << "  {\"family\": " << json_string(row.family)
+            << ", \"size\": " << json_string(row.size)
+            << ", \"algorithm\": " << json_string(row.algorithm)
+            << ", \"threads\": " << row.threads
+            << ", \"status\": " << json_string(row.status)
+            << ", \"left_nodes\": " << o.left_nodes
+            << ", \"right_nodes\": " << o.right_nodes
+            << ", \"runtime_ms\": " << o.runtime_ms
+            << ", \"peak_rss_kb\": " << row.peak_rss_kb
+            << ", \"speedup\": " << optional_field(row.speedup, "null")
+            << ", \"mcis_size\": " << o.mcis_size
+            << ", \"upper_bound\": " << o.upper_bound
+            << ", \"proven\": " << (proven(row) ? "true" : "false")
+            << ", \"quality\": " << optional_field(row.quality, "null")
+            << ", \"expansions\": " << o.expansions << "}"
+            << (i + 1 < rows.size() ? "," : "") << '\n';
+    }
+    out << "]\n";
+}
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::istringstream in(list);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void print_usage(const char* program) {
+    std::cerr
+        << "usage: " << program << " [options]\n"
+        << "  --families=LIST    layered,series_parallel,fft,dwt,mvm (all)\n"
+        << "  --algorithms=LIST  finder names as in AlgorithmType, lower "
+           "case (all)\n"
+        << "  --threads=LIST     thread counts (1 and powers of 2 up to the "
+           "core count)\n"
+        << "  --steps=N          first N sizes of each family (all)\n"
+        << "  --time-limit=S     search time limit per run in seconds (10)\n"
+        << "  --memory-limit=MB  resident set cap per run, 0 for none "
+           "(4096)\n"
+        << "  --seed=N           seed of the synthetic families (1)\n"
+        << "  --csv=PATH         write CSV to PATH\n"
+        << "  --json=PATH        write JSON to PATH\n"
+        << "CSV goes to stdout unless --csv or --json is given.\n";
+}
+
+std::optional<Config> parse_args(int argc, char** argv) {
+    Config config;
+    for (const auto& [name, type] : ALGORITHMS) {
+        config.algorithms.push_back(name);
+    }
+    const int cores
+        = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int t = 1; t < cores; t *= 2) {
+        config.threads.push_back(t);
+    }
+    config.threads.push_back(cores);
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const size_t eq = arg.find('=');
+            const std::string key = arg.substr(0, eq);
+            const std::string value
+                = eq == std::string::npos ? "" : arg.substr(eq + 1);
+            if (key == "--families") {
+                config.families = split(value);
+            } else if (key == "--algorithms") {
+                config.algorithms = split(value);
+            } else if (key == "--threads") {
+                config.threads.clear();
+                for (const auto& t : split(value)) {
+                    config.threads.push_back(std::stoi(t));
+                }
+            } else if (key == "--steps") {
+                config.steps = std::stoul(value);
+            } else if (key == "--time-limit") {
+                config.time_limit = std::chrono::seconds(std::stol(value));
+            } else if (key == "--memory-limit") {
+                config.memory_limit_mb = std::stol(value);
+            } else if (key == "--seed") {
+                config.seed = std::stoull(value);
+            } else if (key == "--csv") {
+                config.csv_path = value;
+            } else if (key == "--json") {
+                config.json_path = value;
+            } else {
+                return std::nullopt;
+            }
+        }
+    } catch (const std::logic_error&) {
+        return std::nullopt;
+    }
+
+    for (const auto& name : config.algorithms) {
+        if (!algorithm_type(name)) {
+            std::cerr << "unknown algorithm: " << name << '\n';
+            return std::nullopt;
+        }
+    }
+    for (const auto& family : config.families) {
+        if (family_cases(family, config.seed).empty()) {
+            std::cerr << "unknown family: " << family << '\n';
+            return std::nullopt;
+        }
+    }
+    if (std::ranges::any_of(config.threads, [](int t) { return t < 1; })) {
+        return std::nullopt;
+    }
+    std::ranges::sort(config.threads);
+    return config;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::optional<Config> config = parse_args(argc, argv);
+    if (!config) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    if (config->memory_limit_mb > 0 && !resident_kb(getpid())) {
+        std::cerr << "warning: cannot sample resident sets from /proc; the "
+                     "memory cap is enforced only through RLIMIT_DATA and "
+                     "peak_rss_kb is taken from getrusage\n";
+    }
+
+    std::vector<Row> rows;
+    for (const auto& family : config->families) {
+        std::vector<Case> cases = family_cases(family, config->seed);
+        cases.resize(std::min(cases.size(), config->steps));
+        for (const Case& test_case : cases) {
+            for (const auto& algorithm : config->algorithms) {
+                for (const int threads : config->threads) {
+                    rows.push_back(
+                        run_case(test_case, algorithm, threads, *config));
+                    const Row& row = rows.back();
+                    std::cerr << row.family << '/' << row.size << ' '
+                              << row.algorithm << " threads=" << row.threads
+                              << ": " << row.status << ", "
+                              << row.outcome.mcis_size << " nodes in "
+                              << row.outcome.runtime_ms << " ms, "
+                              << row.peak_rss_kb << " kB\n";
+                }
+            }
+        }
+    }
+    fill_derived(rows);
+
+    if (!config->csv_path.empty()) {
+        std::ofstream out(config->csv_path);
+        write_csv(out, rows);
+    }
+    if (!config->json_path.empty()) {
+        std::ofstream out(config->json_path);
+        write_json(out, rows);
+    }
+    if (config->csv_path.empty() && config->json_path.empty()) {
+        write_csv(std::cout, rows);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file synthetic_dags.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "synthetic_dags.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::string random_op(std::mt19937_64& rng) {
+    return std::bernoulli_distribution(0.5)(rng) ? "+" : "*";
+}
+
+}  // namespace
+
+Graph make_layered_dag(int layers, int width, double edge_probability,
+                       uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::bernoulli_distribution edge(edge_probability);
+    std::uniform_int_distribution<int> pick(0, width - 1);
+    auto name = [](int layer, int i) {
+        return "l" + std::to_string(layer) + "_" + std::to_string(i);
+    };
+
+    Graph graph;
+    for (int layer = 0; layer < layers; ++layer) {
+        for (int i = 0; i < width; ++i) {
+            graph.add_node(name(layer, i));
+            graph.set_node_tag(name(layer, i),
+                               layer == 0 ? SYNTHETIC_INPUT_TAG
+                                          : random_op(rng));
+            if (layer == 0) {
+                continue;
+            }
+            bool has_operand = false;
+            for (int j = 0; j < width; ++j) {
+                if (edge(rng)) {
+                    graph.add_edge(name(layer - 1, j), name(layer, i), 0);
+                    has_operand = true;
+                }
+            }
+            if (!has_operand) {
+                graph.add_edge(name(layer - 1, pick(rng)), name(layer, i), 0);
+            }
+        }
+    }
+    return graph;
+}
+
+Graph make_series_parallel_dag(int num_nodes, double series_probability,
+                               uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::bernoulli_distribution series(series_probability);
+
+    // Build the edge list first, since a series step removes an edge
+    std::vector<std::pair<int, int>> edges = {{0, 1}};
+    for (int w = 2; w < num_nodes; ++w) {
+        const size_t e
+            = std::uniform_int_distribution<size_t>(0, edges.size() - 1)(rng);
+        const auto [u, v] = edges[e];
+        if (series(rng)) {
+            edges[e] = {u, w};
+        } else {
+            edges.emplace_back(u, w);
+        }
+        edges.emplace_back(w, v);
+    }
+
+    Graph graph;
+    for (int i = 0; i < num_nodes; ++i) {
+        const std::string id = "sp" + std::to_string(i);
+        graph.add_node(id);
+        graph.set_node_tag(id, i == 0 ? SYNTHETIC_INPUT_TAG : random_op(rng));
+    }
+    for (const auto& [u, v] : edges) {
+        graph.add_edge("sp" + std::to_string(u), "sp" + std::to_string(v), 0);
+    }
+    return graph;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file synthetic_dags.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Seeded random CDAGs for the scaling harness. They grow past the sizes the
+ * BCI kernel generators reach cheaply and have less symmetry, so they
+ * stress the finders differently.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef BENCHMARKS_SCALING_SYNTHETIC_DAGS_H_
+#define BENCHMARKS_SCALING_SYNTHETIC_DAGS_H_
+
+#include <mcis/graph.h>
+
+#include <cstdint>
+
+/**
+ * @brief Tag of the input nodes of a synthetic CDAG. Every other node is
+ * tagged "+" or "*", like the arithmetic nodes of the kernel CDAGs.
+ */
+inline constexpr const char* SYNTHETIC_INPUT_TAG = "input";
+
+/**
+ * @brief Builds a random layered CDAG. Layer 0 holds the inputs; every node
+ * of a later layer reads each node of the layer before it with the given
+ * probability, and at least one of them, so no operation lacks operands.
+ * @param layers Number of layers, at least 1.
+ * @param width Nodes per layer, at least 1.
+ * @param edge_probability Chance of each edge between adjacent layers.
+ * @param seed Seed of the generator; equal arguments give equal graphs.
+ * @return The graph, with nodes named "l<layer>_<index>".
+ */
+Graph make_layered_dag(int layers, int width, double edge_probability,
+                       uint64_t seed);
+
+/**
+ * @brief Builds a random two-terminal series-parallel CDAG. Starting from a
+ * single edge from the input to the output, each step picks an edge and
+ * either subdivides it (series) or adds a node beside it between the same
+ * endpoints (parallel).
+ * @param num_nodes Number of nodes, at least 2.
+ * @param series_probability Chance that a step is a series step.
+ * @param seed Seed of the generator; equal arguments give equal graphs.
+ * @return The graph, with nodes named "sp<index>"; sp0 is the input.
+ */
+Graph make_series_parallel_dag(int num_nodes, double series_probability,
+                               uint64_t seed);
+
+#endif  // BENCHMARKS_SCALING_SYNTHETIC_DAGS_H_
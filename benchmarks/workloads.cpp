@@ -0,0 +1,138 @@
+/**
+ * @file workloads.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "workloads.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Args = std::vector<std::vector<int64_t>>;
+
+const Args& workload_args(Workload workload, WorkloadScale scale) {
+    static const Args fft_library = {{8}, {64}, {256}, {1024}};
+    static const Args fft_mcis = {{4}, {8}};
+    static const Args dwt_library = {{16, 2, 1}, {64, 3, 2}, {256, 4, 4}};
+    static const Args dwt_mcis = {{8, 2, 1}, {16, 3, 1}};
+    static const Args mvm_library = {{4, 4}, {16, 16}, {64, 32}};
+    static const Args mvm_mcis = {{2, 3}, {3, 4}};
+    const bool library = scale == WorkloadScale::LIBRARY;
+    switch (workload) {
+        case Workload::FFT:
+            return library ? fft_library : fft_mcis;
+        case Workload::DWT:
+            return library ? dwt_library : dwt_mcis;
+        case Workload::MVM:
+            break;
+    }
+    return library ? mvm_library : mvm_mcis;
+}
+
+// The generators only fail on invalid dimensions, which the argument
+// tables above never contain
+template <typename T>
+T checked(std::expected<T, mcis::GraphError> graph) {
+    if (!graph) {
+        std::cerr << graph.error() << '\n';
+        std::abort();
+    }
+    return std::move(*graph);
+}
+
+std::vector<Graph> make_dwt(const benchmark::State& state) {
+    return checked(Graph::create_haar_wavelet_transform_graph_from_dimensions(
+        static_cast<int>(state.range(0)), static_cast<int>(state.range(1)),
+        static_cast<int>(state.range(2))));
+}
+
+}  // namespace
+
+std::string workload_name(Workload workload) {
+    switch (workload) {
+        case Workload::FFT:
+            return "fft";
+        case Workload::DWT:
+            return "dwt";
+        case Workload::MVM:
+            break;
+    }
+    return "mvm";
+}
+
+std::string workload_tag(Workload workload) {
+    switch (workload) {
+        case Workload::FFT:
+            return "+/-*";
+        case Workload::DWT:
+            return "+/sqrt(2)";
+        case Workload::MVM:
+            break;
+    }
+    return "*";
+}
+
+void apply_workload_args(benchmark::internal::Benchmark* bench,
+                         Workload workload, WorkloadScale scale) {
+    switch (workload) {
+        case Workload::FFT:
+            bench->ArgNames({"n"});
+            break;
+        case Workload::DWT:
+            bench->ArgNames({"n", "d", "k"});
+            break;
+        case Workload::MVM:
+            bench->ArgNames({"m", "n"});
+            break;
+    }
+    for (const auto& args : workload_args(workload, scale)) {
+        bench->Args(args);
+    }
+}
+
+Graph make_workload(Workload workload, const benchmark::State& state) {
+    switch (workload) {
+        case Workload::FFT:
+            return checked(Graph::create_fft_graph_from_dimensions(
+                static_cast<int>(state.range(0))));
+        case Workload::DWT:
+            return std::move(make_dwt(state)[0]);
+        case Workload::MVM:
+            break;
+    }
+    return checked(Graph::create_mvm_graph_from_dimensions(
+        static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+}
+
+std::pair<Graph, Graph> make_workload_pair(Workload workload,
+                                           const benchmark::State& state) {
+    switch (workload) {
+        case Workload::FFT: {
+            const auto n = static_cast<int>(state.range(0));
+            return {checked(Graph::create_fft_graph_from_dimensions(n)),
+                    checked(Graph::create_fft_graph_from_dimensions(n / 2))};
+        }
+        case Workload::DWT: {
+            std::vector<Graph> graphs = make_dwt(state);
+            return {std::move(graphs[0]), std::move(graphs[1])};
+        }
+        case Workload::MVM:
+            break;
+    }
+    const auto m = static_cast<int>(state.range(0));
+    const auto n = static_cast<int>(state.range(1));
+    return {checked(Graph::create_mvm_graph_from_dimensions(m, n)),
+            checked(Graph::create_mvm_graph_from_dimensions(n, m))};
+}
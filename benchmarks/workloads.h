@@ -0,0 +1,65 @@
+/**
+ * @file workloads.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * The BCI kernel CDAGs the benchmark cases run on. A case's arguments give
+ * the kernel's dimensions: FFT (n), DWT (n, d, k) and MVM (m, n).
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef BENCHMARKS_WORKLOADS_H_
+#define BENCHMARKS_WORKLOADS_H_
+
+#include <benchmark/benchmark.h>
+#include <mcis/graph.h>
+
+#include <string>
+#include <utility>
+
+enum class Workload { FFT, DWT, MVM };
+
+/**
+ * @enum WorkloadScale
+ * @brief Which argument sets a case registers: the generators and graph
+ * operations scale to larger kernels than the MCIS finders.
+ */
+enum class WorkloadScale { LIBRARY, MCIS };
+
+constexpr Workload ALL_WORKLOADS[] = {Workload::FFT, Workload::DWT,
+                                      Workload::MVM};
+
+/**
+ * @return The workload's name, as used in benchmark names.
+ */
+std::string workload_name(Workload workload);
+
+/**
+ * @return The tag of the workload's arithmetic nodes.
+ */
+std::string workload_tag(Workload workload);
+
+/**
+ * @brief Registers the workload's argument sets on a benchmark.
+ */
+void apply_workload_args(benchmark::internal::Benchmark* bench,
+                         Workload workload, WorkloadScale scale);
+
+/**
+ * @brief Builds the workload's graph from the case's arguments.
+ */
+Graph make_workload(Workload workload, const benchmark::State& state);
+
+/**
+ * @brief Builds a pair of related graphs for the MCIS finders: FFT n against
+ * n / 2, the DWT's pruned average against its pruned coefficient graph, and
+ * MVM m x n against n x m.
+ */
+std::pair<Graph, Graph> make_workload_pair(Workload workload,
+                                           const benchmark::State& state);
+
+#endif  // BENCHMARKS_WORKLOADS_H_
@@ -7,6 +7,7 @@ class MCISConan(ConanFile):
     settings = "os", "compiler", "build_type", "arch"
     requires = [
         "gtest/1.17.0",
+        "benchmark/1.9.4",
         "llvm-openmp/20.1.6",
     ]
     generators = "CMakeDeps", "CMakeToolchain"
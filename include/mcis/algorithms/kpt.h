@@ -12,18 +12,35 @@
 #ifndef SRC_ALGORITHMS_KPT_H_
 #define SRC_ALGORITHMS_KPT_H_
 
-#include <map>
-#include <set>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "mcis/graph.h"
 #include "mcis/mcis_finder.h"
 
+class SearchControl;
+
+/**
+ * @brief Largest hyperedge conflict graph (in bytes) KPT will allocate.
+ */
+constexpr size_t KPT_MAX_CONFLICT_BYTES = size_t{1} << 30;
+
+/**
+ * @class KPT
+ *
+ * Local-ratio approximation over hyperedges, i.e. tuples with one vertex
+ * per input graph. Two hyperedges conflict if they share a vertex or if
+ * their vertices are connected by a path in some input graph. The conflict
+ * graph is built once over dense hyperedge indices, and the local-ratio
+ * steps then run iteratively on flat weight arrays with incrementally
+ * maintained conflict sums.
+ */
 class KPT : public MCISFinder {
  public:
     struct Hyperedge {
-        std::vector<std::string> node_ids;
+        std::vector<CompactGraph::VertexId> node_ids;
 
         bool operator<(const Hyperedge& other) const {
             return node_ids < other.node_ids;
@@ -37,16 +54,83 @@ class KPT : public MCISFinder {
         const std::vector<const Graph*>& graphs,
         std::optional<std::string> tag) override;
 
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Runs KPT on the hyperedges kept by the run options' candidate
+     * filter; candidate_stats, if set, receives the filter's counts.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) override;
+
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) override;
+
+    /**
+     * @brief Runs KPT on induced subgraph views. Views that leave out
+     * vertices are searched as materialized copies, so conflicts follow the
+     * paths inside the views.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Runs KPT on induced subgraph views and returns the matching as
+     * an owned mapping, without building any Graph.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) override;
+
  private:
-    using EdgeSet = std::set<Hyperedge>;
-    using WeightMap = std::map<Hyperedge, double>;
-
-    EdgeSet kPCM_Match(EdgeSet F, WeightMap w,
-                       const std::vector<const Graph*>& graphs);
-    bool are_conflicting(const Hyperedge& p1, const Hyperedge& p2,
-                         const std::vector<const Graph*>& graphs);
-    bool is_reachable(const Graph* g, const std::string& start_node_id,
-                      const std::string& end_node_id);
+    /**
+     * @brief Runs KPT on whole compact graphs.
+     * @param graphs The input graphs.
+     * @param tag If set, only vertices carrying it are matched.
+     * @param options Run options, as for find().
+     * @return The matching as a single mapping, or none if it is empty.
+     */
+    std::expected<std::vector<Mapping>, mcis::AlgorithmError> find_mappings(
+        const std::vector<const CompactGraph*>& graphs,
+        const std::optional<std::string>& tag, const RunOptions& options);
+
+    /**
+     * @brief Computes a conflict-free set of hyperedges by local ratio.
+     * @param F The hyperedges, indexed densely.
+     * @param w Initial weight of every hyperedge, parallel to F.
+     * @param graphs The graphs the hyperedges were drawn from.
+     * @param control Limits of the search; once they stop it, the
+     * hyperedges selected so far are unwound into the matching.
+     * @return Indices into F of the selected hyperedges, ascending.
+     */
+    std::vector<uint32_t> kPCM_Match(
+        const std::vector<Hyperedge>& F, std::vector<double> w,
+        const std::vector<const CompactGraph*>& graphs,
+        SearchControl& control);
+
+    /**
+     * @brief Builds the symmetric conflict graph of a set of hyperedges as
+     * bitset rows (without self-conflicts). Per graph, each vertex gets a
+     * mask of the hyperedges related to it, and a hyperedge's row is the OR
+     * of the masks of its vertices.
+     * @param F The hyperedges, indexed densely.
+     * @param graphs The graphs the hyperedges were drawn from.
+     * @param metrics If set, receives the phase time and the number of
+     * vertex pairs tested.
+     * @return F.size() rows of words_for(F.size()) words.
+     */
+    std::vector<uint64_t> build_conflicts(
+        const std::vector<Hyperedge>& F,
+        const std::vector<const CompactGraph*>& graphs,
+        SearchMetrics* metrics);
+    bool is_reachable(const CompactGraph* g,
+                      CompactGraph::VertexId start_node,
+                      CompactGraph::VertexId end_node);
 };
 
 #endif  // SRC_ALGORITHMS_KPT_H_
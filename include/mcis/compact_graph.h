@@ -0,0 +1,410 @@
+/**
+ * @file compact_graph.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_COMPACT_GRAPH_H_
+#define INCLUDE_MCIS_COMPACT_GRAPH_H_
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "mcis/errors.h"
+
+class Graph;
+class ReachabilityIndex;
+
+enum class HaarWaveletGraph { BOTH, PRUNED_AVERAGE, PRUNED_COEFFICIENT };
+
+/**
+ * @class CompactGraph
+ * @brief Immutable, integer-indexed snapshot of a Graph.
+ * Vertices are numbered densely from 0 to get_num_nodes() - 1 (in ascending
+ * order of their string IDs) and edges are stored in compressed sparse row
+ * (CSR) form for both directions, so adjacency scans and tests never hash
+ * strings or pointers. Tags are interned into a per-graph tag table.
+ * Snapshots made by the generators below number vertices by their closed-form
+ * index instead, and produce string IDs only when first asked for them.
+ */
+class CompactGraph {
+ public:
+    using VertexId = uint32_t;
+    using TagId = uint32_t;
+
+    /**
+     * @brief Default constructor that initializes an empty compact graph.
+     */
+    CompactGraph();
+
+    /**
+     * @brief Constructs a compact graph from out-edge CSR arrays.
+     * Each out-edge row is sorted by target and the in-edge CSR arrays and the
+     * ID index are derived from it.
+     * @param ids Node IDs, indexed by vertex ID.
+     * @param node_tags Tag ID of every vertex (index into tag_table).
+     * @param tag_table Interned tag strings.
+     * @param out_offsets Row offsets into out_targets, of size |V| + 1.
+     * @param out_targets Target vertex of every out-edge.
+     * @param out_weights Weight of every out-edge, parallel to out_targets.
+     */
+    CompactGraph(std::vector<std::string> ids, std::vector<TagId> node_tags,
+                 std::vector<std::string> tag_table,
+                 std::vector<uint32_t> out_offsets,
+                 std::vector<VertexId> out_targets,
+                 std::vector<int> out_weights);
+
+    /**
+     * @brief Produces the string ID of a vertex on demand.
+     */
+    using NameFunction = std::function<std::string(VertexId)>;
+
+    /**
+     * @brief Constructs a compact graph whose node IDs are generated on first
+     * use, so large generated graphs never build strings they do not need.
+     * @param name_of Returns the ID of a vertex; must be distinct per vertex
+     * and safe to call concurrently.
+     * @param node_tags Tag ID of every vertex; its size is |V|.
+     * @param tag_table Interned tag strings.
+     * @param out_offsets Row offsets into out_targets, of size |V| + 1.
+     * @param out_targets Target vertex of every out-edge.
+     * @param out_weights Weight of every out-edge, parallel to out_targets.
+     */
+    CompactGraph(NameFunction name_of, std::vector<TagId> node_tags,
+                 std::vector<std::string> tag_table,
+                 std::vector<uint32_t> out_offsets,
+                 std::vector<VertexId> out_targets,
+                 std::vector<int> out_weights);
+
+    /**
+     * @brief Generates the FFT CDAG directly in CSR form, stage by stage in
+     * parallel. Same nodes, tags and edges as
+     * Graph::create_fft_graph_from_dimensions.
+     * @param n Number of points in the FFT, must be a power of 2
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return Compact graph representing the FFT CDAG
+     */
+    [[nodiscard]]
+    static std::expected<CompactGraph, mcis::GraphError>
+    create_fft_graph_from_dimensions(int n, int num_threads = 0);
+
+    /**
+     * @brief Generates the MVM dataflow CDAG directly in CSR form, in
+     * parallel. Same nodes, tags and edges as
+     * Graph::create_mvm_graph_from_dimensions.
+     * @param m Number of rows in the matrix
+     * @param n Number of columns in the matrix
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return Compact graph representing the MVM dataflow CDAG
+     */
+    [[nodiscard]]
+    static std::expected<CompactGraph, mcis::GraphError>
+    create_mvm_graph_from_dimensions(int m, int n, int num_threads = 0);
+
+    /**
+     * @brief Generates the Haar wavelet transform CDAGs directly in CSR
+     * form, level by level in parallel. Same nodes, tags and edges as
+     * Graph::create_haar_wavelet_transform_graph_from_dimensions.
+     * @param n, s.t. n is an element of {k * 2^d | k is an integer >= 1, d is
+     * an integer >= 0}
+     * @param d level of DWT graph (integer >= 1)
+     * @param k Number of independent signal blocks (integer >= 1)
+     * @param type Which pruned graphs to generate
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return Compact graphs representing the Haar wavelet transform CDAG
+     */
+    [[nodiscard]]
+    static std::expected<std::vector<CompactGraph>, mcis::GraphError>
+    create_haar_wavelet_transform_graph_from_dimensions(
+        int n, int d, int k = 1, HaarWaveletGraph type = HaarWaveletGraph::BOTH,
+        int num_threads = 0);
+
+    /**
+     * @brief Retrieves the number of vertices in the graph.
+     * @return The number of vertices.
+     */
+    [[nodiscard]]
+    uint32_t get_num_nodes() const {
+        return static_cast<uint32_t>(node_tags.size());
+    }
+
+    /**
+     * @brief Retrieves the number of directed edges in the graph.
+     * @return The number of edges.
+     */
+    [[nodiscard]]
+    uint32_t get_num_edges() const {
+        return static_cast<uint32_t>(out_targets.size());
+    }
+
+    /**
+     * @brief Retrieves the children of a vertex, sorted ascending.
+     * @param v Vertex ID.
+     * @return Span over the target vertex IDs of v's out-edges.
+     */
+    [[nodiscard]]
+    std::span<const VertexId> out_neighbors(VertexId v) const {
+        return {out_targets.data() + out_offsets[v],
+                out_targets.data() + out_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Retrieves the weights of a vertex's out-edges.
+     * @param v Vertex ID.
+     * @return Span over the weights, parallel to out_neighbors(v).
+     */
+    [[nodiscard]]
+    std::span<const int> out_edge_weights(VertexId v) const {
+        return {out_weights.data() + out_offsets[v],
+                out_weights.data() + out_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Retrieves the parents of a vertex, sorted ascending.
+     * @param v Vertex ID.
+     * @return Span over the source vertex IDs of v's in-edges.
+     */
+    [[nodiscard]]
+    std::span<const VertexId> in_neighbors(VertexId v) const {
+        return {in_sources.data() + in_offsets[v],
+                in_sources.data() + in_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Retrieves the weights of a vertex's in-edges.
+     * @param v Vertex ID.
+     * @return Span over the weights, parallel to in_neighbors(v).
+     */
+    [[nodiscard]]
+    std::span<const int> in_edge_weights(VertexId v) const {
+        return {in_weights.data() + in_offsets[v],
+                in_weights.data() + in_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Retrieves the number of children (out-degree) of a vertex.
+     * @param v Vertex ID.
+     * @return The out-degree of v.
+     */
+    [[nodiscard]]
+    uint32_t out_degree(VertexId v) const {
+        return out_offsets[v + 1] - out_offsets[v];
+    }
+
+    /**
+     * @brief Retrieves the number of parents (in-degree) of a vertex.
+     * @param v Vertex ID.
+     * @return The in-degree of v.
+     */
+    [[nodiscard]]
+    uint32_t in_degree(VertexId v) const {
+        return in_offsets[v + 1] - in_offsets[v];
+    }
+
+    /**
+     * @brief Checks if there is a directed edge from one vertex to another.
+     * @param from Source vertex ID.
+     * @param to Destination vertex ID.
+     * @return True if the edge exists, false otherwise.
+     */
+    [[nodiscard]]
+    bool has_edge(VertexId from, VertexId to) const;
+
+    /**
+     * @brief Retrieves the string ID of a vertex.
+     * @param v Vertex ID.
+     * @return Constant reference to the node's ID.
+     */
+    [[nodiscard]]
+    const std::string& get_id(VertexId v) const {
+        return names()[v];
+    }
+
+    /**
+     * @brief Looks up the vertex ID of a node by its string ID.
+     * @param id Node ID.
+     * @return The vertex ID if found, std::nullopt otherwise.
+     */
+    [[nodiscard]]
+    std::optional<VertexId> get_index(const std::string& id) const;
+
+    /**
+     * @brief Retrieves the interned tag ID of a vertex.
+     * @param v Vertex ID.
+     * @return The vertex's tag ID.
+     */
+    [[nodiscard]]
+    TagId get_tag_id(VertexId v) const {
+        return node_tags[v];
+    }
+
+    /**
+     * @brief Retrieves the tag string of a vertex.
+     * @param v Vertex ID.
+     * @return Constant reference to the vertex's tag.
+     */
+    [[nodiscard]]
+    const std::string& get_tag(VertexId v) const {
+        return tag_table[node_tags[v]];
+    }
+
+    /**
+     * @brief Looks up the interned ID of a tag string.
+     * @param tag Tag string.
+     * @return The tag ID if any vertex carries the tag, std::nullopt
+     * otherwise.
+     */
+    [[nodiscard]]
+    std::optional<TagId> find_tag(const std::string& tag) const;
+
+    /**
+     * @brief Retrieves the interned tag table.
+     * @return Constant reference to the tag strings, indexed by tag ID.
+     */
+    [[nodiscard]]
+    const std::vector<std::string>& get_tag_table() const {
+        return tag_table;
+    }
+
+    /**
+     * @brief Checks if any edge carries a non-zero weight.
+     * @return True if the graph is weighted, false otherwise.
+     */
+    [[nodiscard]]
+    bool weighted() const {
+        return is_weighted;
+    }
+
+    /**
+     * @brief Creates a compact subgraph containing only vertices with a
+     * specific tag.
+     * @param tag The tag to filter vertices by.
+     * @return A new CompactGraph representing the induced subgraph.
+     */
+    [[nodiscard]]
+    CompactGraph get_subgraph_with_tag(const std::string& tag) const;
+
+    /**
+     * @brief Hashes the graph with Weisfeiler-Lehman refinement over tags,
+     * optionally node IDs, and edge directions. Edge weights are ignored, as
+     * they are by the finders. The hash does not depend on vertex numbering.
+     * With node IDs, equal hashes mean equal graphs up to hash collisions
+     * after one round. Without them, isomorphic graphs hash equally, and
+     * more rounds separate more non-isomorphic ones.
+     * @param include_ids Whether node IDs seed the vertex labels.
+     * @param rounds Number of refinement rounds.
+     * @return The 64-bit hash.
+     */
+    [[nodiscard]]
+    uint64_t structural_hash(bool include_ids = true, int rounds = 3) const;
+
+    /**
+     * @brief Retrieves the reachability index of the graph, building it on
+     * first use. The index is shared by all copies of this snapshot, so
+     * repeated runs on the same graph pay for it once. Safe to call from
+     * several threads.
+     * @return Constant reference to the index.
+     */
+    [[nodiscard]]
+    const ReachabilityIndex& reachability() const;
+
+    /**
+     * @brief Writes the snapshot in the binary graph format: a versioned
+     * header, both CSR directions, the tag IDs, a string table of node IDs
+     * and tags, and a checksum of everything after the header.
+     * @param path File to create or overwrite.
+     * @return std::nullopt on success, FILE_IO_ERROR otherwise.
+     */
+    [[nodiscard]]
+    std::optional<mcis::GraphError> save_binary(const std::string& path) const;
+
+    /**
+     * @brief Maps a file written by save_binary() read-only into memory. The
+     * arrays are used in place, without parsing; node IDs are only read out
+     * of the string table on first use. The mapping lives as long as any
+     * copy of the returned graph.
+     * @param path File to load.
+     * @param verify_checksum Whether to check the payload checksum, the one
+     * pass over the file the loader otherwise skips.
+     * @return The graph, or FILE_IO_ERROR, INVALID_FILE_FORMAT or
+     * CHECKSUM_MISMATCH.
+     */
+    [[nodiscard]]
+    static std::expected<CompactGraph, mcis::GraphError> load_binary(
+        const std::string& path, bool verify_checksum = true);
+
+    /**
+     * @brief Converts the snapshot back into a mutable Graph.
+     * @return A Graph with the same nodes, tags and weighted edges.
+     */
+    [[nodiscard]]
+    Graph thaw() const;
+
+ private:
+    /**
+     * @brief Node IDs indexed by vertex ID, generated on first use when the
+     * graph was built from a name function.
+     */
+    const std::vector<std::string>& names() const;
+
+    /**
+     * @brief Adopts arrays kept alive by storage, such as a file mapping.
+     */
+    CompactGraph(std::shared_ptr<const void> storage, NameFunction name_of,
+                 std::vector<std::string> tag_table,
+                 std::span<const TagId> node_tags,
+                 std::span<const uint32_t> out_offsets,
+                 std::span<const VertexId> out_targets,
+                 std::span<const int> out_weights,
+                 std::span<const uint32_t> in_offsets,
+                 std::span<const VertexId> in_sources,
+                 std::span<const int> in_weights, bool is_weighted);
+
+    /**
+     * @brief Per-vertex tag IDs and the interned tag strings.
+     */
+    std::span<const TagId> node_tags;
+    std::vector<std::string> tag_table;
+
+    /**
+     * @brief Out-edge CSR arrays (rows sorted by target).
+     */
+    std::span<const uint32_t> out_offsets;
+    std::span<const VertexId> out_targets;
+    std::span<const int> out_weights;
+
+    /**
+     * @brief In-edge CSR arrays (rows sorted by source).
+     */
+    std::span<const uint32_t> in_offsets;
+    std::span<const VertexId> in_sources;
+    std::span<const int> in_weights;
+
+    bool is_weighted = false;
+
+    /**
+     * @brief Owner of the arrays above: heap vectors for graphs built in
+     * memory, or a read-only file mapping for graphs from load_binary().
+     * Never written after construction, so copies share it.
+     */
+    std::shared_ptr<const void> storage;
+
+    /**
+     * @brief Lazily built analyses, shared between copies of the snapshot.
+     */
+    struct LazyAnalyses;
+    std::shared_ptr<LazyAnalyses> analyses;
+};
+
+#endif  // INCLUDE_MCIS_COMPACT_GRAPH_H_
@@ -0,0 +1,172 @@
+/**
+ * @file dense_product_graph.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_DENSE_PRODUCT_GRAPH_H_
+#define INCLUDE_MCIS_DENSE_PRODUCT_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+#include "mcis/errors.h"
+#include "mcis/graph_view.h"
+#include "mcis/mcis_result.h"
+#include "mcis/run_options.h"
+
+/**
+ * @struct DenseProductGraph
+ * @brief Product of N compact graphs with densely numbered vertices and
+ * adjacency stored as a symmetric bit matrix, rows of 64-bit words. Any
+ * clique finder can consume it: product vertex p is the p-th tuple
+ * (v_0, ..., v_{N-1}), by default the full product in lexicographic order.
+ * Under the MODULAR rule two product vertices are adjacent iff they differ
+ * in every component and the directed edge relation between the components
+ * (none, forward, backward or both) is the same in every input graph, so
+ * cliques correspond exactly to common induced subgraphs.
+ */
+struct DenseProductGraph {
+    /**
+     * @brief When two product vertices are adjacent.
+     */
+    enum class Rule {
+        // Injective and direction-aware, as described above
+        MODULAR,
+        // Edge presence ignoring direction agrees in every graph; components
+        // may repeat (the serial Bron-Kerbosch product)
+        UNDIRECTED,
+    };
+
+    size_t num_graphs = 0;
+    size_t num_vertices = 0;
+    size_t words_per_row = 0;
+
+    /**
+     * @brief Flattened tuples, num_graphs entries per product vertex.
+     */
+    std::vector<CompactGraph::VertexId> tuples;
+
+    /**
+     * @brief Adjacency rows, words_per_row words per product vertex.
+     */
+    std::vector<uint64_t> adjacency;
+
+    const uint64_t* row(size_t p) const {
+        return adjacency.data() + p * words_per_row;
+    }
+
+    CompactGraph::VertexId component(size_t p, size_t graph) const {
+        return tuples[p * num_graphs + graph];
+    }
+
+    /**
+     * @brief Computes the adjacency storage needed for a product graph with
+     * the given number of vertices without building it.
+     * @param num_vertices Number of product vertices.
+     * @return Number of bytes of the adjacency rows.
+     */
+    static size_t adjacency_bytes(size_t num_vertices);
+
+    /**
+     * @brief Computes the most product vertices whose adjacency fits in a
+     * byte budget.
+     * @param max_adjacency_bytes The budget in bytes.
+     * @return The largest n with adjacency_bytes(n) <= max_adjacency_bytes.
+     */
+    static size_t max_vertices(size_t max_adjacency_bytes);
+
+    /**
+     * @brief Builds the product restricted to the given tuples. Rows are
+     * split into blocks evaluated in parallel, each unordered pair once into
+     * the upper triangle, which is then mirrored by 64x64 bit block
+     * transposes.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tuples Flattened tuples, graphs.size() entries per product
+     * vertex; product vertex p is the p-th tuple.
+     * @param rule The adjacency rule.
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return The dense product graph.
+     */
+    static DenseProductGraph build(
+        const std::vector<const CompactGraph*>& graphs,
+        std::vector<CompactGraph::VertexId> tuples, Rule rule = Rule::MODULAR,
+        int num_threads = 0);
+
+    /**
+     * @brief Builds the modular product over the tuples kept by a candidate
+     * filter, refusing products whose adjacency would not fit in a budget.
+     * With no filter rules enabled this is the full modular product, in
+     * lexicographic tuple order.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param filter The tuple pruning rules.
+     * @param max_adjacency_bytes Largest adjacency to allocate.
+     * @param stats If set, receives the filter's kept and dropped counts.
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return The dense product graph, or PRODUCT_GRAPH_TOO_LARGE.
+     */
+    static std::expected<DenseProductGraph, mcis::AlgorithmError> build(
+        const std::vector<const CompactGraph*>& graphs,
+        const CandidateFilterOptions& filter, size_t max_adjacency_bytes,
+        CandidateFilterStats* stats, int num_threads = 0);
+
+    /**
+     * @brief Builds the modular product of induced subgraph views over the
+     * tuples kept by a candidate filter. Tuples hold parent vertex IDs, so
+     * clique_to_result() takes the views' parent graphs.
+     * @param views One view per input graph.
+     * @param filter The tuple pruning rules, evaluated within the views.
+     * @param max_adjacency_bytes Largest adjacency to allocate.
+     * @param stats If set, receives the filter's kept and dropped counts.
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return The dense product graph, or PRODUCT_GRAPH_TOO_LARGE.
+     */
+    static std::expected<DenseProductGraph, mcis::AlgorithmError> build(
+        const std::vector<GraphView>& views,
+        const CandidateFilterOptions& filter, size_t max_adjacency_bytes,
+        CandidateFilterStats* stats, int num_threads = 0);
+
+    /**
+     * @brief Grows a clique greedily by repeatedly taking the candidate with
+     * the most neighbours among the remaining candidates.
+     * @return Product vertices of a (maximal) clique.
+     */
+    std::vector<uint32_t> greedy_clique() const;
+
+    /**
+     * @brief Renumbers the product vertices.
+     * @param order order[i] is the current index of the vertex that becomes
+     * vertex i; must be a permutation of [0, num_vertices).
+     * @return The product graph with rows, columns and tuples permuted.
+     */
+    DenseProductGraph reordered(const std::vector<uint32_t>& order) const;
+
+    /**
+     * @brief Renumbers the product vertices by non-increasing degree (ties
+     * keep their order). Coloring in index order then puts high-degree
+     * vertices into the low color classes, which tightens coloring bounds.
+     * @return The renumbered product graph.
+     */
+    DenseProductGraph degree_ordered() const;
+
+    /**
+     * @brief Reads the vertex mapping of a clique of a MODULAR product, which
+     * is an induced common subgraph of the graphs.
+     * @param clique Product vertices forming a clique.
+     * @param graphs The graphs the product graph was built from.
+     * @return The result mapping vertex i to component(clique[i], g).
+     */
+    MCISResult clique_to_result(
+        const std::vector<uint32_t>& clique,
+        const std::vector<const CompactGraph*>& graphs) const;
+};
+
+#endif  // INCLUDE_MCIS_DENSE_PRODUCT_GRAPH_H_
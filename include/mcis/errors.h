@@ -30,11 +30,16 @@ enum class GraphError {
     INVALID_PARAMETERS,
     INVALID_DIMENSIONS,
     INCONSISTENT_DIMENSIONS,
+    FILE_IO_ERROR,
+    INVALID_FILE_FORMAT,
+    CHECKSUM_MISMATCH,
+    CYCLE_DETECTED,
 };
 
 enum class AlgorithmError {
     EMPTY_GRAPH,
     INVALID_ALGORITHM,
+    PRODUCT_GRAPH_TOO_LARGE,
 };
 
 inline std::ostream& operator<<(std::ostream& os, const NodeError& error) {
@@ -75,6 +80,18 @@ inline std::ostream& operator<<(std::ostream& os, const GraphError& error) {
         case GraphError::INCONSISTENT_DIMENSIONS:
             os << "GraphError: Inconsistent dimensions provided.";
             break;
+        case GraphError::FILE_IO_ERROR:
+            os << "GraphError: File could not be read or written.";
+            break;
+        case GraphError::INVALID_FILE_FORMAT:
+            os << "GraphError: File is not a valid graph file.";
+            break;
+        case GraphError::CHECKSUM_MISMATCH:
+            os << "GraphError: Graph file checksum mismatch.";
+            break;
+        case GraphError::CYCLE_DETECTED:
+            os << "GraphError: The graph has or would have a cycle.";
+            break;
     }
     return os;
 }
@@ -87,6 +104,9 @@ inline std::ostream& operator<<(std::ostream& os, const AlgorithmError& error) {
         case AlgorithmError::INVALID_ALGORITHM:
             os << "AlgorithmError: Invalid algorithm specified.";
             break;
+        case AlgorithmError::PRODUCT_GRAPH_TOO_LARGE:
+            os << "AlgorithmError: The product graph is too large.";
+            break;
     }
     return os;
 }
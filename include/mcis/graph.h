@@ -12,18 +12,126 @@
 #ifndef INCLUDE_MCIS_GRAPH_H_
 #define INCLUDE_MCIS_GRAPH_H_
 
+#include <complex>
+#include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "mcis/compact_graph.h"
 #include "mcis/errors.h"
 #include "mcis/node.h"
 
 constexpr int MVM_PARALLEL_THRESHOLD = 100;
 
-enum class HaarWaveletGraph { BOTH, PRUNED_AVERAGE, PRUNED_COEFFICIENT };
+/**
+ * @brief Number of edges the DOT and edge-list readers buffer before
+ * inserting them into the graph in bulk.
+ */
+constexpr size_t GRAPH_IMPORT_CHUNK_EDGES = size_t{1} << 16;
+
+/**
+ * @enum FftComponent
+ * @brief Which part of a complex FFT value a signal-driven FFT graph stores
+ * as its node payloads.
+ */
+enum class FftComponent { REAL, IMAGINARY, MAGNITUDE };
+
+/**
+ * @struct DiagramOptions
+ * @brief Where Graph::generate_diagram_file writes, and whether it renders.
+ */
+struct DiagramOptions {
+    // Directory the timestamped .gv file is written to
+    std::string dot_directory = "../../dot/";
+
+    // Also render a PNG with Graphviz, waiting for dot to finish
+    bool render = false;
+    std::string image_directory = "../../diagrams/";
+};
+
+/**
+ * @struct NodeIdHash
+ * @brief Transparent string hash, so node-ID maps can be searched with any
+ * string-like key without building a std::string.
+ */
+struct NodeIdHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view id) const {
+        return std::hash<std::string_view>{}(id);
+    }
+};
+
+/**
+ * @brief Map of node IDs to nodes, searchable by std::string_view.
+ */
+using NodeMap = std::unordered_map<std::string, Node*, NodeIdHash,
+                                   std::equal_to<>>;
+
+/**
+ * @struct GraphAnalysis
+ * @brief Whole-graph analyses computed together by Graph::analysis() and
+ * cached until the graph next changes. Node pointers refer to the graph's
+ * own nodes.
+ */
+struct GraphAnalysis {
+    // Graph::get_version() the analyses were computed at
+    int version = 0;
+
+    bool is_dag = false;
+
+    // Every node in Kahn order, sources first; empty unless is_dag
+    std::vector<Node*> topological_order;
+
+    // Position of each node in topological_order
+    std::unordered_map<const Node*, uint32_t> topological_index;
+
+    // By topological index: the longest path from a source to the node
+    // (ASAP), and the latest level it can take while every child stays on a
+    // later level, with sinks on the last level (ALAP)
+    std::vector<uint32_t> asap_levels;
+    std::vector<uint32_t> alap_levels;
+
+    // Nodes grouped by ASAP level, in topological order within a level
+    std::vector<std::vector<Node*>> levels;
+
+    // [d] is the number of nodes with in-degree (out-degree) d
+    std::vector<uint32_t> in_degree_histogram;
+    std::vector<uint32_t> out_degree_histogram;
+
+    // Nodes without parents, and without children
+    std::vector<Node*> sources;
+    std::vector<Node*> sinks;
+
+    // Nodes carrying each tag label
+    std::unordered_map<std::string, std::vector<Node*>, NodeIdHash,
+                       std::equal_to<>>
+        tag_index;
+
+    /**
+     * @brief Looks up a node's ASAP level.
+     * @param node A node of the analysed graph.
+     * @return The level, or std::nullopt if the graph is cyclic.
+     */
+    std::optional<uint32_t> asap_level(const Node* node) const;
+
+    /**
+     * @brief Looks up a node's ALAP level.
+     * @param node A node of the analysed graph.
+     * @return The level, or std::nullopt if the graph is cyclic.
+     */
+    std::optional<uint32_t> alap_level(const Node* node) const;
+};
 
 /**
  * @class Graph
@@ -33,16 +141,34 @@ enum class HaarWaveletGraph { BOTH, PRUNED_AVERAGE, PRUNED_COEFFICIENT };
  */
 class Graph {
  private:
+    /**
+     * @brief Resource the arena takes its blocks from.
+     */
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource();
+
+    /**
+     * @brief Arena holding every Node along with its ID, tag and edge maps.
+     * Nodes are never freed one at a time: a removed node's memory is kept
+     * until the graph is destroyed or reassigned, and teardown releases the
+     * whole arena at once without running per-node destructors. Created on
+     * first use, so moved-from graphs stay cheap.
+     */
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+
     /**
      * @brief Map of node IDs to Node pointers representing the graph's nodes.
      */
-    std::unordered_map<std::string, Node*> nodes;
+    NodeMap nodes;
 
     /**
-     * @brief Cache for frequently accessed data to improve performance.
+     * @brief Analyses and frozen snapshot of the graph, each valid while its
+     * version matches the graph's. The mutex lets concurrent readers of a
+     * graph that is not being modified share one computation.
      */
-    mutable bool dag_cache_valid = false;
-    mutable bool dag_cache_result = false;
+    mutable std::mutex cache_mutex;
+    mutable std::shared_ptr<const GraphAnalysis> analysis_cache;
+    mutable std::shared_ptr<const CompactGraph> frozen_cache;
+    mutable int frozen_version = -1;
     mutable int version = 0;
 
     /**
@@ -55,12 +181,73 @@ class Graph {
      */
     bool is_weighted = false;
 
+    /**
+     * @brief Topological order maintained edge by edge while incremental DAG
+     * mode is on. Removed nodes leave nullptr slots in dag_order until
+     * enough accumulate to compact it.
+     */
+    bool incremental_dag = false;
+    std::vector<Node*> dag_order;
+    std::unordered_map<const Node*, uint32_t> dag_position;
+    size_t dag_order_holes = 0;
+
+    /**
+     * @brief Appends a new node to the maintained order.
+     * @param node Node just added to the graph.
+     */
+    void track_dag_node(Node* node);
+
+    /**
+     * @brief Drops a node about to be removed from the maintained order.
+     * @param node Node being removed.
+     */
+    void untrack_dag_node(const Node* node);
+
+    /**
+     * @brief Reorders the maintained order so that from precedes to,
+     * Pearce-Kelly style: only nodes positioned between the two endpoints
+     * and reachable from to, or reaching from, are visited and permuted.
+     * @param from Source of the edge about to be added.
+     * @param to Target of the edge about to be added.
+     * @return False, leaving the order untouched, if the edge would close a
+     * cycle.
+     */
+    bool order_dag_edge(Node* from, Node* to);
+
+    /**
+     * @brief Allocates a node in the arena without registering it.
+     * @param id Unique identifier for the new node.
+     * @return Pointer to the new node, owned by the arena.
+     */
+    Node* create_node(std::string_view id);
+
+    /**
+     * @brief Creates the node for a freshly inserted map entry.
+     * @param it Entry whose key is the new node's ID.
+     */
+    void attach_node(NodeMap::iterator it);
+
+    /**
+     * @brief Replaces this graph's nodes with a copy of another graph's,
+     * sizing the arena and maps up front and linking edges directly.
+     * @param other Graph to copy from.
+     */
+    void copy_nodes_from(const Graph& other);
+
  public:
     /**
      * @brief Default constructor that initializes an empty graph.
      */
     Graph();
 
+    /**
+     * @brief Constructs an empty graph whose arena draws from the given
+     * memory resource.
+     * @param upstream Resource for the arena's blocks; must outlive the
+     * graph and its copies.
+     */
+    explicit Graph(std::pmr::memory_resource* upstream);
+
     /**
      * @brief Constructs a graph from a list of nodes.
      * @param node_list Vector of Node objects to initialize the graph with.
@@ -94,7 +281,7 @@ class Graph {
     Graph& operator=(Graph&& other) noexcept;
 
     /**
-     * @brief Destructor that cleans up dynamically allocated nodes.
+     * @brief Destructor that releases the node arena in one step.
      */
     ~Graph();
 
@@ -104,6 +291,41 @@ class Graph {
      */
     bool is_dag();
 
+    /**
+     * @brief Turns on incremental DAG mode: the graph keeps a topological
+     * order up to date across edits, is_dag() answers in constant time, and
+     * add_edge()/add_edge_set() reject an edge that would close a cycle
+     * with CYCLE_DETECTED, visiting only the part of the order between the
+     * edge's endpoints. Copies and moves keep the mode.
+     * @return std::nullopt on success, CYCLE_DETECTED if the graph already
+     * has a cycle.
+     */
+    std::optional<mcis::GraphError> enable_incremental_dag();
+
+    /**
+     * @brief Turns incremental DAG mode off and frees the maintained order.
+     */
+    void disable_incremental_dag();
+
+    /**
+     * @brief Reports whether incremental DAG mode is on.
+     * @return True if the graph maintains its topological order.
+     */
+    [[nodiscard]]
+    bool is_incremental_dag() const {
+        return incremental_dag;
+    }
+
+    /**
+     * @brief Computes the topological order, levels, degree histograms,
+     * sources, sinks and tag index in one pass, or returns them from the
+     * cache if the graph has not changed since. Edits made directly through
+     * Node bypass the version counter and are not noticed.
+     * @return The analyses; valid until the graph is next modified.
+     */
+    [[nodiscard]]
+    const GraphAnalysis& analysis() const;
+
     /**
      * @brief Prints the graph as node:[adjacency list].
      */
@@ -116,6 +338,13 @@ class Graph {
      */
     std::optional<mcis::GraphError> add_node(const std::string& id);
 
+    /**
+     * @brief Adds a node, moving the ID into the graph.
+     * @param id Unique identifier for the new node.
+     * @return An optional error if the node already exists.
+     */
+    std::optional<mcis::GraphError> add_node(std::string&& id);
+
     /**
      * @brief Adds multiple nodes with the given IDs to the graph.
      * @param ids Vector of unique identifiers for the new nodes.
@@ -125,11 +354,20 @@ class Graph {
         const std::vector<std::string>& ids);
 
     /**
-     * @brief Removes the node with the given ID from the graph.
+     * @brief Adds multiple nodes, moving the IDs into the graph.
+     * @param ids Vector of unique identifiers for the new nodes.
+     * @return An optional error if any node already exists.
+     */
+    std::optional<mcis::GraphError> add_node_set(
+        std::vector<std::string>&& ids);
+
+    /**
+     * @brief Removes the node with the given ID from the graph, along with
+     * its edges, in time linear in its degree.
      * @param id Unique identifier of the node to remove.
      * @return An optional error if the node does not exist.
      */
-    std::optional<mcis::GraphError> remove_node(const std::string& id);
+    std::optional<mcis::GraphError> remove_node(std::string_view id);
 
     /**
      * @brief Adds a directed edge from one node to another with a specified
@@ -138,10 +376,11 @@ class Graph {
      * @param to_id ID of the destination node.
      * @param weight Weight of the edge.
      * @return An optional error if either node does not exist or the edge
-     * already exists.
+     * already exists, or CYCLE_DETECTED if incremental DAG mode is on and the
+     * edge would close a cycle.
      */
-    std::optional<mcis::GraphError> add_edge(const std::string& from_id,
-                                             const std::string& to_id,
+    std::optional<mcis::GraphError> add_edge(std::string_view from_id,
+                                             std::string_view to_id,
                                              int weight);
 
     /**
@@ -152,10 +391,11 @@ class Graph {
      * @param weights Vector of weights of the edges, defaults to 0 if vector is
      * empty.
      * @return An optional error if the source node does not exist or any edge
-     * already exists.
+     * already exists, or CYCLE_DETECTED as for add_edge(). Edges before the
+     * failing one are kept.
      */
     std::optional<mcis::GraphError> add_edge_set(
-        const std::string& from_id, const std::vector<std::string>& to_ids,
+        std::string_view from_id, const std::vector<std::string>& to_ids,
         const std::vector<int>& weights = {});
 
     /**
@@ -165,8 +405,8 @@ class Graph {
      * @return An optional error if either node does not exist or the edge does
      * not exist.
      */
-    std::optional<mcis::GraphError> remove_edge(const std::string& from_id,
-                                                const std::string& to_id);
+    std::optional<mcis::GraphError> remove_edge(std::string_view from_id,
+                                                std::string_view to_id);
 
     /**
      * @brief Changes the weight of the edge from one node to another.
@@ -177,7 +417,7 @@ class Graph {
      * not exist.
      */
     std::optional<mcis::GraphError> change_edge_weight(
-        const std::string& from_id, const std::string& to_id, int new_weight);
+        std::string_view from_id, std::string_view to_id, int new_weight);
 
     /**
      * @brief Changes the tag of the node with the given ID.
@@ -185,8 +425,20 @@ class Graph {
      * @param new_tag New tag for the node.
      * @return An optional error if the node does not exist.
      */
-    std::optional<mcis::GraphError> set_node_tag(const std::string& id,
-                                                 const std::string& new_tag);
+    std::optional<mcis::GraphError> set_node_tag(std::string_view id,
+                                                 std::string_view new_tag);
+
+    /**
+     * @brief Changes the tag of the node with the given ID to a label that
+     * carries a numeric value. Tag comparisons only look at the label.
+     * @param id Unique identifier of the node.
+     * @param new_tag New tag label for the node.
+     * @param value Value carried with the tag, e.g. a signal value.
+     * @return An optional error if the node does not exist.
+     */
+    std::optional<mcis::GraphError> set_node_tag(std::string_view id,
+                                                 std::string_view new_tag,
+                                                 double value);
 
     /**
      * @brief Creates a subgraph containing only nodes with a specific tag.
@@ -196,12 +448,31 @@ class Graph {
     [[nodiscard]]
     Graph get_subgraph_with_tag(const std::string& tag) const;
 
+    /**
+     * @brief Creates an immutable, integer-indexed snapshot of the graph for
+     * algorithm hot paths.
+     * @return A CompactGraph with dense vertex IDs assigned in ascending order
+     * of node ID. The snapshot is cached until the graph changes, so
+     * repeated calls return copies sharing its arrays and lazy indexes.
+     */
+    [[nodiscard]]
+    CompactGraph freeze() const;
+
+    /**
+     * @brief Hashes the frozen graph; see CompactGraph::structural_hash().
+     * @param include_ids Whether node IDs seed the vertex labels.
+     * @param rounds Number of refinement rounds.
+     * @return The 64-bit hash.
+     */
+    [[nodiscard]]
+    uint64_t structural_hash(bool include_ids = true, int rounds = 3) const;
+
     /**
      * @brief Retrieves the node identified by the given ID
      * @param id Unique identifier of the node to retrieve.
      * @return Pointer to the Node if found, nullptr otherwise.
      */
-    Node* get_node(const std::string& id) const;
+    Node* get_node(std::string_view id) const;
 
     /**
      * @brief Retrieves the number of nodes in the graph.
@@ -216,7 +487,7 @@ class Graph {
      * pointers.
      */
     [[nodiscard]]
-    const std::unordered_map<std::string, Node*>& get_nodes() const;
+    const NodeMap& get_nodes() const;
 
     /**
      * @brief Equality operator to compare two graphs.
@@ -234,17 +505,85 @@ class Graph {
 
     /**
      * @brief Generates a DOT file representing the graph for visualization.
-     * @param filename Name of the output graph name
+     * @param graph_name Name of the output graph, prefixed by a timestamp
+     * @param options Output directories and whether to render a PNG
+     * @return std::nullopt on success, FILE_IO_ERROR if the file could not
+     * be written or dot could not be run.
+     */
+    std::optional<mcis::GraphError> generate_diagram_file(
+        const std::string& graph_name,
+        const DiagramOptions& options = DiagramOptions()) const;
+
+    /**
+     * @brief Streams the graph as a DOT digraph: one statement per node
+     * (with tag and value attributes if tagged) and per edge (labelled with
+     * its weight if the graph is weighted). read_dot() reads it back.
+     * @param out Stream to write to; output is buffered in large blocks.
+     * @param html_labels Also emit the v<SUB>i</SUB><SUP>d</SUP> labels
+     * used by generate_diagram_file.
+     * @return std::nullopt on success, FILE_IO_ERROR if the stream failed.
+     */
+    std::optional<mcis::GraphError> write_dot(std::ostream& out,
+                                              bool html_labels = false) const;
+
+    /**
+     * @brief Streams the graph as a plain edge list: a "from to" line per
+     * edge ("from to weight" if the graph is weighted) and a line with just
+     * the ID for every isolated node. Tags are not written.
+     * @param out Stream to write to.
+     * @return std::nullopt on success, INVALID_PARAMETERS if an ID contains
+     * whitespace, FILE_IO_ERROR if the stream failed.
+     */
+    std::optional<mcis::GraphError> write_edge_list(std::ostream& out) const;
+
+    /**
+     * @brief Reads a graph from a DOT subset: one digraph of node and edge
+     * statements (edge chains allowed), quoted or bare IDs, and comments. A
+     * node's tag and numeric value attributes set its tag, and an edge's
+     * integer label or weight attribute its weight; other attributes and
+     * graph, node and edge defaults are ignored. The input is parsed as a
+     * stream and inserted in chunks of GRAPH_IMPORT_CHUNK_EDGES edges.
+     * @param in Stream to read from.
+     * @return The graph, INVALID_FILE_FORMAT on a syntax error or
+     * unsupported construct (undirected graphs, subgraphs), or the error of
+     * an edge that cannot be added (duplicates, self-loops).
+     */
+    [[nodiscard]]
+    static std::expected<Graph, mcis::GraphError> read_dot(std::istream& in);
+
+    /**
+     * @brief Reads a graph from a plain edge list as written by
+     * write_edge_list(): whitespace-separated "from to [weight]" lines, lone
+     * IDs for isolated nodes, and '#' comments. Inserted in chunks of
+     * GRAPH_IMPORT_CHUNK_EDGES edges.
+     * @param in Stream to read from.
+     * @return The graph, INVALID_FILE_FORMAT on a malformed line, or the
+     * error of an edge that cannot be added.
      */
-    void generate_diagram_file(const std::string& graph_name) const;
+    [[nodiscard]]
+    static std::expected<Graph, mcis::GraphError> read_edge_list(
+        std::istream& in);
+
+    /**
+     * @brief Writes the graph in the binary graph format, readable with
+     * CompactGraph::load_binary().
+     * @param path File to create or overwrite.
+     * @return std::nullopt on success, FILE_IO_ERROR otherwise.
+     */
+    [[nodiscard]]
+    std::optional<mcis::GraphError> save_binary(const std::string& path) const;
 
     /**
      * @brief Bulk operations for better performance with large datasets.
      */
 
     /**
-     * @brief Removes multiple nodes efficiently in a single operation.
-     * @param node_ids Vector of node IDs to remove.
+     * @brief Removes multiple nodes efficiently in a single operation: the
+     * nodes are marked, then each surviving neighbour is rewired once, so
+     * the cost is linear in the removed nodes' degrees rather than in the
+     * size of the graph.
+     * @param node_ids Vector of node IDs to remove; unknown and repeated IDs
+     * are skipped.
      * @return Number of nodes successfully removed.
      */
     int remove_nodes_bulk(const std::vector<std::string>& node_ids);
@@ -315,6 +654,23 @@ class Graph {
         const std::vector<double>& signal, HaarWaveletGraph type
                                            = HaarWaveletGraph::BOTH);
 
+    /**
+     * @brief Static factory method for Haar wavelet transform CDAG creation
+     * from many channels at once. The channels are transformed together in
+     * one interleaved block, in place and vectorized across channels, and
+     * each channel gets the graphs that
+     * create_haar_wavelet_transform_graph_from_signal builds for it.
+     * @param signals One signal per channel, all of the same power-of-two
+     * length
+     * @param type Which pruned graphs to generate
+     * @return The graphs of each channel, in channel order
+     */
+    [[nodiscard]]
+    static std::expected<std::vector<std::vector<Graph>>, mcis::GraphError>
+    create_haar_wavelet_transform_graphs_from_signals(
+        const std::vector<std::vector<double>>& signals,
+        HaarWaveletGraph type = HaarWaveletGraph::BOTH);
+
     /**
      * @brief Static factory method for FFT CDAG creation from dimensions
      * @param n Number of points in the FFT, must be a power of 2
@@ -323,6 +679,20 @@ class Graph {
     [[nodiscard]]
     static std::expected<Graph, mcis::GraphError>
     create_fft_graph_from_dimensions(int n);
+
+    /**
+     * @brief Static factory method for FFT CDAG creation from a signal. The
+     * graph is the one create_fft_graph_from_dimensions builds, with every
+     * node's tag carrying its value: x_i the input, s<stage>_i the
+     * butterfly outputs and X_i the DFT coefficients.
+     * @param signal Input signal; its length must be a power of 2
+     * @param component Which part of the complex values to store
+     * @return Graph representing the FFT CDAG with its values
+     */
+    [[nodiscard]]
+    static std::expected<Graph, mcis::GraphError> create_fft_graph_from_signal(
+        const std::vector<std::complex<double>>& signal,
+        FftComponent component = FftComponent::REAL);
 };
 
 #endif  // INCLUDE_MCIS_GRAPH_H_
@@ -0,0 +1,185 @@
+/**
+ * @file graph_batch.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_GRAPH_BATCH_H_
+#define INCLUDE_MCIS_GRAPH_BATCH_H_
+
+#include <complex>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+#include "mcis/errors.h"
+#include "mcis/graph.h"
+
+/**
+ * @struct GraphInstance
+ * @brief Non-owning view of one instance of a GraphBatch: the shared
+ * topology and the instance's value of every vertex. Valid while the batch
+ * lives and keeps its size.
+ */
+struct GraphInstance {
+    const CompactGraph* topology = nullptr;
+    std::span<const double> values;
+};
+
+/**
+ * @class GraphBatch
+ * @brief Many instances of one CDAG that differ only in their node values,
+ * such as the DWT graph of every channel of a recording. The topology is a
+ * single immutable CompactGraph shared by the batch and its copies, so the
+ * analyses cached on it (reachability, structural hash) run once per
+ * topology, and the finders can be run on it directly. Each instance adds
+ * only one column of values: column i holds the value of every vertex of
+ * instance i, contiguous and indexed by vertex ID.
+ */
+class GraphBatch {
+ public:
+    using VertexId = CompactGraph::VertexId;
+
+    /**
+     * @brief Default constructor that initializes an empty batch.
+     */
+    GraphBatch() = default;
+
+    /**
+     * @brief Constructs a batch of instances whose values are all 0.
+     * @param topology The shared topology; must not be null.
+     * @param num_instances Number of instances.
+     */
+    GraphBatch(std::shared_ptr<const CompactGraph> topology,
+               size_t num_instances);
+
+    /**
+     * @brief Retrieves the shared topology.
+     * @return The topology.
+     */
+    [[nodiscard]]
+    const CompactGraph& topology() const {
+        return *shared;
+    }
+
+    /**
+     * @brief Retrieves the owning pointer to the shared topology, for
+     * building further batches over it.
+     * @return The topology pointer.
+     */
+    [[nodiscard]]
+    const std::shared_ptr<const CompactGraph>& shared_topology() const {
+        return shared;
+    }
+
+    /**
+     * @brief Retrieves the number of instances.
+     * @return The number of instances.
+     */
+    [[nodiscard]]
+    size_t size() const {
+        return num_instances;
+    }
+
+    /**
+     * @brief Retrieves the value column of an instance.
+     * @param instance Index of the instance, below size().
+     * @return The value of every vertex, indexed by vertex ID.
+     */
+    [[nodiscard]]
+    std::span<const double> values(size_t instance) const {
+        return {buffer.data() + instance * columns(), columns()};
+    }
+
+    [[nodiscard]]
+    std::span<double> values(size_t instance) {
+        return {buffer.data() + instance * columns(), columns()};
+    }
+
+    /**
+     * @brief Retrieves the value of one vertex of an instance.
+     * @param instance Index of the instance, below size().
+     * @param v Vertex ID in the topology.
+     * @return The value.
+     */
+    [[nodiscard]]
+    double value(size_t instance, VertexId v) const {
+        return buffer[instance * columns() + v];
+    }
+
+    /**
+     * @brief Views one instance.
+     * @param instance Index of the instance, below size().
+     * @return The topology and the instance's values.
+     */
+    [[nodiscard]]
+    GraphInstance instance(size_t instance) const {
+        return {shared.get(), values(instance)};
+    }
+
+    /**
+     * @brief Builds a standalone Graph of one instance, with every node's
+     * value as the payload of its tag.
+     * @param instance Index of the instance, below size().
+     * @return The graph.
+     */
+    [[nodiscard]]
+    Graph materialize(size_t instance) const;
+
+    /**
+     * @brief Generates the signal-driven Haar wavelet transform CDAGs of many
+     * channels as batches, one per generated graph type. Each batch holds
+     * one instance per channel, and its topology and values match what
+     * Graph::create_haar_wavelet_transform_graph_from_signal builds for
+     * that channel. The channels are transformed together, in place and
+     * vectorized across channels.
+     * @param signals One signal per channel, all of the same power-of-two
+     * length
+     * @param type Which pruned graphs to generate
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return The batches, average graph first when both are generated
+     */
+    [[nodiscard]]
+    static std::expected<std::vector<GraphBatch>, mcis::GraphError>
+    create_haar_wavelet_transform_batch_from_signals(
+        const std::vector<std::vector<double>>& signals,
+        HaarWaveletGraph type = HaarWaveletGraph::BOTH, int num_threads = 0);
+
+    /**
+     * @brief Generates the signal-driven FFT CDAG of many channels as one
+     * batch over the CompactGraph::create_fft_graph_from_dimensions
+     * topology. Instance i holds what Graph::create_fft_graph_from_signal
+     * builds for channel i.
+     * @param signals One signal per channel, all of the same power-of-two
+     * length
+     * @param component Which part of the complex values to store
+     * @param num_threads Number of threads (0 for the OpenMP default).
+     * @return The batch
+     */
+    [[nodiscard]]
+    static std::expected<GraphBatch, mcis::GraphError>
+    create_fft_batch_from_signals(
+        const std::vector<std::vector<std::complex<double>>>& signals,
+        FftComponent component = FftComponent::REAL, int num_threads = 0);
+
+ private:
+    std::shared_ptr<const CompactGraph> shared;
+    size_t num_instances = 0;
+
+    /**
+     * @brief The value columns, one after another.
+     */
+    std::vector<double> buffer;
+
+    size_t columns() const { return shared ? shared->get_num_nodes() : 0; }
+};
+
+#endif  // INCLUDE_MCIS_GRAPH_BATCH_H_
@@ -0,0 +1,168 @@
+/**
+ * @file graph_view.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_GRAPH_VIEW_H_
+#define INCLUDE_MCIS_GRAPH_VIEW_H_
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+
+/**
+ * @class GraphView
+ * @brief Non-owning induced subgraph of a CompactGraph, given by a vertex
+ * mask. Vertices keep their IDs in the parent graph and nothing is copied,
+ * so one frozen graph can be queried under many tags; materialize() makes an
+ * owning subgraph only when asked. The parent must outlive the view.
+ */
+class GraphView {
+ public:
+    using VertexId = CompactGraph::VertexId;
+
+    /**
+     * @brief Constructs a view of every vertex of a graph.
+     * @param graph The parent graph.
+     */
+    explicit GraphView(const CompactGraph& graph);
+
+    /**
+     * @brief Constructs a view of the vertices carrying a tag.
+     * @param graph The parent graph.
+     * @param tag The tag to keep; a tag the graph lacks gives an empty view.
+     */
+    GraphView(const CompactGraph& graph, const std::string& tag);
+
+    /**
+     * @brief Constructs a view of the vertices a predicate accepts.
+     * @param graph The parent graph.
+     * @param keep Called once per vertex ID, in ascending order.
+     */
+    template <typename Predicate>
+        requires std::predicate<Predicate&, VertexId>
+    GraphView(const CompactGraph& graph, Predicate keep)
+        : parent(&graph),
+          mask((graph.get_num_nodes() + 63) / 64, 0),
+          full(false) {
+        for (VertexId v = 0; v < graph.get_num_nodes(); ++v) {
+            if (keep(v)) {
+                add(v);
+            }
+        }
+    }
+
+    /**
+     * @brief Retrieves the parent graph.
+     * @return Constant reference to the parent graph.
+     */
+    [[nodiscard]]
+    const CompactGraph& graph() const {
+        return *parent;
+    }
+
+    /**
+     * @brief Retrieves the number of vertices in the view.
+     * @return The number of vertices.
+     */
+    [[nodiscard]]
+    uint32_t get_num_nodes() const {
+        return static_cast<uint32_t>(members.size());
+    }
+
+    /**
+     * @brief Retrieves the vertices of the view.
+     * @return Parent vertex IDs in ascending order.
+     */
+    [[nodiscard]]
+    std::span<const VertexId> vertices() const {
+        return members;
+    }
+
+    /**
+     * @brief Checks if a parent vertex belongs to the view.
+     * @param v Vertex ID in the parent graph.
+     * @return True if v is in the view.
+     */
+    [[nodiscard]]
+    bool contains(VertexId v) const {
+        return full ? v < parent->get_num_nodes()
+                    : (mask[v / 64] >> (v % 64)) & 1;
+    }
+
+    /**
+     * @brief Calls fn(target) for every out-neighbour of v inside the view.
+     * @param v Vertex ID in the parent graph.
+     * @param fn Callback taking a parent vertex ID.
+     */
+    template <typename Fn>
+    void for_each_out_neighbor(VertexId v, Fn&& fn) const {
+        for (const auto u : parent->out_neighbors(v)) {
+            if (contains(u)) {
+                fn(u);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls fn(source) for every in-neighbour of v inside the view.
+     * @param v Vertex ID in the parent graph.
+     * @param fn Callback taking a parent vertex ID.
+     */
+    template <typename Fn>
+    void for_each_in_neighbor(VertexId v, Fn&& fn) const {
+        for (const auto u : parent->in_neighbors(v)) {
+            if (contains(u)) {
+                fn(u);
+            }
+        }
+    }
+
+    /**
+     * @brief Counts the out-edges of v inside the view.
+     * @param v Vertex ID in the parent graph.
+     * @return The out-degree in the induced subgraph.
+     */
+    [[nodiscard]]
+    uint32_t out_degree(VertexId v) const;
+
+    /**
+     * @brief Counts the in-edges of v inside the view.
+     * @param v Vertex ID in the parent graph.
+     * @return The in-degree in the induced subgraph.
+     */
+    [[nodiscard]]
+    uint32_t in_degree(VertexId v) const;
+
+    /**
+     * @brief Copies the view into an owning compact graph. Vertices are
+     * renumbered densely in the same order, and only the tags in use are
+     * kept, interned in order of first use.
+     * @return The induced subgraph as a new CompactGraph.
+     */
+    [[nodiscard]]
+    CompactGraph materialize() const;
+
+ private:
+    void add(VertexId v) {
+        mask[v / 64] |= uint64_t{1} << (v % 64);
+        members.push_back(v);
+    }
+
+    const CompactGraph* parent;
+    std::vector<uint64_t> mask;
+    std::vector<VertexId> members;
+    bool full;
+};
+
+#endif  // INCLUDE_MCIS_GRAPH_VIEW_H_
@@ -12,19 +12,79 @@
 #ifndef INCLUDE_MCIS_MCIS_ALGORITHM_H_
 #define INCLUDE_MCIS_MCIS_ALGORITHM_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <expected>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "mcis/errors.h"
 #include "mcis/graph.h"
 #include "mcis/mcis_finder.h"
+#include "mcis/mcis_result.h"
+#include "mcis/run_options.h"
 
 /**
  * @enum AlgorithmType
  * @brief Enumeration of available MCIS algorithms.
  */
-enum class AlgorithmType { BRON_KERBOSCH_SERIAL, KPT };
+enum class AlgorithmType {
+    BRON_KERBOSCH_SERIAL,
+    KPT,
+    BRON_KERBOSCH_BITSET,
+    MAX_CLIQUE,
+    MAX_CLIQUE_PARALLEL,
+    MCSPLIT
+};
+
+/**
+ * @struct ResultCacheStats
+ * @brief Counters of the MCISAlgorithm result cache. A result read back from
+ * the cache directory counts as a hit.
+ */
+struct ResultCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+};
+
+/**
+ * @struct BatchJob
+ * @brief One run scheduled by MCISAlgorithm::run_batch. Jobs may share input
+ * graphs; each graph is frozen once and its snapshot shared by every job.
+ */
+struct BatchJob {
+    std::vector<const Graph*> graphs;
+    AlgorithmType type = AlgorithmType::MAX_CLIQUE;
+    std::optional<std::string> tag;
+    /**
+     * @brief Settings of this run. Its report and candidate_stats pointers
+     * are ignored: run_batch fills the BatchResult's own instead.
+     */
+    RunOptions options;
+};
+
+/**
+ * @struct BatchResult
+ * @brief The outcome of one BatchJob, which owns the graphs it found.
+ */
+struct BatchResult {
+    /**
+     * @brief Index of the job in the list given to run_batch.
+     */
+    size_t job = 0;
+    std::expected<std::vector<Graph>, mcis::AlgorithmError> graphs;
+    SearchReport report;
+    CandidateFilterStats candidate_stats;
+    std::chrono::milliseconds elapsed{0};
+};
 
 /**
  * @class MCISAlgorithm
@@ -39,6 +99,54 @@ class MCISAlgorithm {
      */
     std::vector<MCISFinder*> algorithms;
 
+    /**
+     * @brief Common subgraphs computed by run_folded, keyed by a hash of the
+     * algorithm, the candidate filter and the folded input graphs.
+     */
+    std::unordered_map<uint64_t, std::shared_ptr<const CompactGraph>>
+        fold_cache;
+    std::mutex fold_cache_mutex;
+
+    /**
+     * @brief Frozen results of a run whose search completed, with the bound
+     * its report gave.
+     */
+    struct CachedRun {
+        std::vector<CompactGraph> results;
+        size_t best_size = 0;
+        size_t upper_bound = 0;
+    };
+
+    /**
+     * @brief Frozen results of earlier runs, keyed by a hash of the
+     * algorithm, the tag, the candidate filter and the input graphs. The key
+     * leaves out the limits, so only completed searches are stored. The
+     * flag is atomic since runs read it without taking the mutex.
+     */
+    std::atomic<bool> result_cache_enabled = false;
+    std::optional<std::string> result_cache_directory;
+    std::unordered_map<uint64_t, CachedRun> result_cache;
+    ResultCacheStats result_cache_counts;
+    std::mutex result_cache_mutex;
+
+    using FindResult = std::expected<std::vector<Graph*>, mcis::AlgorithmError>;
+
+    /**
+     * @brief Returns the cached results for the key if there are any, and
+     * otherwise calls find and caches what it returns if its search
+     * completed. A stopped search's results depend on its limits, which the
+     * key leaves out, so they are returned but not cached.
+     * @param key Hash of the run, from the algorithm, options and inputs.
+     * @param options The run's options; a hit fills their report as a
+     * completed search.
+     * @param find Computes the results on a miss, with the options it is
+     * given.
+     * @return Fresh copies of the results, or find's error.
+     */
+    FindResult cached_find(
+        uint64_t key, const RunOptions& options,
+        const std::function<FindResult(const RunOptions&)>& find);
+
  public:
     /**
      * @brief Constructs the MCISAlgorithm manager and initializes available
@@ -56,12 +164,92 @@ class MCISAlgorithm {
      * @param graphs A vector of pointers to the input graphs.
      * @param type The type of algorithm to run (from AlgorithmType enum).
      * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
      * @return A vector of pointers to Graph objects representing the found MCIS
      * results, or an error.
      */
     std::expected<std::vector<Graph*>, mcis::AlgorithmError> run(
         const std::vector<const Graph*>& graphs, AlgorithmType type,
-        std::optional<std::string> tag = std::nullopt);
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Runs the specified MCIS algorithm on a braced list of input
+     * graphs, e.g. run({&g1, &g2}, type), which would otherwise be ambiguous
+     * between the Graph and CompactGraph overloads.
+     * @param graphs The input graphs.
+     * @param type The type of algorithm to run (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> run(
+        std::initializer_list<const Graph*> graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Runs the specified MCIS algorithm on a set of frozen graphs.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param type The type of algorithm to run (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> run(
+        const std::vector<const CompactGraph*>& graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Runs the specified MCIS algorithm and returns owned results
+     * holding the vertex mapping, so nothing has to be freed and no node
+     * names are built unless MCISResult::graph() is called. The result
+     * cache does not apply.
+     * @param graphs A vector of pointers to the input graphs. The results
+     * keep snapshots of them, so the graphs may be changed or destroyed
+     * afterwards.
+     * @param type The type of algorithm to run (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return The found results, whose columns hold vertex IDs of the
+     * frozen inputs, or an error.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError> run_results(
+        const std::vector<const Graph*>& graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Runs the specified MCIS algorithm on a braced list of input
+     * graphs and returns owned results; see the vector overload.
+     * @param graphs The input graphs.
+     * @param type The type of algorithm to run (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return The found results, or an error.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError> run_results(
+        std::initializer_list<const Graph*> graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Runs the specified MCIS algorithm on a set of frozen graphs and
+     * returns owned results; see the Graph overload.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param type The type of algorithm to run (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return The found results, whose columns hold vertex IDs of the
+     * graphs, or an error.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError> run_results(
+        const std::vector<const CompactGraph*>& graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
 
     /**
      * @brief Runs a user-specified MCIS algorithm on a set of input graphs.
@@ -69,6 +257,7 @@ class MCISAlgorithm {
      * @param graphs A vector of pointers to the input graphs.
      * @param algorithm Pointer to the user-specified algorithm instance.
      * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
      * @return A vector of pointers to Graph objects representing the found MCIS
      * results, or an error.
      */
@@ -76,7 +265,100 @@ class MCISAlgorithm {
         requires std::is_base_of_v<MCISFinder, T>
     std::expected<std::vector<Graph*>, mcis::AlgorithmError> run(
         const std::vector<const Graph*>& graphs, T* algorithm,
-        std::optional<std::string> tag = std::nullopt);
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Approximates the MCIS of many graphs by folding them pairwise:
+     * the graphs are sorted by size, neighbours are paired, and each pair is
+     * replaced by the MCIS of the two, until one graph is left. Each node of
+     * a folded result is an induced common subgraph of its inputs, so the
+     * final graph is common to every input, though it can be smaller than
+     * the exact N-way MCIS. The pairs of a round run in parallel, and every
+     * intermediate result is cached, so a later call that adds a larger
+     * graph reuses the folds of the smaller ones. Result node IDs join the
+     * per-graph IDs with "_" in folding order (smallest graph first).
+     * @param graphs A vector of pointers to the input graphs.
+     * @param type The pairwise algorithm (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count. The
+     * candidate filter applies to every pair, and candidate_stats sums the
+     * counts of the pairs that were not cached.
+     * @return The folded common subgraph (none if the inputs share no
+     * vertex), or an error.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> run_folded(
+        const std::vector<const Graph*>& graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Folds a braced list of input graphs; see the vector overload.
+     * @param graphs The input graphs.
+     * @param type The pairwise algorithm (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return The folded common subgraph, or an error.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> run_folded(
+        std::initializer_list<const Graph*> graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Folds a set of frozen graphs; see the Graph overload.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param type The pairwise algorithm (from AlgorithmType enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return The folded common subgraph, or an error.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> run_folded(
+        const std::vector<const CompactGraph*>& graphs, AlgorithmType type,
+        std::optional<std::string> tag = std::nullopt,
+        const RunOptions& options = {});
+
+    /**
+     * @brief Number of intermediate results cached by run_folded.
+     * @return The cache size.
+     */
+    size_t fold_cache_size();
+
+    /**
+     * @brief Drops every intermediate result cached by run_folded.
+     */
+    void clear_fold_cache();
+
+    /**
+     * @brief Turns on the result cache. Later runs of a built-in algorithm
+     * on inputs with the same structural_hash() (node IDs included), tag and
+     * candidate filter return copies of the earlier results instead of
+     * searching again. Only runs whose search completed are cached, so a
+     * hit never returns a result cut short by a limit or cancellation; its
+     * report says COMPLETE with the cached bound. Cached runs leave
+     * candidate_stats untouched.
+     * @param directory If set, results are also written to and read from
+     * this directory (created if needed), so they persist across processes.
+     */
+    void enable_result_cache(
+        std::optional<std::string> directory = std::nullopt);
+
+    /**
+     * @brief Turns off and empties the result cache. Files already in the
+     * cache directory are kept.
+     */
+    void disable_result_cache();
+
+    /**
+     * @brief Empties the in-memory result cache and resets its counters.
+     */
+    void clear_result_cache();
+
+    /**
+     * @brief Retrieves the result cache counters.
+     * @return Hits, misses and in-memory entries since the last clear.
+     */
+    ResultCacheStats result_cache_stats();
 
     /**
      * @brief Runs multiple specified MCIS algorithms on a set of input graphs.
@@ -84,6 +366,7 @@ class MCISAlgorithm {
      * @param types A vector of algorithm types to run (from AlgorithmType
      * enum).
      * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
      * @return A vector of vectors, where each inner vector contains pointers to
      * Graph objects representing the found MCIS results for each algorithm, or
      * an error.
@@ -91,7 +374,63 @@ class MCISAlgorithm {
     std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
     run_many(const std::vector<const Graph*>& graphs,
              std::vector<AlgorithmType> types,
-             std::optional<std::string> tag = std::nullopt);
+             std::optional<std::string> tag = std::nullopt,
+             const RunOptions& options = {});
+
+    /**
+     * @brief Runs multiple specified MCIS algorithms on a braced list of
+     * input graphs.
+     * @param graphs The input graphs.
+     * @param types A vector of algorithm types to run (from AlgorithmType
+     * enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of vectors, where each inner vector contains pointers to
+     * Graph objects representing the found MCIS results for each algorithm, or
+     * an error.
+     */
+    std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
+    run_many(std::initializer_list<const Graph*> graphs,
+             std::vector<AlgorithmType> types,
+             std::optional<std::string> tag = std::nullopt,
+             const RunOptions& options = {});
+
+    /**
+     * @brief Runs multiple specified MCIS algorithms on a set of frozen
+     * graphs. Lazily built analyses of the snapshots (such as the
+     * reachability index used by KPT) are shared by every algorithm and
+     * by later runs on the same snapshots.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param types A vector of algorithm types to run (from AlgorithmType
+     * enum).
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of vectors, where each inner vector contains pointers to
+     * Graph objects representing the found MCIS results for each algorithm, or
+     * an error.
+     */
+    std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
+    run_many(const std::vector<const CompactGraph*>& graphs,
+             std::vector<AlgorithmType> types,
+             std::optional<std::string> tag = std::nullopt,
+             const RunOptions& options = {});
+
+    /**
+     * @brief Runs a list of independent jobs across a thread pool. Jobs are
+     * started in decreasing order of estimated cost (the product of their
+     * input sizes) and handed out one at a time, so long jobs do not end up
+     * queued behind short ones. A failing job does not stop the others.
+     * Parallel finders run single-threaded inside the pool unless OpenMP
+     * nesting is enabled.
+     * @param jobs The jobs to run.
+     * @param num_threads Worker threads; 0 uses the OpenMP default.
+     * @param on_result Called with each result as its job finishes, from
+     * one thread at a time.
+     * @return One result per job, in the order of jobs.
+     */
+    std::vector<BatchResult> run_batch(
+        const std::vector<BatchJob>& jobs, int num_threads = 0,
+        const std::function<void(const BatchResult&)>& on_result = {});
 };
 
 #endif  // INCLUDE_MCIS_MCIS_ALGORITHM_H_
@@ -13,17 +13,25 @@
 #define INCLUDE_MCIS_MCIS_FINDER_H_
 
 #include <expected>
+#include <functional>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "mcis/compact_graph.h"
 #include "mcis/errors.h"
 #include "mcis/graph.h"
+#include "mcis/graph_view.h"
+#include "mcis/mcis_result.h"
+#include "mcis/run_options.h"
 
 /**
  * @class MCISFinder
  *
  * Abstract base class for finding the Maximum Common Induced Subgraph (MCIS)
  * between two graphs. Derived classes must implement the find method.
+ * Finders keep no state between calls and must not write to standard
+ * output, so one instance can serve several concurrent find calls.
  */
 class MCISFinder {
  public:
@@ -38,10 +46,209 @@ class MCISFinder {
         const std::vector<const Graph*>& graphs, std::optional<std::string> tag)
         = 0;
 
+    /**
+     * Finds the MCIS between a set of frozen graphs. The default
+     * implementation thaws the graphs and forwards to the Graph overload;
+     * finders with integer-indexed hot paths override it directly.
+     * @param graphs A vector of pointers to the compact graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if the graphs are empty.
+     */
+    virtual std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) {
+        std::vector<Graph> thawed;
+        thawed.reserve(graphs.size());
+        std::vector<const Graph*> thawed_ptrs;
+        thawed_ptrs.reserve(graphs.size());
+        for (const auto& graph : graphs) {
+            thawed.push_back(graph->thaw());
+            thawed_ptrs.push_back(&thawed.back());
+        }
+        return find(thawed_ptrs, tag);
+    }
+
+    /**
+     * Finds the MCIS between a set of graphs with per-call run options. The
+     * default implementation ignores the options.
+     * @param graphs A vector of pointers to the graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if the graphs are empty.
+     */
+    virtual std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) {
+        (void)options;
+        return find(graphs, tag);
+    }
+
+    /**
+     * Finds the MCIS between a set of frozen graphs with per-call run
+     * options. The default implementation ignores the options.
+     * @param graphs A vector of pointers to the compact graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if the graphs are empty.
+     */
+    virtual std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) {
+        (void)options;
+        return find(graphs, tag);
+    }
+
+    /**
+     * Finds the MCIS between induced subgraph views with per-call run
+     * options. The default implementation materializes the views and
+     * forwards to the compact overload; finders that work on parent vertex
+     * IDs override it to avoid the copies.
+     * @param views One view per input graph.
+     * @param options Per-call settings such as the thread count.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if the graphs are empty.
+     */
+    virtual std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views, const RunOptions& options) {
+        std::vector<CompactGraph> subgraphs;
+        subgraphs.reserve(views.size());
+        std::vector<const CompactGraph*> subgraph_ptrs;
+        subgraph_ptrs.reserve(views.size());
+        for (const auto& view : views) {
+            subgraphs.push_back(view.materialize());
+            subgraph_ptrs.push_back(&subgraphs.back());
+        }
+        return find(subgraph_ptrs, std::nullopt, options);
+    }
+
+    /**
+     * Finds the MCIS between induced subgraph views as owned mappings. The
+     * built-in finders implement their other overloads on top of this one;
+     * the default implementation reports INVALID_ALGORITHM, since a finder
+     * that only builds Graphs has no mapping to give.
+     * @param views One view per input graph.
+     * @param options Per-call settings such as the thread count.
+     * @return The results, whose columns hold parent vertex IDs of the
+     * views, or an error if the graphs are empty.
+     */
+    virtual std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) {
+        (void)views;
+        (void)options;
+        return std::unexpected(mcis::AlgorithmError::INVALID_ALGORITHM);
+    }
+
     /**
      * Virtual destructor.
      */
     virtual ~MCISFinder() {}
+
+ protected:
+    /**
+     * @brief One mapping in the layout MCISResult takes: one column per
+     * input graph, stored one after another.
+     */
+    using Mapping = std::vector<CompactGraph::VertexId>;
+
+    /**
+     * Builds one view per compact graph, for the compact overloads of
+     * finders that search views.
+     * @param graphs A vector of pointers to the compact graphs.
+     * @param tag If set, each view keeps only the nodes with this tag.
+     * @return The views, in the order of graphs.
+     */
+    static std::vector<GraphView> views_of(
+        const std::vector<const CompactGraph*>& graphs,
+        const std::optional<std::string>& tag) {
+        std::vector<GraphView> views;
+        views.reserve(graphs.size());
+        for (const auto& graph : graphs) {
+            if (tag) {
+                views.emplace_back(*graph, *tag);
+            } else {
+                views.emplace_back(*graph);
+            }
+        }
+        return views;
+    }
+
+    /**
+     * Materializes results as Graphs owned by the caller, for the Graph
+     * returning overloads.
+     * @param results Results, or an error to pass on.
+     * @return One Graph per non-empty result, or the error.
+     */
+    static std::expected<std::vector<Graph*>, mcis::AlgorithmError> to_graphs(
+        const std::expected<std::vector<MCISResult>, mcis::AlgorithmError>&
+            results) {
+        if (!results) {
+            return std::unexpected(results.error());
+        }
+        std::vector<Graph*> graphs;
+        graphs.reserve(results->size());
+        for (const auto& result : *results) {
+            if (!result.empty()) {
+                graphs.push_back(new Graph(result.to_graph()));
+            }
+        }
+        return graphs;
+    }
+
+    /**
+     * Runs a search written for whole compact graphs on views. Views that
+     * leave out vertices are materialized first, and the mappings found on
+     * them are translated back to parent vertex IDs.
+     * @param views One view per input graph.
+     * @param search Finds mappings between compact graphs.
+     * @return The results over the views' parent graphs, or search's error.
+     */
+    static std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_on_views(
+        const std::vector<GraphView>& views,
+        const std::function<
+            std::expected<std::vector<Mapping>, mcis::AlgorithmError>(
+                const std::vector<const CompactGraph*>&)>& search) {
+        std::vector<CompactGraph> subgraphs;
+        subgraphs.reserve(views.size());
+        std::vector<const CompactGraph*> graphs;
+        graphs.reserve(views.size());
+        std::vector<CompactGraph> parents;
+        parents.reserve(views.size());
+        for (const auto& view : views) {
+            parents.push_back(view.graph());
+            if (view.get_num_nodes() == view.graph().get_num_nodes()) {
+                graphs.push_back(&view.graph());
+            } else {
+                subgraphs.push_back(view.materialize());
+                graphs.push_back(&subgraphs.back());
+            }
+        }
+        auto mappings = search(graphs);
+        if (!mappings) {
+            return std::unexpected(mappings.error());
+        }
+
+        std::vector<MCISResult> results;
+        results.reserve(mappings->size());
+        for (auto& mapping : *mappings) {
+            const size_t size = mapping.size() / views.size();
+            for (size_t g = 0; g < views.size(); ++g) {
+                // Materialized vertices keep the order of the view
+                if (graphs[g] != &views[g].graph()) {
+                    const auto vertices = views[g].vertices();
+                    for (size_t i = g * size; i < (g + 1) * size; ++i) {
+                        mapping[i] = vertices[mapping[i]];
+                    }
+                }
+            }
+            results.emplace_back(parents, std::move(mapping));
+        }
+        return results;
+    }
 };
 
 #endif  // INCLUDE_MCIS_MCIS_FINDER_H_
@@ -0,0 +1,153 @@
+/**
+ * @file mcis_result.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_MCIS_RESULT_H_
+#define INCLUDE_MCIS_MCIS_RESULT_H_
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+
+/**
+ * @class MCISResult
+ * @brief An owned common induced subgraph, held as the vertex mapping
+ * between the input graphs. Vertex i of the result is vertex column(g)[i]
+ * of input g, for every input. The result keeps copies of the input
+ * snapshots, which share their arrays, so it stays valid after the inputs
+ * are gone and is cheap to copy. Building one costs the mapping and the
+ * induced edge list; the named Graph is only materialized on first use and
+ * then shared by every copy.
+ */
+class MCISResult {
+ public:
+    using VertexId = CompactGraph::VertexId;
+
+    /**
+     * @brief An induced edge from result vertex first to result vertex
+     * second.
+     */
+    using Edge = std::pair<uint32_t, uint32_t>;
+
+    /**
+     * @brief Default constructor that initializes an empty result.
+     */
+    MCISResult() = default;
+
+    /**
+     * @brief Constructs a result from its mapping.
+     * @param inputs The input graphs the mapping refers to.
+     * @param mapping One column per input graph, stored one after another:
+     * vertex i of input g is mapping[g * size + i].
+     */
+    MCISResult(std::vector<CompactGraph> inputs,
+               std::vector<VertexId> mapping);
+
+    /**
+     * @brief Retrieves the number of vertices in the result.
+     * @return The number of mapped vertex tuples.
+     */
+    [[nodiscard]]
+    size_t size() const {
+        return inputs.empty() ? 0 : mapping.size() / inputs.size();
+    }
+
+    /**
+     * @brief Checks if no vertex was mapped.
+     * @return True if the result is empty.
+     */
+    [[nodiscard]]
+    bool empty() const {
+        return mapping.empty();
+    }
+
+    /**
+     * @brief Retrieves the number of input graphs.
+     * @return The number of columns of the mapping.
+     */
+    [[nodiscard]]
+    size_t get_num_graphs() const {
+        return inputs.size();
+    }
+
+    /**
+     * @brief Retrieves the vertices of one input graph, in result order.
+     * @param g Index of the input graph.
+     * @return Vertex IDs in input g.
+     */
+    [[nodiscard]]
+    std::span<const VertexId> column(size_t g) const {
+        return {mapping.data() + g * size(), size()};
+    }
+
+    /**
+     * @brief Retrieves the snapshot of one input graph.
+     * @param g Index of the input graph.
+     * @return The input graph.
+     */
+    [[nodiscard]]
+    const CompactGraph& input(size_t g) const {
+        return inputs[g];
+    }
+
+    /**
+     * @brief Retrieves the induced edges: the pairs of result vertices whose
+     * mapped vertices are joined by an edge in every input graph, sorted.
+     * @return The edge list over result vertex indices.
+     */
+    [[nodiscard]]
+    std::span<const Edge> edges() const {
+        return induced;
+    }
+
+    /**
+     * @brief Builds the name of a result vertex by joining the IDs of its
+     * mapped vertices with "_".
+     * @param i Index of the result vertex.
+     * @return The vertex name used by graph().
+     */
+    [[nodiscard]]
+    std::string get_id(size_t i) const;
+
+    /**
+     * @brief Builds the result as a new named Graph. Vertices are named by
+     * get_id() and keep the first input's tag, and edges have weight 1.
+     * @return The materialized graph.
+     */
+    [[nodiscard]]
+    Graph to_graph() const;
+
+    /**
+     * @brief Retrieves the result as a named Graph, built by to_graph() on
+     * first use. Safe to call from several threads.
+     * @return The materialized graph, owned by the result.
+     */
+    [[nodiscard]]
+    const Graph& graph() const;
+
+ private:
+    std::vector<CompactGraph> inputs;
+    std::vector<VertexId> mapping;
+    std::vector<Edge> induced;
+
+    /**
+     * @brief The materialized graph, shared between copies of the result.
+     */
+    struct LazyGraph;
+    std::shared_ptr<LazyGraph> lazy;
+};
+
+#endif  // INCLUDE_MCIS_MCIS_RESULT_H_
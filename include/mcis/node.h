@@ -13,23 +13,28 @@
 #define INCLUDE_MCIS_NODE_H_
 
 #include <iostream>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "mcis/errors.h"
+#include "mcis/tag_symbols.h"
 
 /**
  * @class Node
  * @brief Represents a node in a directed graph with edges to its children.
  * This class provides methods to manage edges and retrieve node information.
+ * The ID, tag and edge maps allocate from the memory resource given at
+ * construction, which lets a Graph keep all of its nodes in one arena.
  */
 class Node {
  private:
     /**
      * @brief Unique identifier for the node.
      */
-    std::string id;
+    std::pmr::string id;
 
     /**
      * @brief Number of parent nodes (incoming edges).
@@ -45,26 +50,37 @@ class Node {
      * @brief Map of child nodes to the weights of the directed edges connecting
      * to them.
      */
-    std::unordered_map<Node*, int> children;
+    std::pmr::unordered_map<Node*, int> children;
 
     /**
      * @brief Map of parent nodes to the weights of the directed edges
      * connecting from them.
      */
-    std::unordered_map<Node*, int> parents;
+    std::pmr::unordered_map<Node*, int> parents;
 
     /**
-     * @brief String tag for grouping nodes.
+     * @brief Interned tag label for grouping nodes, and an optional numeric
+     * payload carried alongside it (e.g. the value a signal node holds).
      */
-    std::string tag;
+    TagSymbols::Symbol tag = TagSymbols::UNTAGGED;
+    bool has_tag_value = false;
+    double tag_value = 0.0;
+
+    /**
+     * @brief Graph copies and tears down nodes in bulk.
+     */
+    friend class Graph;
 
  public:
     /**
      * @brief Constructs a Node with a given ID and optional parent/child
      * counts.
      * @param id Unique identifier for the node.
+     * @param resource Memory resource for the ID, tag and edge maps.
      */
-    explicit Node(const std::string& id);
+    explicit Node(
+        std::string_view id,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief Copy constructor.
@@ -106,16 +122,53 @@ class Node {
 
     /**
      * @brief Retrieves the node's tag.
-     * @return The node's tag as a string.
+     * @return The node's tag label, followed by "," and the value if the tag
+     * carries one; an empty label with a value gives the value alone.
      */
     [[nodiscard]]
     std::string get_tag() const;
 
     /**
-     * @brief Sets the node's tag.
-     * @param new_tag The new tag for the node.
+     * @brief Views the node's unique identifier without copying it.
+     * @return The node's ID, valid while the node lives and keeps its ID.
+     */
+    [[nodiscard]]
+    std::string_view get_id_view() const;
+
+    /**
+     * @brief Views the node's tag label without copying it.
+     * @return The label, without any value; valid for the life of the
+     * process.
+     */
+    [[nodiscard]]
+    std::string_view get_tag_view() const;
+
+    /**
+     * @brief Retrieves the interned symbol of the node's tag label.
+     * @return The symbol; nodes with equal labels have equal symbols.
+     */
+    [[nodiscard]]
+    TagSymbols::Symbol get_tag_symbol() const;
+
+    /**
+     * @brief Retrieves the numeric payload of the node's tag.
+     * @return The value, or std::nullopt if the tag carries none.
+     */
+    [[nodiscard]]
+    std::optional<double> get_tag_value() const;
+
+    /**
+     * @brief Sets the node's tag, dropping any value.
+     * @param new_tag The new tag label for the node.
+     */
+    void set_tag(std::string_view new_tag);
+
+    /**
+     * @brief Sets the node's tag label and its numeric payload.
+     * @param new_tag The new tag label for the node.
+     * @param value Value carried with the tag.
      */
-    void set_tag(const std::string& new_tag);
+    void set_tag(std::string_view new_tag, double value);
 
     /**
      * @brief Retrieves the number of parent nodes (incoming edges).
@@ -184,7 +237,7 @@ class Node {
      * @return True if the given node is a parent, false otherwise.
      */
     [[nodiscard]]
-    bool check_parent(const std::string& parent_id) const;
+    bool check_parent(std::string_view parent_id) const;
 
     /**
      * @brief Checks if the node is a source (no incoming edges).
@@ -221,14 +274,14 @@ class Node {
      * @return Reference to the children map.
      */
     [[nodiscard]]
-    const std::unordered_map<Node*, int>& get_children() const;
+    const std::pmr::unordered_map<Node*, int>& get_children() const;
 
     /**
      * @brief Provides access to the parents map for external use.
      * @return Reference to the parents map.
      */
     [[nodiscard]]
-    const std::unordered_map<Node*, int>& get_parents() const;
+    const std::pmr::unordered_map<Node*, int>& get_parents() const;
 
     /**
      * @brief operator to print node and its children
@@ -0,0 +1,122 @@
+/**
+ * @file reachability_index.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_REACHABILITY_INDEX_H_
+#define INCLUDE_MCIS_REACHABILITY_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+
+/**
+ * @brief Largest number of strongly connected components for which a dense
+ * transitive closure is stored (2^14 components take 32 MiB).
+ */
+constexpr size_t REACHABILITY_DENSE_MAX_COMPONENTS = size_t{1} << 14;
+
+/**
+ * @brief Number of independent DFS interval labelings kept for graphs too
+ * large for a dense closure.
+ */
+constexpr size_t REACHABILITY_NUM_LABELINGS = 2;
+
+/**
+ * @class ReachabilityIndex
+ * @brief Answers "is there a directed path from u to v" for one compact
+ * graph. Vertices are first collapsed into strongly connected components,
+ * numbered in topological order of the condensation. Small condensations
+ * store the full transitive closure as one bitset row per component, so a
+ * query is a single bit test. Larger ones keep DFS post-order interval
+ * labels (GRAIL style): a query whose intervals are not nested, or whose
+ * topological order is wrong, is answered negatively at once, and the rest
+ * fall back to a DFS pruned by the same labels. Answers are exact in both
+ * modes, and the index is immutable once built, so it can be queried from
+ * several threads.
+ */
+class ReachabilityIndex {
+ public:
+    using VertexId = CompactGraph::VertexId;
+
+    /**
+     * @brief Builds the index of a graph.
+     * @param graph The graph to index.
+     * @param dense_max_components Largest condensation stored as a dense
+     * closure; larger ones use interval labels.
+     */
+    explicit ReachabilityIndex(
+        const CompactGraph& graph,
+        size_t dense_max_components = REACHABILITY_DENSE_MAX_COMPONENTS);
+
+    /**
+     * @brief Checks if a vertex can reach another. Every vertex reaches
+     * itself.
+     * @param from Source vertex ID.
+     * @param to Destination vertex ID.
+     * @return True if there is a directed path from `from` to `to`.
+     */
+    [[nodiscard]]
+    bool reachable(VertexId from, VertexId to) const;
+
+    /**
+     * @brief Retrieves the number of strongly connected components.
+     * @return The number of components of the condensation.
+     */
+    [[nodiscard]]
+    uint32_t get_num_components() const {
+        return num_components;
+    }
+
+    /**
+     * @brief Checks whether the index stores a dense transitive closure.
+     * @return True for the dense closure, false for interval labels.
+     */
+    [[nodiscard]]
+    bool is_dense() const {
+        return !closure.empty();
+    }
+
+ private:
+    uint32_t num_components = 0;
+
+    /**
+     * @brief Component of every vertex; an edge never leads to a component
+     * with a smaller number.
+     */
+    std::vector<uint32_t> component;
+
+    /**
+     * @brief Condensation edges in CSR form, without duplicates.
+     */
+    std::vector<uint32_t> dag_offsets;
+    std::vector<uint32_t> dag_targets;
+
+    /**
+     * @brief Dense closure rows of words_per_row words, one per component.
+     */
+    size_t words_per_row = 0;
+    std::vector<uint64_t> closure;
+
+    /**
+     * @brief Interval labels: labeling l of component c is the interval
+     * [low[l * n + c], post[l * n + c]].
+     */
+    std::vector<uint32_t> low;
+    std::vector<uint32_t> post;
+
+    void build_components(const CompactGraph& graph);
+    void build_closure();
+    void build_labels();
+    bool labels_contain(uint32_t outer, uint32_t inner) const;
+};
+
+#endif  // INCLUDE_MCIS_REACHABILITY_INDEX_H_
@@ -0,0 +1,247 @@
+/**
+ * @file run_options.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_RUN_OPTIONS_H_
+#define INCLUDE_MCIS_RUN_OPTIONS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stop_token>
+
+#include "mcis/search_metrics.h"
+
+/**
+ * @struct CandidateFilterOptions
+ * @brief Rules that drop product tuples before the product graph (or KPT
+ * hyperedge set) is built. A tuple is kept only if its vertices pass every
+ * enabled rule. Except for the tag rule on graphs whose tags must match,
+ * these are heuristics: a common subgraph need not preserve degrees or
+ * depths, so enabling them can shrink the result. All rules are off by
+ * default.
+ */
+struct CandidateFilterOptions {
+    /**
+     * @brief Keep only tuples whose vertices all carry the same tag.
+     */
+    bool match_tags = false;
+
+    /**
+     * @brief Keep only tuples whose vertices are all sources (no in-edges)
+     * or all non-sources, and likewise for sinks (no out-edges).
+     */
+    bool match_sources_and_sinks = false;
+
+    /**
+     * @brief Largest allowed spread (max - min) of the in-degrees across a
+     * tuple, and separately of the out-degrees.
+     */
+    std::optional<uint32_t> max_degree_difference;
+
+    /**
+     * @brief Largest allowed spread of the ASAP levels (longest path from a
+     * source) across a tuple. Vertices on a cycle have no level and are
+     * never dropped by this rule.
+     */
+    std::optional<uint32_t> max_level_difference;
+
+    /**
+     * @brief Whether any rule is enabled.
+     */
+    bool enabled() const {
+        return match_tags || match_sources_and_sinks || max_degree_difference
+               || max_level_difference;
+    }
+};
+
+/**
+ * @struct McSplitOptions
+ * @brief Matching rules of the McSplit finder, which works on label classes
+ * instead of a product graph and so takes them directly.
+ */
+struct McSplitOptions {
+    /**
+     * @brief Only grow mappings whose common subgraph stays weakly
+     * connected.
+     */
+    bool connected = false;
+
+    /**
+     * @brief Match edges with their direction, as the product-based finders
+     * do: u -> v only maps to u' -> v'. When unset, an edge in either
+     * direction matches an edge in either direction, and the result keeps
+     * the first graph's edges.
+     */
+    bool directed = true;
+
+    /**
+     * @brief Only map vertices carrying the same tag. Also enabled by
+     * CandidateFilterOptions::match_tags.
+     */
+    bool match_tags = false;
+};
+
+/**
+ * @struct CandidateFilterStats
+ * @brief How many product tuples the candidate filter kept and dropped. A
+ * dropped tuple is counted against the first rule it failed, checked in the
+ * order tag, source/sink, degree, level.
+ */
+struct CandidateFilterStats {
+    uint64_t total = 0;
+    uint64_t kept = 0;
+    uint64_t pruned_by_tag = 0;
+    uint64_t pruned_by_source_sink = 0;
+    uint64_t pruned_by_degree = 0;
+    uint64_t pruned_by_level = 0;
+
+    uint64_t pruned() const { return total - kept; }
+};
+
+/**
+ * @enum SearchStatus
+ * @brief Why a search ended.
+ */
+enum class SearchStatus {
+    COMPLETE,
+    TIME_LIMIT,
+    BUDGET_EXHAUSTED,
+    CANCELLED,
+};
+
+/**
+ * @struct SearchProgress
+ * @brief Snapshot of a running search, passed to RunOptions::progress.
+ */
+struct SearchProgress {
+    size_t incumbent_size = 0;
+    size_t upper_bound = 0;
+    uint64_t expansions = 0;
+    std::chrono::milliseconds elapsed{0};
+};
+
+/**
+ * @struct SearchReport
+ * @brief Outcome of one search. A stopped search still returns the best
+ * solution it found, and the bound says how far from optimal it can be.
+ * The exact finders prove optimality when they complete, so the bound then
+ * equals the result size; KPT is an approximation and keeps a looser bound.
+ */
+struct SearchReport {
+    SearchStatus status = SearchStatus::COMPLETE;
+    size_t best_size = 0;
+    size_t upper_bound = 0;
+    uint64_t expansions = 0;
+    std::chrono::milliseconds elapsed{0};
+
+    /**
+     * @brief Relative optimality gap (upper_bound - best_size) /
+     * upper_bound, 0 when the result is proven optimal.
+     */
+    double gap() const {
+        return upper_bound == 0 ? 0.0
+                                : static_cast<double>(upper_bound - best_size)
+                                      / static_cast<double>(upper_bound);
+    }
+};
+
+/**
+ * @struct RunOptions
+ * @brief Per-call settings for MCISAlgorithm::run. Finders ignore the fields
+ * that do not apply to them.
+ */
+struct RunOptions {
+    /**
+     * @brief Number of worker threads for parallel finders and product graph
+     * construction; 0 uses the OpenMP default (OMP_NUM_THREADS or the number
+     * of hardware threads).
+     */
+    int num_threads = 0;
+
+    /**
+     * @brief Tuple pruning applied by the product-based finders before
+     * construction.
+     */
+    CandidateFilterOptions candidate_filter;
+
+    /**
+     * @brief If set, receives the candidate filter's counts for the call.
+     * With run_many it holds the counts of the last algorithm run.
+     */
+    CandidateFilterStats* candidate_stats = nullptr;
+
+    /**
+     * @brief Matching rules of MCSPLIT.
+     */
+    McSplitOptions mcsplit;
+
+    /**
+     * @brief Detects the automorphisms of each input (such as the
+     * interchangeable butterflies of an FFT or rows of an MVM) and lets the
+     * maximum clique searches skip the branches that are images of
+     * finished ones. The result has the same size, though it may be a
+     * different, symmetric MCIS. Applies to MAX_CLIQUE and
+     * MAX_CLIQUE_PARALLEL.
+     */
+    bool symmetry_breaking = false;
+
+    /**
+     * @brief Search time limit, counted from the start of the search. When
+     * neither this nor deadline is set, each finder keeps its built-in limit
+     * (5 s for the clique searches and McSplit, none for KPT).
+     */
+    std::optional<std::chrono::milliseconds> time_limit;
+
+    /**
+     * @brief Absolute end of the search, for sharing one wall-clock budget
+     * across many runs. The earlier of this and time_limit applies.
+     */
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+
+    /**
+     * @brief Largest number of search expansions (branch-and-bound nodes,
+     * or KPT selection steps). Workers check it every so many expansions,
+     * so a search can overrun it slightly.
+     */
+    std::optional<uint64_t> expansion_budget;
+
+    /**
+     * @brief Stops the search once stop is requested on its source.
+     */
+    std::stop_token stop_token;
+
+    /**
+     * @brief If set, called with the search state at most once per
+     * progress_interval and once when the search ends. Calls come from the
+     * searching threads, one at a time per search.
+     */
+    std::function<void(const SearchProgress&)> progress;
+    std::chrono::milliseconds progress_interval{100};
+
+    /**
+     * @brief If set, receives the outcome of the search. With run_many it
+     * holds the outcome of the last algorithm run. A run served by the
+     * result cache reports COMPLETE with the cached best size and upper
+     * bound, and zero counters; run_folded leaves it untouched.
+     */
+    SearchReport* report = nullptr;
+
+    /**
+     * @brief If set, accumulates the finders' phase timings and search
+     * counters over every call it is given to. Stays zero when the library
+     * is built without MCIS_ENABLE_METRICS.
+     */
+    SearchMetrics* metrics = nullptr;
+};
+
+#endif  // INCLUDE_MCIS_RUN_OPTIONS_H_
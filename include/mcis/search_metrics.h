@@ -0,0 +1,133 @@
+/**
+ * @file search_metrics.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Where the finders spend their time: phase timers, search counters and an
+ * optional Chrome trace. The instrumentation is compiled in when MCIS_METRICS
+ * is nonzero (the MCIS_ENABLE_METRICS CMake option); otherwise every hook
+ * is an empty inline function and SearchMetrics stays zero.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_SEARCH_METRICS_H_
+#define INCLUDE_MCIS_SEARCH_METRICS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mcis/errors.h"
+
+#ifndef MCIS_METRICS
+#define MCIS_METRICS 1
+#endif
+
+/**
+ * @struct PhaseMetrics
+ * @brief Accumulated wall time of one named phase of a finder, such as
+ * product_graph, search or result_conversion.
+ */
+struct PhaseMetrics {
+    std::string name;
+    uint64_t calls = 0;
+    std::chrono::nanoseconds total{0};
+};
+
+/**
+ * @struct TraceEvent
+ * @brief One timed phase, as a Chrome trace complete ("X") event.
+ */
+struct TraceEvent {
+    std::string name;
+    // Microseconds on the steady clock
+    int64_t start_us = 0;
+    int64_t duration_us = 0;
+    // Small sequential ID of the recording thread
+    uint32_t thread = 0;
+};
+
+/**
+ * @struct SearchMetrics
+ * @brief Instrumentation of finder calls. Counters and phases accumulate
+ * over every call given the same object; assign SearchMetrics{} to reset.
+ */
+struct SearchMetrics {
+    /**
+     * @brief Whether the library was built with instrumentation.
+     */
+    static constexpr bool ENABLED = MCIS_METRICS != 0;
+
+    /**
+     * @brief Timed phases, in the order they were first entered.
+     */
+    std::vector<PhaseMetrics> phases;
+
+    /**
+     * @brief Recursion nodes (search tree nodes) visited.
+     */
+    uint64_t search_nodes = 0;
+
+    /**
+     * @brief Branches skipped because their bound could not beat the best
+     * solution found so far.
+     */
+    uint64_t pruned_branches = 0;
+
+    /**
+     * @brief Largest candidate set at any search node.
+     */
+    uint64_t peak_frontier = 0;
+
+    /**
+     * @brief Candidate set intersections performed while branching.
+     */
+    uint64_t set_intersections = 0;
+
+    /**
+     * @brief Pivot choices made by the Bron-Kerbosch searches.
+     */
+    uint64_t pivot_selections = 0;
+
+    /**
+     * @brief Vertex pairs KPT tested for conflicts.
+     */
+    uint64_t conflict_checks = 0;
+
+    /**
+     * @brief Whether phases are also recorded as trace events.
+     */
+    bool record_trace = false;
+    std::vector<TraceEvent> trace;
+
+    /**
+     * @brief Looks up a phase by name.
+     * @return The phase, or nullptr if it was never entered.
+     */
+    const PhaseMetrics* phase(std::string_view name) const;
+
+    /**
+     * @brief Writes the trace events as Chrome trace JSON, which Perfetto
+     * and chrome://tracing open.
+     * @param out The stream to write to.
+     */
+    void write_chrome_trace(std::ostream& out) const;
+
+    /**
+     * @brief Writes the trace events as Chrome trace JSON to a file.
+     * @param path The file to write.
+     * @return An error if the file cannot be written.
+     */
+    std::optional<mcis::GraphError> write_chrome_trace(
+        const std::string& path) const;
+};
+
+#endif  // INCLUDE_MCIS_SEARCH_METRICS_H_
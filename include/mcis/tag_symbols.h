@@ -0,0 +1,62 @@
+/**
+ * @file tag_symbols.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_TAG_SYMBOLS_H_
+#define INCLUDE_MCIS_TAG_SYMBOLS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+/**
+ * @class TagSymbols
+ * @brief Process-wide intern table for node tag labels ("+", "*",
+ * "+/sqrt(2)", ...). Each distinct label gets a small integer symbol once,
+ * so nodes store four bytes instead of a string and tag checks compare
+ * integers. Symbol 0 is the empty label of untagged nodes. Labels are never
+ * removed, and the table is safe to use from several threads.
+ */
+class TagSymbols {
+ public:
+    using Symbol = uint32_t;
+
+    static constexpr Symbol UNTAGGED = 0;
+
+    /**
+     * @brief Returns the symbol of a label, adding the label if it is new.
+     * @param label Tag label.
+     * @return The label's symbol.
+     */
+    static Symbol intern(std::string_view label);
+
+    /**
+     * @brief Looks up the symbol of a label without adding it.
+     * @param label Tag label.
+     * @return The symbol, or std::nullopt if the label was never interned.
+     */
+    static std::optional<Symbol> find(std::string_view label);
+
+    /**
+     * @brief Retrieves the label of a symbol.
+     * @param symbol A symbol returned by intern().
+     * @return The label; the view stays valid for the life of the process.
+     */
+    static std::string_view label(Symbol symbol);
+
+    /**
+     * @brief Retrieves the number of interned labels.
+     * @return The number of labels, including the empty one.
+     */
+    static size_t size();
+};
+
+#endif  // INCLUDE_MCIS_TAG_SYMBOLS_H_
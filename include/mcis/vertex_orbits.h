@@ -0,0 +1,122 @@
+/**
+ * @file vertex_orbits.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef INCLUDE_MCIS_VERTEX_ORBITS_H_
+#define INCLUDE_MCIS_VERTEX_ORBITS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+#include "mcis/graph_view.h"
+
+/**
+ * @brief Default number of refinements VertexOrbits may spend searching for
+ * automorphisms.
+ */
+constexpr uint64_t ORBIT_SEARCH_BUDGET = uint64_t{1} << 14;
+
+/**
+ * @class VertexOrbits
+ * @brief Orbits of the vertices of a graph (or view) under automorphisms
+ * that preserve edge direction and tags. Vertices are first partitioned by
+ * color refinement: starting from their tags, classes are split by the
+ * multisets of their in- and out-neighbours' classes until stable. Within
+ * each class, automorphisms are then searched for by individualizing one
+ * vertex in each of two copies and refining again, backtracking until the
+ * partitions are discrete. Every automorphism found is checked edge by
+ * edge, and the orbits are those of the group the found automorphisms
+ * generate, so vertices only share an orbit if an automorphism maps one to
+ * the other. A search that runs out of budget leaves orbits split, which is
+ * always safe for symmetry breaking; a complete search reports exactly the
+ * orbits of the automorphism group.
+ *
+ * Given fixed vertices, the orbits are those of the automorphisms that fix
+ * each of them (the pointwise stabilizer).
+ */
+class VertexOrbits {
+ public:
+    using VertexId = CompactGraph::VertexId;
+
+    /**
+     * @brief Sentinel orbit of vertices outside the view.
+     */
+    static constexpr uint32_t NO_ORBIT = UINT32_MAX;
+
+    /**
+     * @brief Computes the orbits of the vertices of a view.
+     * @param view The graph or induced subgraph.
+     * @param fixed Vertices of the view every automorphism must fix.
+     * @param budget Largest number of refinements spent searching for
+     * automorphisms.
+     */
+    explicit VertexOrbits(const GraphView& view,
+                          std::span<const VertexId> fixed = {},
+                          uint64_t budget = ORBIT_SEARCH_BUDGET);
+
+    /**
+     * @brief Retrieves the orbit of a vertex.
+     * @param v Vertex ID in the parent graph.
+     * @return Dense orbit index, or NO_ORBIT if v is not in the view.
+     */
+    [[nodiscard]]
+    uint32_t orbit(VertexId v) const {
+        return orbit_of[v];
+    }
+
+    /**
+     * @brief Retrieves the number of orbits.
+     * @return The number of orbits.
+     */
+    [[nodiscard]]
+    uint32_t get_num_orbits() const {
+        return num_orbits;
+    }
+
+    /**
+     * @brief Retrieves the number of automorphisms found, which generate the
+     * group whose orbits are reported.
+     * @return The number of generators.
+     */
+    [[nodiscard]]
+    size_t get_num_generators() const {
+        return num_generators;
+    }
+
+    /**
+     * @brief Checks whether every orbit is a single vertex.
+     * @return True if no symmetry was found.
+     */
+    [[nodiscard]]
+    bool trivial() const {
+        return num_generators == 0;
+    }
+
+    /**
+     * @brief Checks whether the search finished within its budget, so that
+     * vertices in different orbits are never mapped onto each other.
+     * @return True if the orbits are exact.
+     */
+    [[nodiscard]]
+    bool complete() const {
+        return exact;
+    }
+
+ private:
+    std::vector<uint32_t> orbit_of;
+    uint32_t num_orbits = 0;
+    size_t num_generators = 0;
+    bool exact = true;
+};
+
+#endif  // INCLUDE_MCIS_VERTEX_ORBITS_H_
@@ -0,0 +1,227 @@
+/**
+ * @file bitset_ops.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Word-wise kernels over rows of 64-bit words used by the bitset clique
+ * finders. AVX-512 (with VPOPCNTDQ) and AVX2 paths are selected at compile
+ * time (see the MCIS_NATIVE_ARCH CMake option); the scalar fallback is always
+ * available.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_BITSET_OPS_H_
+#define SRC_ALGORITHMS_BITSET_OPS_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace mcis::bitset {
+
+constexpr size_t WORD_BITS = 64;
+
+/**
+ * @brief Number of 64-bit words needed to hold a row of n bits.
+ */
+inline size_t words_for(size_t n) { return (n + WORD_BITS - 1) / WORD_BITS; }
+
+inline void set(uint64_t* row, size_t bit) {
+    row[bit / WORD_BITS] |= uint64_t{1} << (bit % WORD_BITS);
+}
+
+inline void reset(uint64_t* row, size_t bit) {
+    row[bit / WORD_BITS] &= ~(uint64_t{1} << (bit % WORD_BITS));
+}
+
+inline bool test(const uint64_t* row, size_t bit) {
+    return (row[bit / WORD_BITS] >> (bit % WORD_BITS)) & 1;
+}
+
+#if defined(__AVX2__) && !defined(__AVX512VPOPCNTDQ__)
+/**
+ * @brief Per-64-bit-lane popcount of a 256-bit vector (nibble lookup, Mula).
+ */
+inline __m256i popcount_lanes(__m256i v) {
+    const __m256i lookup
+        = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0,
+                           1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                     _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+inline size_t horizontal_sum(__m256i v) {
+    return static_cast<size_t>(_mm256_extract_epi64(v, 0))
+           + static_cast<size_t>(_mm256_extract_epi64(v, 1))
+           + static_cast<size_t>(_mm256_extract_epi64(v, 2))
+           + static_cast<size_t>(_mm256_extract_epi64(v, 3));
+}
+#endif
+
+/**
+ * @brief Population count of a row.
+ */
+inline size_t count(const uint64_t* a, size_t words) {
+    size_t total = 0;
+    size_t i = 0;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 8 <= words; i += 8) {
+        acc = _mm512_add_epi64(
+            acc, _mm512_popcnt_epi64(_mm512_loadu_si512(a + i)));
+    }
+    total += static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+#elif defined(__AVX2__)
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= words; i += 4) {
+        acc = _mm256_add_epi64(
+            acc, popcount_lanes(_mm256_loadu_si256(
+                     reinterpret_cast<const __m256i*>(a + i))));
+    }
+    total += horizontal_sum(acc);
+#endif
+    for (; i < words; ++i) {
+        total += static_cast<size_t>(std::popcount(a[i]));
+    }
+    return total;
+}
+
+/**
+ * @brief Population count of (a & b) without materializing the result.
+ */
+inline size_t and_count(const uint64_t* a, const uint64_t* b, size_t words) {
+    size_t total = 0;
+    size_t i = 0;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 8 <= words; i += 8) {
+        __m512i v = _mm512_and_si512(_mm512_loadu_si512(a + i),
+                                     _mm512_loadu_si512(b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    total += static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+#elif defined(__AVX2__)
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= words; i += 4) {
+        __m256i v = _mm256_and_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        acc = _mm256_add_epi64(acc, popcount_lanes(v));
+    }
+    total += horizontal_sum(acc);
+#endif
+    for (; i < words; ++i) {
+        total += static_cast<size_t>(std::popcount(a[i] & b[i]));
+    }
+    return total;
+}
+
+/**
+ * @brief dst = a & b.
+ */
+inline void and_into(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                     size_t words) {
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= words; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_and_si512(_mm512_loadu_si512(a + i),
+                                             _mm512_loadu_si512(b + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 4 <= words; i += 4) {
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dst + i),
+            _mm256_and_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i))));
+    }
+#endif
+    for (; i < words; ++i) {
+        dst[i] = a[i] & b[i];
+    }
+}
+
+/**
+ * @brief dst = a & ~b.
+ */
+inline void and_not_into(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                         size_t words) {
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= words; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_andnot_si512(_mm512_loadu_si512(b + i),
+                                                _mm512_loadu_si512(a + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 4 <= words; i += 4) {
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dst + i),
+            _mm256_andnot_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i))));
+    }
+#endif
+    for (; i < words; ++i) {
+        dst[i] = a[i] & ~b[i];
+    }
+}
+
+/**
+ * @brief Checks if any bit of the row is set.
+ */
+inline bool any(const uint64_t* a, size_t words) {
+    for (size_t i = 0; i < words; ++i) {
+        if (a[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Calls fn(bit) for every set bit of the row in ascending order.
+ */
+template <typename Fn>
+inline void for_each_bit(const uint64_t* a, size_t words, Fn&& fn) {
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t word = a[i];
+        while (word != 0) {
+            fn(i * WORD_BITS + static_cast<size_t>(std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+}
+
+/**
+ * @brief Transposes a 64x64 bit matrix in place: afterwards bit i of a[j] is
+ * what bit j of a[i] was. Swaps ever smaller off-diagonal blocks, so it
+ * takes 6 passes of 32 word pairs.
+ */
+inline void transpose_64x64(uint64_t* a) {
+    uint64_t mask = 0x00000000FFFFFFFFull;
+    for (size_t j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+        for (size_t k = 0; k < WORD_BITS; k = ((k | j) + 1) & ~j) {
+            const uint64_t t = ((a[k] >> j) ^ a[k | j]) & mask;
+            a[k | j] ^= t;
+            a[k] ^= t << j;
+        }
+    }
+}
+
+}  // namespace mcis::bitset
+
+#endif  // SRC_ALGORITHMS_BITSET_OPS_H_
@@ -0,0 +1,280 @@
+/**
+ * @file bron_kerbosch_bitset.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./bron_kerbosch_bitset.h"
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./bitset_ops.h"
+#include "./metrics_recorder.h"
+#include "./search_control.h"
+
+namespace {
+
+/**
+ * @class TomitaSearch
+ * @brief Pivoted Bron-Kerbosch over bitset rows. Each recursion depth owns a
+ * preallocated P, X and candidate row, so the search allocates only when it
+ * first reaches a new depth.
+ */
+class TomitaSearch {
+ public:
+    TomitaSearch(const DenseProductGraph& product_graph,
+                 SearchControl& control, size_t max_results)
+        : graph(product_graph),
+          words(product_graph.words_per_row),
+          max_results(max_results),
+          control(control) {}
+
+    std::vector<std::vector<uint32_t>> run() {
+        if (graph.num_vertices == 0) {
+            control.finish(0, true);
+            return {};
+        }
+        std::vector<uint32_t> greedy = graph.greedy_clique();
+        best_size = greedy.size();
+
+        ensure_level(0);
+        uint64_t* P = level_row(0, 0);
+        for (size_t v = 0; v < graph.num_vertices; ++v) {
+            mcis::bitset::set(P, v);
+        }
+        timed_out = control.stopped();
+        expand(0);
+        control.count(pending_expansions);
+        counters.flush(control.metrics());
+
+        if (cliques.empty()) {
+            cliques.push_back(std::move(greedy));
+        }
+        control.finish(best_size, true);
+        return std::move(cliques);
+    }
+
+ private:
+    const DenseProductGraph& graph;
+    const size_t words;
+    const size_t max_results;
+    SearchControl& control;
+
+    std::vector<std::vector<uint64_t>> levels;
+    std::vector<uint32_t> R;
+    std::vector<std::vector<uint32_t>> cliques;
+    size_t best_size = 0;
+    uint64_t pending_expansions = 0;
+    bool timed_out = false;
+    MetricCounters counters;
+
+    void ensure_level(size_t depth) {
+        while (levels.size() <= depth) {
+            levels.emplace_back(3 * words, 0);
+        }
+    }
+
+    // Row 0 is P, row 1 is X and row 2 the candidates P \ N(pivot)
+    uint64_t* level_row(size_t depth, size_t which) {
+        return levels[depth].data() + which * words;
+    }
+
+    bool out_of_time() {
+        if (!timed_out
+            && ++pending_expansions == SearchControl::CHECK_INTERVAL) {
+            pending_expansions = 0;
+            timed_out
+                = control.check(SearchControl::CHECK_INTERVAL, best_size);
+        }
+        return timed_out;
+    }
+
+    void report() {
+        if (R.size() > best_size) {
+            best_size = R.size();
+            cliques.clear();
+        }
+        if (R.size() == best_size && cliques.size() < max_results) {
+            cliques.push_back(R);
+        }
+    }
+
+    void expand(size_t depth) {
+        if (out_of_time()) {
+            return;
+        }
+
+        uint64_t* P = level_row(depth, 0);
+        uint64_t* X = level_row(depth, 1);
+        if (!mcis::bitset::any(P, words)) {
+            if (!mcis::bitset::any(X, words)) {
+                report();
+            }
+            return;
+        }
+
+        // Once the result list is full only strictly larger cliques matter
+        const size_t reachable = R.size() + mcis::bitset::count(P, words);
+        if (reachable < best_size
+            || (reachable == best_size && cliques.size() >= max_results)) {
+            counters.prune();
+            return;
+        }
+        counters.node(reachable - R.size());
+
+        // Tomita pivot: the vertex of P u X with most neighbours in P
+        size_t pivot = 0;
+        size_t pivot_degree = 0;
+        bool have_pivot = false;
+        auto consider = [&](size_t u) {
+            size_t degree = mcis::bitset::and_count(P, graph.row(u), words);
+            if (!have_pivot || degree > pivot_degree) {
+                pivot = u;
+                pivot_degree = degree;
+                have_pivot = true;
+            }
+        };
+        mcis::bitset::for_each_bit(P, words, consider);
+        mcis::bitset::for_each_bit(X, words, consider);
+        counters.pivot();
+
+        uint64_t* candidates = level_row(depth, 2);
+        mcis::bitset::and_not_into(candidates, P, graph.row(pivot), words);
+
+        ensure_level(depth + 1);
+        // ensure_level may reallocate the level table
+        P = level_row(depth, 0);
+        X = level_row(depth, 1);
+        candidates = level_row(depth, 2);
+
+        for (size_t w = 0; w < words && !timed_out; ++w) {
+            uint64_t word = candidates[w];
+            while (word != 0 && !timed_out) {
+                const size_t v = w * mcis::bitset::WORD_BITS
+                                 + static_cast<size_t>(std::countr_zero(word));
+                word &= word - 1;
+
+                const uint64_t* neighbors = graph.row(v);
+                mcis::bitset::and_into(level_row(depth + 1, 0), P, neighbors,
+                                       words);
+                mcis::bitset::and_into(level_row(depth + 1, 1), X, neighbors,
+                                       words);
+                counters.intersect(2);
+                R.push_back(static_cast<uint32_t>(v));
+                expand(depth + 1);
+                R.pop_back();
+
+                P = level_row(depth, 0);
+                X = level_row(depth, 1);
+                mcis::bitset::reset(P, v);
+                mcis::bitset::set(X, v);
+            }
+        }
+    }
+};
+
+}  // namespace
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschBitset::find(const std::vector<const Graph*>& graphs,
+                         std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschBitset::find(const std::vector<const CompactGraph*>& graphs,
+                         std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschBitset::find(const std::vector<const Graph*>& graphs,
+                         std::optional<std::string> tag,
+                         const RunOptions& options) {
+    for (const auto& graph : graphs) {
+        if (graph->get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+    }
+
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    std::vector<const CompactGraph*> compact_ptrs;
+    compact_ptrs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        compact_graphs.push_back(graph->freeze());
+        compact_ptrs.push_back(&compact_graphs.back());
+    }
+    return find(compact_ptrs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschBitset::find(const std::vector<const CompactGraph*>& graphs,
+                         std::optional<std::string> tag,
+                         const RunOptions& options) {
+    return find(views_of(graphs, tag), options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschBitset::find(const std::vector<GraphView>& views,
+                         const RunOptions& options) {
+    return to_graphs(find_results(views, options));
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+BronKerboschBitset::find_results(const std::vector<GraphView>& views,
+                                 const RunOptions& options) {
+    if (views.empty()) {
+        return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+    }
+    std::vector<const CompactGraph*> graphs;
+    graphs.reserve(views.size());
+    for (const auto& view : views) {
+        if (view.get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+        graphs.push_back(&view.graph());
+    }
+
+    ScopedPhase product_phase(options.metrics, "product_graph");
+    auto built = DenseProductGraph::build(views, options.candidate_filter,
+                                          BK_BITSET_MAX_ADJACENCY_BYTES,
+                                          options.candidate_stats,
+                                          options.num_threads);
+    product_phase.stop();
+    if (!built) {
+        return std::unexpected(built.error());
+    }
+    const DenseProductGraph& product_graph = *built;
+    std::vector<std::vector<uint32_t>> cliques
+        = find_maximum_cliques(product_graph, options);
+
+    ScopedPhase conversion_phase(options.metrics, "result_conversion");
+    std::vector<MCISResult> results;
+    results.reserve(cliques.size());
+    for (const auto& clique : cliques) {
+        if (!clique.empty()) {
+            results.push_back(product_graph.clique_to_result(clique, graphs));
+        }
+    }
+    return results;
+}
+
+std::vector<std::vector<uint32_t>> BronKerboschBitset::find_maximum_cliques(
+    const DenseProductGraph& product_graph, const RunOptions& options) {
+    ScopedPhase search_phase(options.metrics, "search");
+    SearchControl control(options,
+                          std::chrono::milliseconds(BK_BITSET_TIMEOUT_MS),
+                          product_graph.num_vertices);
+    TomitaSearch search(product_graph, control, BK_BITSET_MAX_RESULTS);
+    return search.run();
+}
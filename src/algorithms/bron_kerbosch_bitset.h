@@ -0,0 +1,142 @@
+/**
+ * @file bron_kerbosch_bitset.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_BRON_KERBOSCH_BITSET_H_
+#define SRC_ALGORITHMS_BRON_KERBOSCH_BITSET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mcis/dense_product_graph.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_finder.h"
+
+/**
+ * @brief Default time limit for one bitset Bron-Kerbosch search in
+ * milliseconds, used when the run options set none.
+ */
+constexpr int BK_BITSET_TIMEOUT_MS = 5000;
+
+/**
+ * @brief Maximum number of equally sized maximum cliques reported.
+ */
+constexpr size_t BK_BITSET_MAX_RESULTS = 64;
+
+/**
+ * @brief Largest product graph adjacency (in bytes) the finder will allocate.
+ */
+constexpr size_t BK_BITSET_MAX_ADJACENCY_BYTES = size_t{2} << 30;
+
+/**
+ * @class BronKerboschBitset
+ *
+ * Implements Tomita-style pivoted Bron-Kerbosch over a dense modular product
+ * graph. Product vertices are numbered densely and every vertex set (R, P, X
+ * and adjacency rows) is a row of 64-bit words, so each recursion step is a
+ * handful of word-wise AND/popcount passes instead of set operations on
+ * string tuples. Branches that cannot reach the best clique size found so far
+ * are pruned, and only the largest cliques are reported.
+ */
+class BronKerboschBitset : public MCISFinder {
+ public:
+    /**
+     * @brief Finds the MCIS between a set of graphs using bitset
+     * Bron-Kerbosch.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds the MCIS between a set of frozen graphs using bitset
+     * Bron-Kerbosch.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty or the product graph does
+     * not fit in BK_BITSET_MAX_ADJACENCY_BYTES.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds the MCIS between a set of graphs using bitset
+     * Bron-Kerbosch, pruning
+     * product tuples with the run options' candidate filter first.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between a set of frozen graphs using bitset
+     * Bron-Kerbosch,
+     * pruning product tuples with the run options' candidate filter first.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty or the product graph does
+     * not fit in BK_BITSET_MAX_ADJACENCY_BYTES.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views without copying
+     * them; product tuples hold parent vertex IDs.
+     * @param views One view per input graph.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if a view is empty or the product graph is too
+     * large.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views as owned
+     * mappings, without building any Graph.
+     * @param views One view per input graph.
+     * @param options Run options, as for find().
+     * @return The found results, or an error if a view is empty.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) override;
+
+ private:
+    /**
+     * @brief Enumerates the maximum cliques of a product graph.
+     * @param product_graph The product graph to search.
+     * @param options Run options; the limits, token, progress callback and
+     * report apply.
+     * @return Up to BK_BITSET_MAX_RESULTS cliques of the largest size found.
+     */
+    std::vector<std::vector<uint32_t>> find_maximum_cliques(
+        const DenseProductGraph& product_graph, const RunOptions& options);
+};
+
+#endif  // SRC_ALGORITHMS_BRON_KERBOSCH_BITSET_H_
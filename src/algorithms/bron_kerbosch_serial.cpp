@@ -13,157 +13,203 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <iostream>
 #include <iterator>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "./bitset_ops.h"
+#include "./candidate_filter.h"
+#include "./metrics_recorder.h"
+#include "mcis/dense_product_graph.h"
+
 std::expected<std::vector<Graph*>, mcis::AlgorithmError>
 BronKerboschSerial::find(const std::vector<const Graph*>& graphs,
                          std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschSerial::find(const std::vector<const CompactGraph*>& graphs,
+                         std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschSerial::find(const std::vector<const Graph*>& graphs,
+                         std::optional<std::string> tag,
+                         const RunOptions& options) {
     for (const auto& graph : graphs) {
         if (graph->get_num_nodes() == 0) {
             return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
         }
     }
 
-    ProductGraph product_graph = build_product_graph(graphs);
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    std::vector<const CompactGraph*> compact_ptrs;
+    compact_ptrs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        compact_graphs.push_back(graph->freeze());
+        compact_ptrs.push_back(&compact_graphs.back());
+    }
+    return find(compact_ptrs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschSerial::find(const std::vector<const CompactGraph*>& graphs,
+                         std::optional<std::string> tag,
+                         const RunOptions& options) {
+    return find(views_of(graphs, tag), options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+BronKerboschSerial::find(const std::vector<GraphView>& views,
+                         const RunOptions& options) {
+    return to_graphs(find_results(views, options));
+}
 
-    std::cout << "Product graph has " << product_graph.nodes.size()
-              << " nodes\n";
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+BronKerboschSerial::find_results(const std::vector<GraphView>& views,
+                                 const RunOptions& options) {
+    for (const auto& view : views) {
+        if (view.get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+    }
+    return find_on_views(views,
+                         [&](const std::vector<const CompactGraph*>& graphs) {
+                             return find_mappings(graphs, options);
+                         });
+}
 
-    if (product_graph.nodes.size() > 1000) {
-        std::cout << "Product graph too large (" << product_graph.nodes.size()
-                  << " nodes), using simplified heuristic\n";
-        return find_simple_mcis(graphs);
+std::expected<std::vector<MCISFinder::Mapping>, mcis::AlgorithmError>
+BronKerboschSerial::find_mappings(
+    const std::vector<const CompactGraph*>& graphs, const RunOptions& options) {
+    // Stop enumerating as soon as the product would pass the cutoff, before
+    // anything of its size is built
+    ScopedPhase filter_phase(options.metrics, "candidate_filter");
+    auto candidates = CandidateFilter(graphs, options.candidate_filter)
+                          .enumerate(BK_SERIAL_MAX_PRODUCT_NODES,
+                                     options.candidate_stats);
+    filter_phase.stop();
+    if (!candidates) {
+        std::vector<Mapping> simple = find_simple_mcis(graphs);
+        const size_t simple_size
+            = simple.empty() ? 0 : simple[0].size() / graphs.size();
+        size_t upper_bound = SIZE_MAX;
+        for (const auto* graph : graphs) {
+            upper_bound = std::min(upper_bound, size_t{graph->get_num_nodes()});
+        }
+        SearchControl(options, std::nullopt, upper_bound)
+            .finish(simple_size, false);
+        return simple;
     }
 
-    std::vector<std::set<ProductNode>> cliques
-        = find_maximal_cliques_with_timeout(product_graph, 5000);
+    ScopedPhase product_phase(options.metrics, "product_graph");
+    ProductGraph product_graph = build_product_graph(
+        graphs, std::move(*candidates), options.num_threads);
+    product_phase.stop();
 
-    std::vector<Graph*> mcis_results
-        = convert_cliques_to_subgraphs(cliques, graphs);
+    std::vector<std::set<ProductNode>> cliques
+        = find_maximal_cliques(product_graph, options);
 
-    return mcis_results;
+    ScopedPhase conversion_phase(options.metrics, "result_conversion");
+    return convert_cliques_to_mappings(cliques, graphs.size());
 }
 
 BronKerboschSerial::ProductGraph BronKerboschSerial::build_product_graph(
-    const std::vector<const Graph*>& graphs) {
+    const std::vector<const CompactGraph*>& graphs,
+    std::vector<CompactGraph::VertexId> candidates, int num_threads) {
     ProductGraph product_graph;
     if (graphs.empty()) {
         return product_graph;
     }
 
-    std::vector<std::vector<Node*>> nodes_per_graph;
-    for (const auto& graph : graphs) {
-        std::vector<Node*> nodes;
-        for (const auto& pair : graph->get_nodes()) {
-            nodes.push_back(pair.second);
-        }
-        nodes_per_graph.push_back(nodes);
+    // Evaluate the pairs on the bit matrix, then copy out the set form the
+    // search runs on
+    const DenseProductGraph dense = DenseProductGraph::build(
+        graphs, std::move(candidates), DenseProductGraph::Rule::UNDIRECTED,
+        num_threads);
+    const size_t k = graphs.size();
+    std::vector<ProductNode> nodes;
+    nodes.reserve(dense.num_vertices);
+    for (size_t p = 0; p < dense.num_vertices; ++p) {
+        const auto first = dense.tuples.begin() + p * k;
+        nodes.push_back(ProductNode{{first, first + k}});
+        product_graph.nodes.insert(product_graph.nodes.end(), nodes.back());
     }
-
-    std::function<void(int, std::vector<std::string>)> generate_product_nodes
-        = [&](int graph_idx, std::vector<std::string> current_combination) {
-              if (graph_idx == graphs.size()) {
-                  ProductNode new_node;
-                  new_node.node_ids = current_combination;
-                  product_graph.nodes.insert(new_node);
-                  return;
-              }
-
-              for (const auto& node : nodes_per_graph[graph_idx]) {
-                  std::vector<std::string> next_combination
-                      = current_combination;
-                  next_combination.push_back(node->get_id());
-                  generate_product_nodes(graph_idx + 1, next_combination);
-              }
-          };
-
-    generate_product_nodes(0, {});
-
-    // Create edges between compatible product nodes
-    for (const auto& node1 : product_graph.nodes) {
-        for (const auto& node2 : product_graph.nodes) {
-            if (node1 != node2
-                && are_product_nodes_adjacent(node1, node2, graphs)) {
-                product_graph.adjacency[node1].insert(node2);
-                product_graph.adjacency[node2].insert(node1);
-            }
+    for (size_t p = 0; p < dense.num_vertices; ++p) {
+        std::set<ProductNode> neighbors;
+        mcis::bitset::for_each_bit(
+            dense.row(p), dense.words_per_row, [&](size_t q) {
+                neighbors.insert(neighbors.end(), nodes[q]);
+            });
+        if (!neighbors.empty()) {
+            product_graph.adjacency.emplace(nodes[p], std::move(neighbors));
         }
     }
 
     return product_graph;
 }
 
-bool BronKerboschSerial::are_product_nodes_adjacent(
-    const ProductNode& p1, const ProductNode& p2,
-    const std::vector<const Graph*>& graphs) {
-    bool first_edge_in_g = false;
-    for (size_t i = 0; i < graphs.size(); ++i) {
-        Node* u = graphs[i]->get_node(p1.node_ids[i]);
-        Node* v = graphs[i]->get_node(p2.node_ids[i]);
-
-        if (!u || !v) {
-            return false;
-        }
-
-        bool edge_in_g = u->contains_edge(v) || v->contains_edge(u);
-        if (i == 0) {
-            first_edge_in_g = edge_in_g;
-        } else {
-            if (edge_in_g != first_edge_in_g) {
-                return false;
-            }
-        }
-    }
-
-    return true;
-}
-
 std::vector<std::set<BronKerboschSerial::ProductNode>>
-BronKerboschSerial::find_maximal_cliques_with_timeout(
-    const ProductGraph& product_graph, int timeout_ms) {
+BronKerboschSerial::find_maximal_cliques(const ProductGraph& product_graph,
+                                         const RunOptions& options) {
+    ScopedPhase search_phase(options.metrics, "search");
+    SearchControl control(options,
+                          std::chrono::milliseconds(BK_SERIAL_TIMEOUT_MS),
+                          product_graph.nodes.size());
+    MetricCounters counters;
     std::vector<std::set<ProductNode>> cliques;
     std::set<ProductNode> R;
     std::set<ProductNode> P = product_graph.nodes;
     std::set<ProductNode> X;
 
-    auto start_time = std::chrono::high_resolution_clock::now();
-
-    bron_kerbosch_recursive_with_timeout(R, P, X, product_graph, cliques,
-                                         start_time, timeout_ms);
+    uint64_t expansions = 0;
+    bron_kerbosch_recursive(R, P, X, product_graph, cliques, control,
+                            expansions, counters);
+    control.count(expansions);
+    counters.flush(control.metrics());
 
-    if (cliques.empty()) {
-        std::cout << "Timeout reached, returning simple fallback result\n";
-        if (!product_graph.nodes.empty()) {
-            std::set<ProductNode> simple_clique;
-            simple_clique.insert(*product_graph.nodes.begin());
-            cliques.push_back(simple_clique);
-        }
+    // Any single product node is a clique
+    if (cliques.empty() && !product_graph.nodes.empty()) {
+        cliques.push_back({*product_graph.nodes.begin()});
     }
+    size_t best_size = 0;
+    for (const auto& clique : cliques) {
+        best_size = std::max(best_size, clique.size());
+    }
+    // The size cap cuts the search short as well
+    control.finish(best_size, best_size <= BK_SERIAL_MAX_CLIQUE_SIZE);
 
     return cliques;
 }
 
-void BronKerboschSerial::bron_kerbosch_recursive_with_timeout(
+void BronKerboschSerial::bron_kerbosch_recursive(
     std::set<ProductNode> R, std::set<ProductNode> P, std::set<ProductNode> X,
     const ProductGraph& product_graph,
-    std::vector<std::set<ProductNode>>& cliques,
-    std::chrono::high_resolution_clock::time_point start_time, int timeout_ms) {
-    auto current_time = std::chrono::high_resolution_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        current_time - start_time);
-    if (elapsed.count() > timeout_ms) {
+    std::vector<std::set<ProductNode>>& cliques, SearchControl& control,
+    uint64_t& expansions, MetricCounters& counters) {
+    if (++expansions == SearchControl::CHECK_INTERVAL) {
+        expansions = 0;
+        control.check(SearchControl::CHECK_INTERVAL,
+                      cliques.empty() ? 0 : cliques[0].size());
+    }
+    if (control.stopped()) {
         return;
     }
 
-    if (!cliques.empty() && cliques[0].size() > 10) {
+    if (!cliques.empty() && cliques[0].size() > BK_SERIAL_MAX_CLIQUE_SIZE) {
+        counters.prune();
         return;
     }
+    counters.node(P.size());
 
     if (P.empty() && X.empty()) {
         if (!R.empty()) {
@@ -173,6 +219,7 @@ void BronKerboschSerial::bron_kerbosch_recursive_with_timeout(
     }
 
     ProductNode pivot = choose_pivot(P, X, product_graph);
+    counters.pivot();
 
     std::set<ProductNode> pivot_neighbors;
     auto it = product_graph.adjacency.find(pivot);
@@ -205,9 +252,10 @@ void BronKerboschSerial::bron_kerbosch_recursive_with_timeout(
         std::set_intersection(X.begin(), X.end(), v_neighbors.begin(),
                               v_neighbors.end(),
                               std::inserter(X_new, X_new.begin()));
+        counters.intersect(2);
 
-        bron_kerbosch_recursive_with_timeout(R_new, P_new, X_new, product_graph,
-                                             cliques, start_time, timeout_ms);
+        bron_kerbosch_recursive(R_new, P_new, X_new, product_graph, cliques,
+                                control, expansions, counters);
 
         P.erase(v);
         X.insert(v);
@@ -254,92 +302,46 @@ BronKerboschSerial::ProductNode BronKerboschSerial::choose_pivot(
     return best_pivot;
 }
 
-std::vector<Graph*> BronKerboschSerial::convert_cliques_to_subgraphs(
-    const std::vector<std::set<ProductNode>>& cliques,
-    const std::vector<const Graph*>& graphs) {
-    if (cliques.empty()) {
-        return {};
-    }
-
+std::vector<MCISFinder::Mapping>
+BronKerboschSerial::convert_cliques_to_mappings(
+    const std::vector<std::set<ProductNode>>& cliques, size_t num_graphs) {
     size_t max_size = 0;
     for (const auto& clique : cliques) {
         max_size = std::max(max_size, clique.size());
     }
 
-    std::vector<Graph*> results;
+    std::vector<Mapping> mappings;
     for (const auto& clique : cliques) {
-        if (clique.size() == max_size) {
-            Graph* mcis = create_subgraph_from_clique(clique, graphs);
-            if (mcis) {
-                results.push_back(mcis);
-            }
+        if (clique.size() == max_size && !clique.empty()) {
+            mappings.push_back(clique_to_mapping(clique, num_graphs));
         }
     }
 
-    return results;
+    return mappings;
 }
 
-Graph* BronKerboschSerial::create_subgraph_from_clique(
-    const std::set<ProductNode>& clique,
-    const std::vector<const Graph*>& graphs) {
-    if (clique.empty()) {
-        return nullptr;
-    }
-
-    Graph* subgraph = new Graph();
-    std::string new_id;
+MCISFinder::Mapping BronKerboschSerial::clique_to_mapping(
+    const std::set<ProductNode>& clique, size_t num_graphs) {
+    Mapping mapping(clique.size() * num_graphs);
+    size_t i = 0;
     for (const auto& prod_node : clique) {
-        new_id = "";
-        for (size_t i = 0; i < prod_node.node_ids.size(); ++i) {
-            new_id += prod_node.node_ids[i];
-            if (i < prod_node.node_ids.size() - 1) {
-                new_id += "_";
-            }
+        for (size_t g = 0; g < num_graphs; ++g) {
+            mapping[g * clique.size() + i] = prod_node.node_ids[g];
         }
-        subgraph->add_node(new_id);
+        ++i;
     }
-
-    for (const auto& prod_node1 : clique) {
-        for (const auto& prod_node2 : clique) {
-            if (prod_node1 != prod_node2) {
-                bool edge_exists_in_all = true;
-                for (size_t i = 0; i < graphs.size(); ++i) {
-                    Node* n1 = graphs[i]->get_node(prod_node1.node_ids[i]);
-                    Node* n2 = graphs[i]->get_node(prod_node2.node_ids[i]);
-                    if (!n1 || !n2 || !n1->contains_edge(n2)) {
-                        edge_exists_in_all = false;
-                        break;
-                    }
-                }
-
-                if (edge_exists_in_all) {
-                    std::string id1 = "", id2 = "";
-                    for (size_t i = 0; i < prod_node1.node_ids.size(); ++i) {
-                        id1 += prod_node1.node_ids[i];
-                        id2 += prod_node2.node_ids[i];
-                        if (i < prod_node1.node_ids.size() - 1) {
-                            id1 += "_";
-                            id2 += "_";
-                        }
-                    }
-                    subgraph->add_edge(id1, id2, 1);
-                }
-            }
-        }
-    }
-
-    return subgraph;
+    return mapping;
 }
 
 bool BronKerboschSerial::are_nodes_structurally_compatible(
-    const std::vector<Node*>& nodes) {
-    if (nodes.size() < 2) {
+    const std::vector<uint32_t>& degrees) {
+    if (degrees.size() < 2) {
         return true;
     }
 
-    int first_deg = nodes[0]->get_num_children() + nodes[0]->get_num_parents();
-    for (size_t i = 1; i < nodes.size(); ++i) {
-        int deg = nodes[i]->get_num_children() + nodes[i]->get_num_parents();
+    int first_deg = static_cast<int>(degrees[0]);
+    for (size_t i = 1; i < degrees.size(); ++i) {
+        int deg = static_cast<int>(degrees[i]);
         if (std::abs(first_deg - deg)
             > std::max(1, std::min(first_deg, deg) / 2)) {
             return false;
@@ -348,27 +350,36 @@ bool BronKerboschSerial::are_nodes_structurally_compatible(
     return true;
 }
 
-std::vector<Graph*> BronKerboschSerial::find_simple_mcis(
-    const std::vector<const Graph*>& graphs) {
-    Graph* result = new Graph();
-    int added_nodes = 0;
-    const int MAX_NODES = 10;
+std::vector<MCISFinder::Mapping> BronKerboschSerial::find_simple_mcis(
+    const std::vector<const CompactGraph*>& graphs) {
+    const size_t MAX_NODES = 10;
 
     if (graphs.empty()) {
         return {};
     }
 
-    const auto& first_graph_nodes = graphs[0]->get_nodes();
-    for (const auto& [id1, node1] : first_graph_nodes) {
-        if (added_nodes >= MAX_NODES) break;
+    auto total_degree = [](const CompactGraph* g, CompactGraph::VertexId v) {
+        return g->in_degree(v) + g->out_degree(v);
+    };
 
-        std::string result_id = id1;
+    // Tuples are collected one after another, then laid out by column
+    std::vector<CompactGraph::VertexId> tuples;
+    std::vector<CompactGraph::VertexId> tuple(graphs.size());
+    const CompactGraph* first_graph = graphs[0];
+    for (CompactGraph::VertexId v1 = 0; v1 < first_graph->get_num_nodes();
+         ++v1) {
+        if (tuples.size() / graphs.size() >= MAX_NODES) break;
+
+        tuple[0] = v1;
         bool compatible = true;
         for (size_t i = 1; i < graphs.size(); ++i) {
             bool found_compatible_node = false;
-            for (const auto& [id2, node2] : graphs[i]->get_nodes()) {
-                if (are_nodes_structurally_compatible({node1, node2})) {
-                    result_id += "_" + id2;
+            for (CompactGraph::VertexId v2 = 0; v2 < graphs[i]->get_num_nodes();
+                 ++v2) {
+                if (are_nodes_structurally_compatible(
+                        {total_degree(first_graph, v1),
+                         total_degree(graphs[i], v2)})) {
+                    tuple[i] = v2;
                     found_compatible_node = true;
                     break;
                 }
@@ -380,28 +391,19 @@ std::vector<Graph*> BronKerboschSerial::find_simple_mcis(
         }
 
         if (compatible) {
-            result->add_node(result_id);
-            added_nodes++;
+            tuples.insert(tuples.end(), tuple.begin(), tuple.end());
         }
     }
 
-    const auto& result_nodes = result->get_nodes();
-    for (const auto& [id1, n1] : result_nodes) {
-        for (const auto& [id2, n2] : result_nodes) {
-            if (id1 != id2 && result->get_num_nodes() < MAX_NODES) {
-                if (std::hash<std::string>{}(id1 + id2) % 4 == 0) {
-                    result->add_edge(id1, id2, 1);
-                }
-            }
-        }
+    if (tuples.empty()) {
+        return {};
     }
-
-    std::vector<Graph*> results;
-    if (result->get_num_nodes() > 0) {
-        results.push_back(result);
-    } else {
-        delete result;
+    const size_t size = tuples.size() / graphs.size();
+    Mapping mapping(tuples.size());
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t g = 0; g < graphs.size(); ++g) {
+            mapping[g * size + i] = tuples[i * graphs.size() + g];
+        }
     }
-
-    return results;
+    return {mapping};
 }
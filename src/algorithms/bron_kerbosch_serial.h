@@ -12,15 +12,33 @@
 #ifndef SRC_ALGORITHMS_BRON_KERBOSCH_SERIAL_H_
 #define SRC_ALGORITHMS_BRON_KERBOSCH_SERIAL_H_
 
-#include <chrono>
+#include <cstdint>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "./metrics_recorder.h"
+#include "./search_control.h"
 #include "mcis/graph.h"
 #include "mcis/mcis_finder.h"
 
+/**
+ * @brief Default time limit for one serial Bron-Kerbosch search in
+ * milliseconds, used when the run options set none.
+ */
+constexpr int BK_SERIAL_TIMEOUT_MS = 5000;
+
+/**
+ * @brief The search stops once it has found a clique larger than this.
+ */
+constexpr size_t BK_SERIAL_MAX_CLIQUE_SIZE = 10;
+
+/**
+ * @brief Larger product graphs fall back to a degree-matching heuristic.
+ */
+constexpr size_t BK_SERIAL_MAX_PRODUCT_NODES = 1000;
+
 /**
  * @class BronKerboschSerial
  *
@@ -33,10 +51,10 @@ class BronKerboschSerial : public MCISFinder {
     /**
      * @brief Represents a node in the product graph formed by N input graphs.
      * Each product node corresponds to a tuple of nodes, one from each input
-     * graph.
+     * graph, identified by their CompactGraph vertex IDs.
      */
     struct ProductNode {
-        std::vector<std::string> node_ids;
+        std::vector<CompactGraph::VertexId> node_ids;
 
         bool operator<(const ProductNode& other) const {
             return node_ids < other.node_ids;
@@ -58,9 +76,9 @@ class BronKerboschSerial : public MCISFinder {
     struct ProductNodeHash {
         std::size_t operator()(const ProductNode& pn) const {
             std::size_t seed = 0;
-            for (const auto& id : pn.node_ids) {
-                seed ^= std::hash<std::string>{}(id) + 0x9e3779b9 + (seed << 6)
-                        + (seed >> 2);
+            for (const auto id : pn.node_ids) {
+                seed ^= std::hash<CompactGraph::VertexId>{}(id) + 0x9e3779b9
+                        + (seed << 6) + (seed >> 2);
             }
             return seed;
         }
@@ -87,53 +105,125 @@ class BronKerboschSerial : public MCISFinder {
         const std::vector<const Graph*>& graphs,
         std::optional<std::string> tag) override;
 
- private:
     /**
-     * @brief Constructs the product graph from a set of input graphs.
+     * @brief Finds the MCIS between a set of frozen graphs using the
+     * Bron-Kerbosch algorithm.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds the MCIS between a set of graphs using the
+     * Bron-Kerbosch algorithm, pruning
+     * product tuples with the run options' candidate filter first.
      * @param graphs A vector of pointers to the input graphs.
-     * @return The product graph structure.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty.
      */
-    ProductGraph build_product_graph(const std::vector<const Graph*>& graphs);
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) override;
 
     /**
-     * @brief Determines if two product nodes should be adjacent in the product
-     * graph.
-     * @param p1 First product node.
-     * @param p2 Second product node.
+     * @brief Finds the MCIS between a set of frozen graphs using the
+     * Bron-Kerbosch algorithm,
+     * pruning product tuples with the run options' candidate filter first.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views. Views that leave
+     * out vertices are searched as materialized copies.
+     * @param views One view per input graph.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the found MCIS
+     * results, or an error if a view is empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views as owned
+     * mappings, without building any Graph.
+     * @param views One view per input graph.
+     * @param options Run options, as for find().
+     * @return The found results, or an error if a view is empty.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) override;
+
+ private:
+    /**
+     * @brief Runs the search on whole compact graphs.
+     * @param graphs A vector of pointers to the non-empty input graphs.
+     * @param options Run options, as for find().
+     * @return The mappings of the largest cliques found.
+     */
+    std::expected<std::vector<Mapping>, mcis::AlgorithmError> find_mappings(
+        const std::vector<const CompactGraph*>& graphs,
+        const RunOptions& options);
+
+    /**
+     * @brief Constructs the product graph from a set of input graphs.
      * @param graphs A vector of pointers to the input graphs.
-     * @return True if the product nodes should be adjacent.
+     * @param candidates Flattened tuples to use as product nodes, one entry
+     * per graph each, as produced by CandidateFilter.
+     * @param num_threads Threads for the pair loop (0 for the OpenMP
+     * default).
+     * @return The product graph structure.
      */
-    bool are_product_nodes_adjacent(const ProductNode& p1,
-                                    const ProductNode& p2,
-                                    const std::vector<const Graph*>& graphs);
+    ProductGraph build_product_graph(
+        const std::vector<const CompactGraph*>& graphs,
+        std::vector<CompactGraph::VertexId> candidates, int num_threads);
 
     /**
-     * @brief Finds all maximal cliques in the product graph using Bron-Kerbosch
-     * with timeout.
+     * @brief Finds the maximal cliques in the product graph using
+     * Bron-Kerbosch, until the search limits stop it.
      * @param product_graph The product graph to search.
-     * @param timeout_ms Maximum time to spend searching in milliseconds.
-     * @return Vector of cliques (each clique is a set of ProductNodes).
+     * @param options Run options; the limits, token, progress callback and
+     * report apply.
+     * @return Vector of cliques (each clique is a set of ProductNodes). A
+     * stopped search returns the cliques found so far, or a single product
+     * node if it found none.
      */
-    std::vector<std::set<ProductNode>> find_maximal_cliques_with_timeout(
-        const ProductGraph& product_graph, int timeout_ms);
+    std::vector<std::set<ProductNode>> find_maximal_cliques(
+        const ProductGraph& product_graph, const RunOptions& options);
 
     /**
-     * @brief Recursive implementation of the Bron-Kerbosch algorithm with
-     * timeout.
+     * @brief Recursive implementation of the Bron-Kerbosch algorithm.
      * @param R Current clique being built.
      * @param P Candidate nodes that can extend the clique.
      * @param X Already processed nodes.
      * @param product_graph The product graph being searched.
      * @param cliques Output vector to store found cliques.
-     * @param start_time Start time for timeout calculation.
-     * @param timeout_ms Timeout in milliseconds.
+     * @param control Limits of the search.
+     * @param expansions Expansions since the last check of the limits.
+     * @param counters Search counters of the run.
      */
-    void bron_kerbosch_recursive_with_timeout(
-        std::set<ProductNode> R, std::set<ProductNode> P,
-        std::set<ProductNode> X, const ProductGraph& product_graph,
-        std::vector<std::set<ProductNode>>& cliques,
-        std::chrono::high_resolution_clock::time_point start_time,
-        int timeout_ms);
+    void bron_kerbosch_recursive(std::set<ProductNode> R,
+                                 std::set<ProductNode> P,
+                                 std::set<ProductNode> X,
+                                 const ProductGraph& product_graph,
+                                 std::vector<std::set<ProductNode>>& cliques,
+                                 SearchControl& control,
+                                 uint64_t& expansions,
+                                 MetricCounters& counters);
 
     /**
      * @brief Chooses a pivot node to optimize the Bron-Kerbosch algorithm.
@@ -147,38 +237,38 @@ class BronKerboschSerial : public MCISFinder {
                              const ProductGraph& product_graph);
 
     /**
-     * @brief Converts maximal cliques to actual induced subgraphs.
+     * @brief Converts the largest of the maximal cliques to vertex mappings.
      * @param cliques The cliques found in the product graph.
-     * @param graphs A vector of pointers to the input graphs.
-     * @return Vector of MCIS graphs.
+     * @param num_graphs Number of input graphs.
+     * @return One mapping per largest clique.
      */
-    std::vector<Graph*> convert_cliques_to_subgraphs(
-        const std::vector<std::set<ProductNode>>& cliques,
-        const std::vector<const Graph*>& graphs);
+    std::vector<Mapping> convert_cliques_to_mappings(
+        const std::vector<std::set<ProductNode>>& cliques, size_t num_graphs);
 
     /**
-     * @brief Creates a subgraph from a single clique.
+     * @brief Lays out a single clique as a mapping, one column per graph.
      * @param clique The clique to convert.
-     * @param graphs A vector of pointers to the input graphs.
-     * @return Pointer to the created subgraph.
+     * @param num_graphs Number of input graphs.
+     * @return The mapping of the clique's product nodes.
      */
-    Graph* create_subgraph_from_clique(const std::set<ProductNode>& clique,
-                                       const std::vector<const Graph*>& graphs);
+    Mapping clique_to_mapping(const std::set<ProductNode>& clique,
+                              size_t num_graphs);
 
     /**
      * @brief Checks if a set of nodes are structurally compatible.
-     * @param nodes A vector of nodes to check.
+     * @param degrees Total (in + out) degree of each node to check.
      * @return True if nodes are compatible.
      */
-    bool are_nodes_structurally_compatible(const std::vector<Node*>& nodes);
+    bool are_nodes_structurally_compatible(
+        const std::vector<uint32_t>& degrees);
 
     /**
      * @brief Simple heuristic MCIS finder for large graphs.
      * @param graphs A vector of pointers to the input graphs.
-     * @return Vector of simple MCIS results.
+     * @return The heuristic mapping, or none if no vertex was matched.
      */
-    std::vector<Graph*> find_simple_mcis(
-        const std::vector<const Graph*>& graphs);
+    std::vector<Mapping> find_simple_mcis(
+        const std::vector<const CompactGraph*>& graphs);
 };
 
 #endif  // SRC_ALGORITHMS_BRON_KERBOSCH_SERIAL_H_
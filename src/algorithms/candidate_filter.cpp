@@ -0,0 +1,233 @@
+/**
+ * @file candidate_filter.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./candidate_filter.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Running extent of one feature over a tuple prefix.
+ */
+struct Range {
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+
+    Range with(uint32_t value) const {
+        return {std::min(min, value), std::max(max, value)};
+    }
+
+    bool within(uint32_t limit) const { return max - min <= limit; }
+};
+
+/**
+ * @brief Features shared by a tuple prefix, checked as each vertex is added.
+ */
+struct Prefix {
+    uint32_t tag = 0;
+    bool source = false;
+    bool sink = false;
+    Range in_degree;
+    Range out_degree;
+    Range level;
+};
+
+/**
+ * @brief Builds one tag view per graph, or full views when no tag is set.
+ */
+std::vector<GraphView> tag_views(const std::vector<const CompactGraph*>& graphs,
+                                 const std::optional<std::string>& tag) {
+    std::vector<GraphView> views;
+    views.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        if (tag) {
+            views.emplace_back(*graph, *tag);
+        } else {
+            views.emplace_back(*graph);
+        }
+    }
+    return views;
+}
+
+}  // namespace
+
+CandidateFilter::CandidateFilter(const std::vector<const CompactGraph*>& graphs,
+                                 const CandidateFilterOptions& options,
+                                 const std::optional<std::string>& tag)
+    : CandidateFilter(tag_views(graphs, tag), options) {}
+
+CandidateFilter::CandidateFilter(const std::vector<GraphView>& views,
+                                 const CandidateFilterOptions& options)
+    : options(options) {
+    // Tags are compared by name, so each graph's tag IDs are mapped to IDs
+    // shared by all graphs
+    std::unordered_map<std::string, uint32_t> tag_ids;
+    for (const auto& view : views) {
+        const CompactGraph& graph = view.graph();
+        vertices.emplace_back(view.vertices().begin(), view.vertices().end());
+        Features f;
+        if (options.match_tags) {
+            std::vector<uint32_t> shared;
+            for (const auto& tag : graph.get_tag_table()) {
+                shared.push_back(
+                    tag_ids.emplace(tag, static_cast<uint32_t>(tag_ids.size()))
+                        .first->second);
+            }
+            f.tags.resize(graph.get_num_nodes());
+            for (const auto v : view.vertices()) {
+                f.tags[v] = shared[graph.get_tag_id(v)];
+            }
+        }
+        if (options.match_sources_and_sinks || options.max_degree_difference) {
+            f.in_degrees.resize(graph.get_num_nodes());
+            f.out_degrees.resize(graph.get_num_nodes());
+            for (const auto v : view.vertices()) {
+                f.in_degrees[v] = view.in_degree(v);
+                f.out_degrees[v] = view.out_degree(v);
+            }
+        }
+        if (options.max_level_difference) {
+            f.levels = asap_levels(view);
+        }
+        features.push_back(std::move(f));
+    }
+}
+
+std::optional<std::vector<CompactGraph::VertexId>> CandidateFilter::enumerate(
+    size_t max_tuples, CandidateFilterStats* stats) const {
+    const size_t k = vertices.size();
+    CandidateFilterStats counts;
+    std::vector<CompactGraph::VertexId> tuples;
+    if (k == 0) {
+        if (stats) {
+            *stats = counts;
+        }
+        return tuples;
+    }
+
+    // below[g] is the number of tuples extending a prefix of length g + 1
+    std::vector<uint64_t> below(k, 1);
+    for (size_t g = k - 1; g-- > 0;) {
+        below[g] = below[g + 1] * vertices[g + 1].size();
+    }
+    counts.total = below[0] * vertices[0].size();
+
+    std::vector<Prefix> prefixes(k + 1);
+    std::vector<CompactGraph::VertexId> current(k, 0);
+    bool overflow = false;
+
+    auto recurse = [&](auto&& self, size_t g) -> void {
+        if (g == k) {
+            if (counts.kept == max_tuples) {
+                overflow = true;
+                return;
+            }
+            ++counts.kept;
+            tuples.insert(tuples.end(), current.begin(), current.end());
+            return;
+        }
+        const Features& f = features[g];
+        const Prefix& prefix = prefixes[g];
+        Prefix& next = prefixes[g + 1];
+        for (const auto v : vertices[g]) {
+            if (overflow) {
+                return;
+            }
+            if (options.match_tags) {
+                next.tag = f.tags[v];
+                if (g > 0 && next.tag != prefix.tag) {
+                    counts.pruned_by_tag += below[g];
+                    continue;
+                }
+            }
+            if (options.match_sources_and_sinks) {
+                next.source = f.in_degrees[v] == 0;
+                next.sink = f.out_degrees[v] == 0;
+                if (g > 0
+                    && (next.source != prefix.source
+                        || next.sink != prefix.sink)) {
+                    counts.pruned_by_source_sink += below[g];
+                    continue;
+                }
+            }
+            if (options.max_degree_difference) {
+                next.in_degree = prefix.in_degree.with(f.in_degrees[v]);
+                next.out_degree = prefix.out_degree.with(f.out_degrees[v]);
+                if (!next.in_degree.within(*options.max_degree_difference)
+                    || !next.out_degree.within(
+                        *options.max_degree_difference)) {
+                    counts.pruned_by_degree += below[g];
+                    continue;
+                }
+            }
+            if (options.max_level_difference) {
+                next.level = f.levels[v] == NO_LEVEL
+                                 ? prefix.level
+                                 : prefix.level.with(f.levels[v]);
+                if (next.level.min != UINT32_MAX
+                    && !next.level.within(*options.max_level_difference)) {
+                    counts.pruned_by_level += below[g];
+                    continue;
+                }
+            }
+            current[g] = v;
+            self(self, g + 1);
+        }
+    };
+    recurse(recurse, 0);
+
+    if (overflow) {
+        return std::nullopt;
+    }
+    if (stats) {
+        *stats = counts;
+    }
+    return tuples;
+}
+
+std::vector<uint32_t> CandidateFilter::asap_levels(const GraphView& view) {
+    const uint32_t n = view.graph().get_num_nodes();
+    std::vector<uint32_t> levels(n, NO_LEVEL);
+    std::vector<uint32_t> pending(n, 0);
+    std::vector<CompactGraph::VertexId> queue;
+    queue.reserve(view.get_num_nodes());
+    for (const auto v : view.vertices()) {
+        pending[v] = view.in_degree(v);
+        if (pending[v] == 0) {
+            levels[v] = 0;
+            queue.push_back(v);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const CompactGraph::VertexId u = queue[head];
+        view.for_each_out_neighbor(u, [&](CompactGraph::VertexId v) {
+            levels[v] = levels[v] == NO_LEVEL
+                            ? levels[u] + 1
+                            : std::max(levels[v], levels[u] + 1);
+            if (--pending[v] == 0) {
+                queue.push_back(v);
+            }
+        });
+    }
+    // Vertices left pending sit on or behind a cycle
+    for (const auto v : view.vertices()) {
+        if (pending[v] != 0) {
+            levels[v] = NO_LEVEL;
+        }
+    }
+    return levels;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file candidate_filter.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_CANDIDATE_FILTER_H_
+#define SRC_ALGORITHMS_CANDIDATE_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+#include "mcis/graph_view.h"
+#include "mcis/run_options.h"
+
+/**
+ * @class CandidateFilter
+ * @brief Enumerates the product tuples (v_0, ..., v_{N-1}) that pass a set of
+ * CandidateFilterOptions rules. Per-vertex features are computed once, and
+ * tuples are built one graph at a time so a prefix that already breaks a
+ * rule drops every tuple extending it without visiting them.
+ */
+class CandidateFilter {
+ public:
+    /**
+     * @brief Computes the vertex features the enabled rules need, within
+     * each view's induced subgraph.
+     * @param views One view per input graph; tuples hold parent vertex IDs.
+     * @param options The rules to apply.
+     */
+    CandidateFilter(const std::vector<GraphView>& views,
+                    const CandidateFilterOptions& options);
+
+    /**
+     * @brief Computes the vertex features the enabled rules need.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param options The rules to apply.
+     * @param tag If set, only vertices carrying this tag form tuples; the
+     * others are left out of the counts entirely.
+     */
+    CandidateFilter(const std::vector<const CompactGraph*>& graphs,
+                    const CandidateFilterOptions& options,
+                    const std::optional<std::string>& tag = std::nullopt);
+
+    /**
+     * @brief Enumerates the kept tuples in lexicographic order.
+     * @param max_tuples Largest number of tuples the caller accepts.
+     * @param stats If set, receives the kept and dropped counts.
+     * @return Flattened tuples, one entry per graph for each kept tuple, or
+     * std::nullopt if more than max_tuples would be kept (stats are then
+     * left untouched).
+     */
+    std::optional<std::vector<CompactGraph::VertexId>> enumerate(
+        size_t max_tuples, CandidateFilterStats* stats) const;
+
+    /**
+     * @brief Marks a vertex whose ASAP level is undefined because it lies on
+     * or downstream of a cycle.
+     */
+    static constexpr uint32_t NO_LEVEL = UINT32_MAX;
+
+    /**
+     * @brief Computes the ASAP level of every vertex of a view, the length
+     * of the longest path reaching it from a source of the view.
+     * @param view The induced subgraph to level.
+     * @return One level per parent vertex, NO_LEVEL for vertices outside
+     * the view or never reached by Kahn's algorithm.
+     */
+    static std::vector<uint32_t> asap_levels(const GraphView& view);
+
+ private:
+    struct Features {
+        std::vector<uint32_t> tags;
+        std::vector<uint32_t> in_degrees;
+        std::vector<uint32_t> out_degrees;
+        std::vector<uint32_t> levels;
+    };
+
+    std::vector<std::vector<CompactGraph::VertexId>> vertices;
+    std::vector<Features> features;
+    CandidateFilterOptions options;
+};
+
+#endif  // SRC_ALGORITHMS_CANDIDATE_FILTER_H_
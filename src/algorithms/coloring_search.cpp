@@ -0,0 +1,181 @@
+/**
+ * @file coloring_search.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./coloring_search.h"
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+#include "./bitset_ops.h"
+
+CliqueIncumbent::CliqueIncumbent(std::vector<uint32_t> initial,
+                                 SearchControl& control)
+    : best_size(initial.size()), best(std::move(initial)), control(control) {}
+
+void CliqueIncumbent::offer(const std::vector<uint32_t>& clique) {
+    if (clique.size() <= size()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (clique.size() > best.size()) {
+        best = clique;
+        best_size.store(clique.size(), std::memory_order_relaxed);
+    }
+}
+
+ColoringSearch::ColoringSearch(const DenseProductGraph& product_graph,
+                               CliqueIncumbent& incumbent,
+                               const ProductSymmetry* symmetry)
+    : graph(product_graph),
+      words(product_graph.words_per_row),
+      incumbent(incumbent),
+      symmetry(symmetry),
+      uncolored(product_graph.words_per_row, 0),
+      color_class(product_graph.words_per_row, 0) {}
+
+void ColoringSearch::search(const std::vector<uint32_t>& prefix,
+                            const uint64_t* candidates, bool closed) {
+    R = prefix;
+    closed_root = closed;
+    Level& root = level(0);
+    std::copy(candidates, candidates + words, root.P.begin());
+    expand(0);
+}
+
+void ColoringSearch::flush() {
+    incumbent.count(pending_expansions);
+    pending_expansions = 0;
+    counters.flush(incumbent.metrics());
+}
+
+ColoringSearch::Level& ColoringSearch::level(size_t depth) {
+    while (levels.size() <= depth) {
+        levels.push_back({std::vector<uint64_t>(words, 0), {}, {}, {}, false});
+    }
+    return levels[depth];
+}
+
+bool ColoringSearch::out_of_time() {
+    if (++pending_expansions == SearchControl::CHECK_INTERVAL) {
+        pending_expansions = 0;
+        return incumbent.check_limits(SearchControl::CHECK_INTERVAL);
+    }
+    return incumbent.stopped();
+}
+
+void ColoringSearch::find_orbits(size_t depth) {
+    Level& lvl = levels[depth];
+    lvl.symmetric = false;
+    if (symmetry == nullptr || lvl.order.empty()
+        || R.size() >= SYMMETRY_BREAKING_MAX_DEPTH) {
+        return;
+    }
+    // Candidates stay closed under the stabilizer only while every
+    // ancestor removed whole orbits of the full stabilizer
+    const bool closed
+        = depth == 0 ? closed_root
+                     : levels[depth - 1].symmetric
+                           && levels[depth - 1].orbits.complete();
+    if (closed) {
+        symmetry->orbits(R, lvl.P.data(), lvl.orbits);
+        lvl.symmetric = !lvl.orbits.trivial();
+    }
+}
+
+void ColoringSearch::color(const uint64_t* candidates, size_t min_color,
+                           std::vector<uint32_t>& order,
+                           std::vector<uint32_t>& colors) {
+    order.clear();
+    colors.clear();
+    std::copy(candidates, candidates + words, uncolored.begin());
+
+    uint32_t k = 0;
+    size_t first_word = 0;
+    while (true) {
+        while (first_word < words && uncolored[first_word] == 0) {
+            ++first_word;
+        }
+        if (first_word == words) {
+            break;
+        }
+        ++k;
+        std::copy(uncolored.begin() + first_word, uncolored.end(),
+                  color_class.begin() + first_word);
+        for (size_t w = first_word; w < words; ++w) {
+            while (color_class[w] != 0) {
+                const size_t v = w * mcis::bitset::WORD_BITS
+                                 + static_cast<size_t>(
+                                     std::countr_zero(color_class[w]));
+                mcis::bitset::reset(uncolored.data(), v);
+                mcis::bitset::reset(color_class.data(), v);
+                // v's neighbours cannot share its color
+                mcis::bitset::and_not_into(color_class.data() + w,
+                                           color_class.data() + w,
+                                           graph.row(v) + w, words - w);
+                if (k >= min_color) {
+                    order.push_back(static_cast<uint32_t>(v));
+                    colors.push_back(k);
+                }
+            }
+        }
+    }
+}
+
+void ColoringSearch::expand(size_t depth) {
+    if (out_of_time()) {
+        return;
+    }
+
+    Level& lvl = levels[depth];
+    const size_t best = incumbent.size();
+    color(lvl.P.data(), best >= R.size() ? best - R.size() + 1 : 0,
+          lvl.order, lvl.colors);
+    counters.node(lvl.order.size());
+    find_orbits(depth);
+
+    Level& next = level(depth + 1);
+    for (size_t i = lvl.order.size(); i-- > 0;) {
+        if (incumbent.stopped()) {
+            return;
+        }
+        const uint32_t v = lvl.order[i];
+        if (lvl.symmetric && !mcis::bitset::test(lvl.P.data(), v)) {
+            // Left with the orbit of an earlier branch
+            continue;
+        }
+        if (R.size() + lvl.colors[i] <= incumbent.size()) {
+            // Colors only decrease along the order, so the rest fail too
+            counters.prune(i + 1);
+            return;
+        }
+        if (R.empty()) {
+            // Every root branch after this one is finished, and none of the
+            // rest can use more than colors[i] vertices
+            incumbent.bound(std::max<size_t>(incumbent.size(), lvl.colors[i]));
+        }
+        mcis::bitset::and_into(next.P.data(), lvl.P.data(), graph.row(v),
+                               words);
+        counters.intersect();
+        R.push_back(v);
+        if (mcis::bitset::any(next.P.data(), words)) {
+            expand(depth + 1);
+        } else {
+            incumbent.offer(R);
+        }
+        R.pop_back();
+        if (lvl.symmetric) {
+            counters.prune(lvl.orbits.remove_orbit(v, lvl.P.data()));
+        } else {
+            mcis::bitset::reset(lvl.P.data(), v);
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file coloring_search.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_COLORING_SEARCH_H_
+#define SRC_ALGORITHMS_COLORING_SEARCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "./metrics_recorder.h"
+#include "./product_orbits.h"
+#include "./search_control.h"
+#include "mcis/dense_product_graph.h"
+
+/**
+ * @class CliqueIncumbent
+ * @brief Best clique found so far and the search control, shared by every
+ * worker of a (possibly parallel) maximum clique search. The incumbent size
+ * is an atomic so workers can prune against it without locking; only
+ * improvements take the mutex.
+ */
+class CliqueIncumbent {
+ public:
+    CliqueIncumbent(std::vector<uint32_t> initial, SearchControl& control);
+
+    size_t size() const { return best_size.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Replaces the incumbent if the clique is strictly larger.
+     */
+    void offer(const std::vector<uint32_t>& clique);
+
+    /**
+     * @brief Counts a worker's expansions and checks the search limits.
+     * @param expansions Expansions since the worker's last check.
+     * @return True if the search should stop.
+     */
+    bool check_limits(uint64_t expansions) {
+        return control.check(expansions, size());
+    }
+
+    /**
+     * @brief Counts a worker's last expansions without checking limits.
+     */
+    void count(uint64_t expansions) { control.count(expansions); }
+
+    bool stopped() const { return control.stopped(); }
+
+    SearchMetrics* metrics() const { return control.metrics(); }
+
+    /**
+     * @brief Lowers the upper bound on the maximum clique size.
+     */
+    void bound(size_t upper_bound) { control.bound(upper_bound); }
+
+    /**
+     * @brief Moves the best clique out and reports the outcome; call after
+     * all workers finished.
+     */
+    std::vector<uint32_t> take() {
+        control.finish(best.size(), true);
+        return std::move(best);
+    }
+
+ private:
+    std::atomic<size_t> best_size;
+    std::mutex mutex;
+    std::vector<uint32_t> best;
+    SearchControl& control;
+};
+
+/**
+ * @class ColoringSearch
+ * @brief Bitset branch-and-bound with greedy coloring bounds (MCQ/BBMC
+ * style). Each recursion depth owns a preallocated candidate row and its
+ * colored vertex order, so the search allocates only when it first reaches a
+ * new depth. One instance must only be used by one thread at a time.
+ *
+ * Given the product's symmetries, nodes up to SYMMETRY_BREAKING_MAX_DEPTH
+ * drop the whole orbit of each finished branch (under the stabilizer of the
+ * node's prefix) from their candidates.
+ */
+class ColoringSearch {
+ public:
+    ColoringSearch(const DenseProductGraph& product_graph,
+                   CliqueIncumbent& incumbent,
+                   const ProductSymmetry* symmetry = nullptr);
+
+    /**
+     * @brief Searches every clique extending a prefix.
+     * @param prefix A clique of the product graph.
+     * @param candidates Vertices adjacent to every prefix vertex that may
+     * still be added (one row of words_per_row words).
+     * @param closed Whether the candidates are closed under the product
+     * automorphisms fixing the prefix, which lets the search break
+     * symmetry; see ProductSymmetry.
+     */
+    void search(const std::vector<uint32_t>& prefix,
+                const uint64_t* candidates, bool closed = false);
+
+    /**
+     * @brief Adds the expansions not yet counted by a check of the limits
+     * to the search total, and the worker's counters to the run's metrics.
+     * Expansions carry over between searches, so short searches still
+     * reach a check.
+     */
+    void flush();
+
+    /**
+     * @brief Greedily partitions the candidates into independent color
+     * classes, lowest index first. Vertices whose color is below min_color
+     * are left out of the order.
+     * @param candidates Row of candidate vertices.
+     * @param min_color Smallest color worth reporting.
+     * @param order Receives the colored vertices in non-decreasing color.
+     * @param colors Receives the color of each vertex of order.
+     */
+    void color(const uint64_t* candidates, size_t min_color,
+               std::vector<uint32_t>& order, std::vector<uint32_t>& colors);
+
+ private:
+    struct Level {
+        std::vector<uint64_t> P;
+        std::vector<uint32_t> order;
+        std::vector<uint32_t> colors;
+        // Orbits of P under the prefix stabilizer, if P is closed under it
+        // and they split
+        ProductOrbits orbits;
+        bool symmetric = false;
+    };
+
+    const DenseProductGraph& graph;
+    const size_t words;
+    CliqueIncumbent& incumbent;
+    const ProductSymmetry* symmetry;
+    bool closed_root = false;
+
+    // A deque keeps references to existing levels valid while it grows
+    std::deque<Level> levels;
+    std::vector<uint64_t> uncolored;
+    std::vector<uint64_t> color_class;
+    std::vector<uint32_t> R;
+    uint64_t pending_expansions = 0;
+    MetricCounters counters;
+
+    Level& level(size_t depth);
+    bool out_of_time();
+    void find_orbits(size_t depth);
+    void expand(size_t depth);
+};
+
+#endif  // SRC_ALGORITHMS_COLORING_SEARCH_H_
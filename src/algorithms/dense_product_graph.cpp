@@ -0,0 +1,307 @@
+/**
+ * @file dense_product_graph.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/dense_product_graph.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "./bitset_ops.h"
+#include "./candidate_filter.h"
+
+namespace {
+
+// Graphs up to this many vertices get a dense |V|x|V| relation table
+constexpr uint32_t DENSE_RELATION_MAX_NODES = 4096;
+
+/**
+ * @brief Directed edge relation between two vertices of one graph:
+ * bit 0 is set for u -> v, bit 1 for v -> u.
+ */
+class EdgeRelation {
+ public:
+    explicit EdgeRelation(const CompactGraph* graph) : graph(graph) {
+        const uint32_t n = graph->get_num_nodes();
+        if (n <= DENSE_RELATION_MAX_NODES) {
+            table.assign(static_cast<size_t>(n) * n, 0);
+            for (CompactGraph::VertexId u = 0; u < n; ++u) {
+                for (const auto v : graph->out_neighbors(u)) {
+                    table[static_cast<size_t>(u) * n + v] |= 1;
+                    table[static_cast<size_t>(v) * n + u] |= 2;
+                }
+            }
+        }
+    }
+
+    uint8_t operator()(CompactGraph::VertexId u,
+                       CompactGraph::VertexId v) const {
+        if (!table.empty()) {
+            return table[static_cast<size_t>(u) * graph->get_num_nodes() + v];
+        }
+        return static_cast<uint8_t>((graph->has_edge(u, v) ? 1 : 0)
+                                    | (graph->has_edge(v, u) ? 2 : 0));
+    }
+
+ private:
+    const CompactGraph* graph;
+    std::vector<uint8_t> table;
+};
+
+/**
+ * @brief Checks whether two tuples are adjacent under a product rule.
+ */
+template <DenseProductGraph::Rule rule>
+bool adjacent(const CompactGraph::VertexId* tp,
+              const CompactGraph::VertexId* tq,
+              const std::vector<EdgeRelation>& relations) {
+    const size_t k = relations.size();
+    if constexpr (rule == DenseProductGraph::Rule::MODULAR) {
+        if (tp[0] == tq[0]) {
+            return false;
+        }
+        const uint8_t rel = relations[0](tp[0], tq[0]);
+        for (size_t i = 1; i < k; ++i) {
+            if (tp[i] == tq[i] || relations[i](tp[i], tq[i]) != rel) {
+                return false;
+            }
+        }
+    } else {
+        const bool edge = relations[0](tp[0], tq[0]) != 0;
+        for (size_t i = 1; i < k; ++i) {
+            if ((relations[i](tp[i], tq[i]) != 0) != edge) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Sets the upper triangle of the adjacency, evaluating every
+ * unordered pair once. Each block of rows goes to one thread, which writes
+ * only those rows; rows are shorter further down, so blocks are handed out
+ * dynamically.
+ */
+template <DenseProductGraph::Rule rule>
+void fill_upper_triangle(DenseProductGraph& product,
+                         const std::vector<EdgeRelation>& relations,
+                         int num_threads) {
+    const size_t n = product.num_vertices;
+    const size_t k = product.num_graphs;
+    const size_t words = product.words_per_row;
+    const size_t blocks = mcis::bitset::words_for(n);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (size_t block = 0; block < blocks; ++block) {
+        const size_t end = std::min(n, (block + 1) * mcis::bitset::WORD_BITS);
+        for (size_t p = block * mcis::bitset::WORD_BITS; p < end; ++p) {
+            const CompactGraph::VertexId* tp = &product.tuples[p * k];
+            uint64_t* row_p = product.adjacency.data() + p * words;
+            for (size_t q = p + 1; q < n; ++q) {
+                if (adjacent<rule>(tp, &product.tuples[q * k], relations)) {
+                    mcis::bitset::set(row_p, q);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Copies the upper triangle into the lower one. Destination rows
+ * 64b..64b+63 belong to one thread, which gathers word b of each 64-row
+ * block above them, transposes it and ORs it in, so no row is written by
+ * two threads and no word is read while another thread writes it.
+ */
+void mirror_upper_triangle(DenseProductGraph& product, int num_threads) {
+    const size_t n = product.num_vertices;
+    const size_t words = product.words_per_row;
+    constexpr size_t W = mcis::bitset::WORD_BITS;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (size_t b = 0; b < words; ++b) {
+        uint64_t block[W];
+        for (size_t a = 0; a <= b; ++a) {
+            for (size_t i = 0; i < W; ++i) {
+                const size_t p = a * W + i;
+                block[i] = p < n ? product.adjacency[p * words + b] : 0;
+            }
+            mcis::bitset::transpose_64x64(block);
+            for (size_t j = 0; j < W && b * W + j < n; ++j) {
+                product.adjacency[(b * W + j) * words + a] |= block[j];
+            }
+        }
+    }
+}
+
+}  // namespace
+
+size_t DenseProductGraph::adjacency_bytes(size_t num_vertices) {
+    return num_vertices * mcis::bitset::words_for(num_vertices)
+           * sizeof(uint64_t);
+}
+
+size_t DenseProductGraph::max_vertices(size_t max_adjacency_bytes) {
+    // adjacency_bytes(n) is about n^2 / 8, so start just above the root
+    size_t n = static_cast<size_t>(
+                   std::sqrt(static_cast<double>(max_adjacency_bytes) * 8))
+               + 64;
+    while (n > 0 && adjacency_bytes(n) > max_adjacency_bytes) {
+        --n;
+    }
+    return n;
+}
+
+std::expected<DenseProductGraph, mcis::AlgorithmError> DenseProductGraph::build(
+    const std::vector<const CompactGraph*>& graphs,
+    const CandidateFilterOptions& filter, size_t max_adjacency_bytes,
+    CandidateFilterStats* stats, int num_threads) {
+    std::vector<GraphView> views;
+    views.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        views.emplace_back(*graph);
+    }
+    return build(views, filter, max_adjacency_bytes, stats, num_threads);
+}
+
+std::expected<DenseProductGraph, mcis::AlgorithmError> DenseProductGraph::build(
+    const std::vector<GraphView>& views, const CandidateFilterOptions& filter,
+    size_t max_adjacency_bytes, CandidateFilterStats* stats, int num_threads) {
+    auto tuples = CandidateFilter(views, filter)
+                      .enumerate(max_vertices(max_adjacency_bytes), stats);
+    if (!tuples) {
+        return std::unexpected(mcis::AlgorithmError::PRODUCT_GRAPH_TOO_LARGE);
+    }
+    // Views are induced subgraphs, so relations between their vertices are
+    // read straight from the parent graphs
+    std::vector<const CompactGraph*> graphs;
+    graphs.reserve(views.size());
+    for (const auto& view : views) {
+        graphs.push_back(&view.graph());
+    }
+    return build(graphs, std::move(*tuples), Rule::MODULAR, num_threads);
+}
+
+DenseProductGraph DenseProductGraph::build(
+    const std::vector<const CompactGraph*>& graphs,
+    std::vector<CompactGraph::VertexId> tuples, Rule rule, int num_threads) {
+    DenseProductGraph product;
+    const size_t k = graphs.size();
+    product.num_graphs = k;
+    product.num_vertices = k == 0 ? 0 : tuples.size() / k;
+    product.words_per_row = mcis::bitset::words_for(product.num_vertices);
+    product.tuples = std::move(tuples);
+    if (product.num_vertices == 0) {
+        return product;
+    }
+
+    std::vector<EdgeRelation> relations;
+    relations.reserve(k);
+    for (const auto& graph : graphs) {
+        relations.emplace_back(graph);
+    }
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+
+    product.adjacency.assign(product.num_vertices * product.words_per_row, 0);
+    if (rule == Rule::MODULAR) {
+        fill_upper_triangle<Rule::MODULAR>(product, relations, num_threads);
+    } else {
+        fill_upper_triangle<Rule::UNDIRECTED>(product, relations, num_threads);
+    }
+    mirror_upper_triangle(product, num_threads);
+
+    return product;
+}
+
+std::vector<uint32_t> DenseProductGraph::greedy_clique() const {
+    std::vector<uint64_t> P(words_per_row, 0);
+    for (size_t v = 0; v < num_vertices; ++v) {
+        mcis::bitset::set(P.data(), v);
+    }
+    std::vector<uint32_t> clique;
+    while (mcis::bitset::any(P.data(), words_per_row)) {
+        size_t best = 0;
+        size_t best_degree = 0;
+        bool found = false;
+        mcis::bitset::for_each_bit(P.data(), words_per_row, [&](size_t u) {
+            size_t degree
+                = mcis::bitset::and_count(P.data(), row(u), words_per_row);
+            if (!found || degree > best_degree) {
+                best = u;
+                best_degree = degree;
+                found = true;
+            }
+        });
+        clique.push_back(static_cast<uint32_t>(best));
+        mcis::bitset::and_into(P.data(), P.data(), row(best), words_per_row);
+    }
+    return clique;
+}
+
+DenseProductGraph DenseProductGraph::reordered(
+    const std::vector<uint32_t>& order) const {
+    DenseProductGraph product;
+    product.num_graphs = num_graphs;
+    product.num_vertices = num_vertices;
+    product.words_per_row = words_per_row;
+    product.tuples.resize(tuples.size());
+    product.adjacency.assign(adjacency.size(), 0);
+
+    std::vector<uint32_t> position(num_vertices);
+    for (size_t i = 0; i < num_vertices; ++i) {
+        position[order[i]] = static_cast<uint32_t>(i);
+    }
+    for (size_t i = 0; i < num_vertices; ++i) {
+        const uint32_t old = order[i];
+        for (size_t g = 0; g < num_graphs; ++g) {
+            product.tuples[i * num_graphs + g] = component(old, g);
+        }
+        uint64_t* new_row = product.adjacency.data() + i * words_per_row;
+        mcis::bitset::for_each_bit(row(old), words_per_row, [&](size_t q) {
+            mcis::bitset::set(new_row, position[q]);
+        });
+    }
+    return product;
+}
+
+DenseProductGraph DenseProductGraph::degree_ordered() const {
+    std::vector<uint32_t> degrees(num_vertices);
+    for (size_t v = 0; v < num_vertices; ++v) {
+        degrees[v] = static_cast<uint32_t>(
+            mcis::bitset::count(row(v), words_per_row));
+    }
+    std::vector<uint32_t> order(num_vertices);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return degrees[a] > degrees[b];
+    });
+    return reordered(order);
+}
+
+MCISResult DenseProductGraph::clique_to_result(
+    const std::vector<uint32_t>& clique,
+    const std::vector<const CompactGraph*>& graphs) const {
+    std::vector<CompactGraph> inputs;
+    inputs.reserve(num_graphs);
+    std::vector<CompactGraph::VertexId> mapping(clique.size() * num_graphs);
+    for (size_t g = 0; g < num_graphs; ++g) {
+        inputs.push_back(*graphs[g]);
+        for (size_t i = 0; i < clique.size(); ++i) {
+            mapping[g * clique.size() + i] = component(clique[i], g);
+        }
+    }
+    return MCISResult(std::move(inputs), std::move(mapping));
+}
@@ -13,14 +13,33 @@
 
 #include <algorithm>
 #include <functional>
-#include <map>
+#include <optional>
 #include <queue>
 #include <string>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "./bitset_ops.h"
+#include "./candidate_filter.h"
+#include "./metrics_recorder.h"
+#include "./search_control.h"
+#include "mcis/dense_product_graph.h"
+#include "mcis/reachability_index.h"
+
 std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
     const std::vector<const Graph*>& graphs, std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
+    const std::vector<const CompactGraph*>& graphs,
+    std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
+    const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+    const RunOptions& options) {
     if (graphs.empty()) {
         return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
     }
@@ -30,190 +49,307 @@ std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
         }
     }
 
-    EdgeSet F;
-    std::vector<std::vector<Node*>> nodes_per_graph;
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    std::vector<const CompactGraph*> compact_ptrs;
+    compact_ptrs.reserve(graphs.size());
     for (const auto& graph : graphs) {
-        std::vector<Node*> nodes;
-        for (const auto& pair : graph->get_nodes()) {
-            if (!tag || (tag && pair.second->get_tag() == *tag)) {
-                nodes.push_back(pair.second);
-            }
-        }
-        nodes_per_graph.push_back(nodes);
+        compact_graphs.push_back(graph->freeze());
+        compact_ptrs.push_back(&compact_graphs.back());
     }
+    return find(compact_ptrs, tag, options);
+}
 
-    std::function<void(int, std::vector<std::string>)> generate_hyperedges
-        = [&](int graph_idx, std::vector<std::string> current_combination) {
-              if (graph_idx == graphs.size()) {
-                  F.insert({current_combination});
-                  return;
-              }
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
+    const std::vector<const CompactGraph*>& graphs,
+    std::optional<std::string> tag, const RunOptions& options) {
+    auto mappings = find_mappings(graphs, tag, options);
+    if (!mappings) {
+        return std::unexpected(mappings.error());
+    }
+    std::vector<CompactGraph> inputs;
+    inputs.reserve(graphs.size());
+    for (const auto* graph : graphs) {
+        inputs.push_back(*graph);
+    }
+    std::vector<MCISResult> results;
+    for (auto& mapping : *mappings) {
+        results.emplace_back(inputs, std::move(mapping));
+    }
+    return to_graphs(results);
+}
 
-              for (const auto& node : nodes_per_graph[graph_idx]) {
-                  std::vector<std::string> next_combination
-                      = current_combination;
-                  next_combination.push_back(node->get_id());
-                  generate_hyperedges(graph_idx + 1, next_combination);
-              }
-          };
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> KPT::find(
+    const std::vector<GraphView>& views, const RunOptions& options) {
+    return to_graphs(find_results(views, options));
+}
 
-    generate_hyperedges(0, {});
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+KPT::find_results(const std::vector<GraphView>& views,
+                  const RunOptions& options) {
+    return find_on_views(views,
+                         [&](const std::vector<const CompactGraph*>& graphs) {
+                             return find_mappings(graphs, std::nullopt,
+                                                  options);
+                         });
+}
 
-    WeightMap w;
-    for (const auto& edge : F) {
-        w[edge] = 1.0;
+std::expected<std::vector<MCISFinder::Mapping>, mcis::AlgorithmError>
+KPT::find_mappings(const std::vector<const CompactGraph*>& graphs,
+                   const std::optional<std::string>& tag,
+                   const RunOptions& options) {
+    if (graphs.empty()) {
+        return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+    }
+    for (const auto& graph : graphs) {
+        if (graph->get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
     }
 
-    EdgeSet matching = kPCM_Match(F, w, graphs);
+    // Generated in lexicographic order, so F is sorted
+    // Conflict rows have the same shape as product graph adjacency rows
+    const size_t max_hyperedges
+        = DenseProductGraph::max_vertices(KPT_MAX_CONFLICT_BYTES);
+    ScopedPhase filter_phase(options.metrics, "candidate_filter");
+    auto candidates = CandidateFilter(graphs, options.candidate_filter, tag)
+                          .enumerate(max_hyperedges, options.candidate_stats);
+    filter_phase.stop();
+    if (!candidates) {
+        return std::unexpected(mcis::AlgorithmError::PRODUCT_GRAPH_TOO_LARGE);
+    }
+    const size_t k = graphs.size();
+    std::vector<Hyperedge> F;
+    F.reserve(candidates->size() / k);
+    for (size_t i = 0; i < candidates->size(); i += k) {
+        F.push_back(Hyperedge{
+            {candidates->begin() + i, candidates->begin() + i + k}});
+    }
 
-    Graph* result_graph = new Graph();
-    for (const auto& hyperedge : matching) {
-        std::string node_id = "";
-        for (size_t i = 0; i < hyperedge.node_ids.size(); ++i) {
-            node_id += hyperedge.node_ids[i]
-                       + (i == hyperedge.node_ids.size() - 1 ? "" : "_");
+    // The matching uses each vertex of the smallest graph at most once
+    size_t upper_bound = F.size();
+    for (const auto& graph : graphs) {
+        upper_bound = std::min<size_t>(upper_bound, graph->get_num_nodes());
+    }
+    SearchControl control(options, std::nullopt, upper_bound);
+    std::vector<uint32_t> matching
+        = kPCM_Match(F, std::vector<double>(F.size(), 1.0), graphs, control);
+    control.finish(matching.size(), false);
+
+    ScopedPhase conversion_phase(options.metrics, "result_conversion");
+    if (matching.empty()) {
+        return std::vector<Mapping>{};
+    }
+    Mapping mapping(matching.size() * k);
+    for (size_t i = 0; i < matching.size(); ++i) {
+        const Hyperedge& hyperedge = F[matching[i]];
+        for (size_t g = 0; g < k; ++g) {
+            mapping[g * matching.size() + i] = hyperedge.node_ids[g];
         }
-        result_graph->add_node(node_id);
     }
+    return std::vector<Mapping>{std::move(mapping)};
+}
 
-    std::vector<Graph*> results;
-    results.push_back(result_graph);
+std::vector<uint64_t> KPT::build_conflicts(
+    const std::vector<Hyperedge>& F,
+    const std::vector<const CompactGraph*>& graphs, SearchMetrics* metrics) {
+    ScopedPhase phase(metrics, "conflicts");
+    MetricCounters counters;
+    const size_t n = F.size();
+    const size_t words = mcis::bitset::words_for(n);
+    std::vector<uint64_t> conflicts(n * words, 0);
+    std::vector<uint64_t> masks;
+
+    for (size_t g = 0; g < graphs.size(); ++g) {
+        // masks row a holds every hyperedge whose vertex in graph g is
+        // related to a (equal to it, or connected to it by a path)
+        const uint32_t num_nodes = graphs[g]->get_num_nodes();
+        masks.assign(static_cast<size_t>(num_nodes) * words, 0);
+        std::vector<std::vector<CompactGraph::VertexId>> related_to(
+            num_nodes);
+        for (size_t j = 0; j < n; ++j) {
+            const CompactGraph::VertexId b = F[j].node_ids[g];
+            // b is related to itself, so an empty list is not computed yet
+            if (related_to[b].empty()) {
+                counters.conflict_check(num_nodes);
+                for (CompactGraph::VertexId a = 0; a < num_nodes; ++a) {
+                    if (is_reachable(graphs[g], a, b)
+                        || is_reachable(graphs[g], b, a)) {
+                        related_to[b].push_back(a);
+                    }
+                }
+            }
+            for (const auto a : related_to[b]) {
+                mcis::bitset::set(masks.data() + a * words, j);
+            }
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t* row = conflicts.data() + i * words;
+            const uint64_t* mask = masks.data() + F[i].node_ids[g] * words;
+            for (size_t w = 0; w < words; ++w) {
+                row[w] |= mask[w];
+            }
+        }
+    }
 
-    return results;
+    // Self-conflicts are handled by the callers
+    for (size_t i = 0; i < n; ++i) {
+        mcis::bitset::reset(conflicts.data() + i * words, i);
+    }
+    counters.flush(metrics);
+    return conflicts;
 }
 
-KPT::EdgeSet KPT::kPCM_Match(EdgeSet F, WeightMap w,
-                             const std::vector<const Graph*>& graphs) {
-    if (F.empty()) {
+std::vector<uint32_t> KPT::kPCM_Match(
+    const std::vector<Hyperedge>& F, std::vector<double> w,
+    const std::vector<const CompactGraph*>& graphs, SearchControl& control) {
+    const size_t n = F.size();
+    if (n == 0) {
         return {};
     }
 
-    // 1. Compute optimal fractional solution x
-    // Placeholder: assign uniform fractional values
-    std::map<Hyperedge, double> x;
-    double total_weight = 0;
-    for (const auto& edge : F) total_weight += w[edge];
-    if (total_weight == 0) return {};
-
-    for (const auto& edge : F) {
-        x[edge] = w[edge] / total_weight;
+    const size_t words = mcis::bitset::words_for(n);
+    const std::vector<uint64_t> conflicts
+        = build_conflicts(F, graphs, control.metrics());
+    ScopedPhase phase(control.metrics(), "matching");
+    auto neighbors = [&](size_t i) { return conflicts.data() + i * words; };
+
+    // sums[i] is the weight of i plus that of every live hyperedge
+    // conflicting with it
+    double total = 0;
+    std::vector<double> sums(w);
+    for (size_t i = 0; i < n; ++i) {
+        total += w[i];
+        mcis::bitset::for_each_bit(neighbors(i), words,
+                                   [&](size_t j) { sums[j] += w[i]; });
     }
 
-    // 3. Handle Zero-Value Edges
-    EdgeSet F_nonzero;
-    for (const auto& e : F) {
-        if (x[e] > 1e-9) {  // Use a small epsilon for floating point comparison
-            F_nonzero.insert(e);
-        }
+    // Weights only decrease, so a min-heap with lazy deletion finds the
+    // hyperedges whose fractional value drops to zero
+    using Entry = std::pair<double, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (size_t i = 0; i < n; ++i) {
+        heap.push({w[i], static_cast<uint32_t>(i)});
     }
-
-    if (F_nonzero.size() < F.size()) {
-        return kPCM_Match(F_nonzero, w, graphs);
+    std::vector<uint64_t> live(words, 0);
+    for (size_t i = 0; i < n; ++i) {
+        mcis::bitset::set(live.data(), i);
     }
+    size_t live_count = n;
+    size_t first_live = 0;
 
-    // 4. Find Low-Conflict Edge
-    // Placeholder for alpha
-    double alpha = 2.0 * graphs.size();
-
-    Hyperedge selected_edge;
-    bool found_low_conflict_edge = false;
-
-    for (const auto& e : F) {
-        double conflict_sum = 0;
-        for (const auto& q : F) {
-            if (are_conflicting(e, q, graphs)) {
-                conflict_sum += x[q];
+    // Lowers one hyperedge, updating the sums of its conflicts
+    auto lower = [&](size_t i, double amount) {
+        if (amount == 0) {
+            return;
+        }
+        w[i] -= amount;
+        total -= amount;
+        sums[i] -= amount;
+        mcis::bitset::for_each_bit(neighbors(i), words,
+                                   [&](size_t j) { sums[j] -= amount; });
+    };
+
+    // alpha bounds the conflict sum of the selected hyperedge
+    const double alpha = 2.0 * graphs.size();
+    std::vector<uint32_t> selected;
+    std::vector<uint32_t> dropped;
+    std::vector<uint64_t> full_step(words);
+    std::vector<uint64_t> step(words);
+
+    // A step costs O(|F|) word operations, so checking the limits on every
+    // step is cheap by comparison
+    while (live_count > 0 && total > 0
+           && !control.check(1, selected.size())) {
+        // Drop hyperedges with zero fractional value until none is left
+        while (true) {
+            const double threshold = 1e-9 * total;
+            dropped.clear();
+            while (!heap.empty() && heap.top().first <= threshold) {
+                const auto [weight, i] = heap.top();
+                heap.pop();
+                if (mcis::bitset::test(live.data(), i) && w[i] == weight) {
+                    dropped.push_back(i);
+                }
+            }
+            if (dropped.empty()) {
+                break;
+            }
+            for (const auto i : dropped) {
+                mcis::bitset::reset(live.data(), i);
+                --live_count;
+                lower(i, w[i]);
             }
         }
-        if (conflict_sum <= alpha) {
-            selected_edge = e;
-            found_low_conflict_edge = true;
+        if (live_count == 0 || total <= 0) {
             break;
         }
-    }
 
-    if (!found_low_conflict_edge) {
-        // Fallback: if no such edge is found (should not happen based on
-        // theory) To prevent infinite recursion, we can just pick one edge.
-        if (!F.empty()) {
-            selected_edge = *F.begin();
-        } else {
-            return {};
+        // Find a low-conflict hyperedge, scanning in index order
+        while (!mcis::bitset::test(live.data(), first_live)) {
+            ++first_live;
         }
-    }
-
-    // 5. Perform Local Ratio Step
-    WeightMap w_hat;
-    double w_e = w[selected_edge];
-    for (const auto& f : F) {
-        if (are_conflicting(selected_edge, f, graphs)) {
-            w_hat[f] = std::min(w[f], w_e);
-        } else {
-            w_hat[f] = 0.0;
+        size_t e = first_live;
+        for (size_t i = first_live; i < n; ++i) {
+            if (mcis::bitset::test(live.data(), i)
+                && sums[i] <= alpha * total) {
+                e = i;
+                break;
+            }
         }
-    }
 
-    WeightMap w_new;
-    for (const auto& f : F) {
-        w_new[f] = w[f] - w_hat[f];
-    }
-
-    EdgeSet M_prime = kPCM_Match(F, w_new, graphs);
-
-    // 6. Update Matching
-    bool conflicts_with_M_prime = false;
-    for (const auto& m_edge : M_prime) {
-        if (are_conflicting(selected_edge, m_edge, graphs)) {
-            conflicts_with_M_prime = true;
-            break;
+        // Local ratio step: subtract w_e from e and every live hyperedge it
+        // conflicts with, capped at each weight. The uncapped ones all lose
+        // exactly w_e, so their effect on a sum is w_e times a popcount.
+        const double w_e = w[e];
+        std::fill(full_step.begin(), full_step.end(), 0);
+        bool any_full = false;
+        auto subtract = [&](size_t f) {
+            if (w[f] >= w_e) {
+                w[f] -= w_e;
+                total -= w_e;
+                mcis::bitset::set(full_step.data(), f);
+                any_full = true;
+            } else {
+                lower(f, w[f]);
+            }
+            heap.push({w[f], static_cast<uint32_t>(f)});
+        };
+        subtract(e);
+        mcis::bitset::and_into(step.data(), neighbors(e), live.data(), words);
+        mcis::bitset::for_each_bit(step.data(), words, subtract);
+        if (any_full) {
+            mcis::bitset::for_each_bit(live.data(), words, [&](size_t j) {
+                const size_t hits
+                    = mcis::bitset::and_count(neighbors(j), full_step.data(),
+                                              words)
+                      + (mcis::bitset::test(full_step.data(), j) ? 1 : 0);
+                sums[j] -= w_e * static_cast<double>(hits);
+            });
         }
+        selected.push_back(static_cast<uint32_t>(e));
     }
 
-    if (!conflicts_with_M_prime) {
-        M_prime.insert(selected_edge);
-        return M_prime;
-    } else {
-        return M_prime;
-    }
-}
-
-bool KPT::are_conflicting(const Hyperedge& p1, const Hyperedge& p2,
-                          const std::vector<const Graph*>& graphs) {
-    if (p1 == p2) return true;
-    for (size_t i = 0; i < graphs.size(); ++i) {
-        if (is_reachable(graphs[i], p1.node_ids[i], p2.node_ids[i])
-            || is_reachable(graphs[i], p2.node_ids[i], p1.node_ids[i])) {
-            return true;
+    // Unwind: later selections win, earlier ones are added if they do not
+    // conflict with anything already in the matching
+    std::vector<uint32_t> matching;
+    std::vector<bool> blocked(n, false);
+    for (size_t k = selected.size(); k-- > 0;) {
+        const uint32_t e = selected[k];
+        if (blocked[e]) {
+            continue;
         }
+        matching.push_back(e);
+        blocked[e] = true;
+        mcis::bitset::for_each_bit(neighbors(e), words,
+                                   [&](size_t j) { blocked[j] = true; });
     }
-    return false;
+    std::sort(matching.begin(), matching.end());
+    return matching;
 }
 
-bool KPT::is_reachable(const Graph* g, const std::string& start_node_id,
-                       const std::string& end_node_id) {
-    if (start_node_id == end_node_id) return true;
-
-    std::queue<std::string> q;
-    q.push(start_node_id);
-    std::unordered_set<std::string> visited;
-    visited.insert(start_node_id);
-
-    while (!q.empty()) {
-        std::string u_id = q.front();
-        q.pop();
-
-        Node* u_node = g->get_node(u_id);
-        if (!u_node) continue;
-
-        for (const auto& edge : u_node->get_children()) {
-            Node* v_node = edge.first;
-            std::string v_id = v_node->get_id();
-            if (v_id == end_node_id) return true;
-            if (visited.find(v_id) == visited.end()) {
-                visited.insert(v_id);
-                q.push(v_id);
-            }
-        }
-    }
-    return false;
+bool KPT::is_reachable(const CompactGraph* g, CompactGraph::VertexId start_node,
+                       CompactGraph::VertexId end_node) {
+    return g->reachability().reachable(start_node, end_node);
 }
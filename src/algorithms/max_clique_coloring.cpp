@@ -0,0 +1,130 @@
+/**
+ * @file max_clique_coloring.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./max_clique_coloring.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./bitset_ops.h"
+#include "./coloring_search.h"
+#include "./metrics_recorder.h"
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MaxCliqueColoring::find(const std::vector<const Graph*>& graphs,
+                        std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MaxCliqueColoring::find(const std::vector<const CompactGraph*>& graphs,
+                        std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MaxCliqueColoring::find(const std::vector<const Graph*>& graphs,
+                        std::optional<std::string> tag,
+                        const RunOptions& options) {
+    for (const auto& graph : graphs) {
+        if (graph->get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+    }
+
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    std::vector<const CompactGraph*> compact_ptrs;
+    compact_ptrs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        compact_graphs.push_back(graph->freeze());
+        compact_ptrs.push_back(&compact_graphs.back());
+    }
+    return find(compact_ptrs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MaxCliqueColoring::find(const std::vector<const CompactGraph*>& graphs,
+                        std::optional<std::string> tag,
+                        const RunOptions& options) {
+    return find(views_of(graphs, tag), options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MaxCliqueColoring::find(const std::vector<GraphView>& views,
+                        const RunOptions& options) {
+    return to_graphs(find_results(views, options));
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+MaxCliqueColoring::find_results(const std::vector<GraphView>& views,
+                                const RunOptions& options) {
+    if (views.empty()) {
+        return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+    }
+    std::vector<const CompactGraph*> graphs;
+    graphs.reserve(views.size());
+    for (const auto& view : views) {
+        if (view.get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+        graphs.push_back(&view.graph());
+    }
+
+    ScopedPhase product_phase(options.metrics, "product_graph");
+    auto built = DenseProductGraph::build(views, options.candidate_filter,
+                                          MAX_CLIQUE_MAX_ADJACENCY_BYTES,
+                                          options.candidate_stats,
+                                          options.num_threads);
+    if (!built) {
+        return std::unexpected(built.error());
+    }
+    const DenseProductGraph product_graph = built->degree_ordered();
+    // Free the unordered copy before searching
+    *built = DenseProductGraph();
+    product_phase.stop();
+
+    std::optional<ProductSymmetry> symmetry;
+    if (options.symmetry_breaking) {
+        ScopedPhase symmetry_phase(options.metrics, "symmetry");
+        symmetry = ProductSymmetry::build(product_graph, views);
+    }
+
+    std::vector<uint32_t> clique = find_maximum_clique(
+        product_graph, options, symmetry ? &*symmetry : nullptr);
+
+    ScopedPhase conversion_phase(options.metrics, "result_conversion");
+    std::vector<MCISResult> results;
+    if (!clique.empty()) {
+        results.push_back(product_graph.clique_to_result(clique, graphs));
+    }
+    return results;
+}
+
+std::vector<uint32_t> MaxCliqueColoring::find_maximum_clique(
+    const DenseProductGraph& product_graph, const RunOptions& options,
+    const ProductSymmetry* symmetry) {
+    ScopedPhase search_phase(options.metrics, "search");
+    SearchControl control(options,
+                          std::chrono::milliseconds(MAX_CLIQUE_TIMEOUT_MS),
+                          product_graph.num_vertices);
+    CliqueIncumbent incumbent(product_graph.greedy_clique(), control);
+    std::vector<uint64_t> candidates(product_graph.words_per_row, 0);
+    for (size_t v = 0; v < product_graph.num_vertices; ++v) {
+        mcis::bitset::set(candidates.data(), v);
+    }
+    ColoringSearch search(product_graph, incumbent, symmetry);
+    search.search({}, candidates.data(), true);
+    search.flush();
+    return incumbent.take();
+}
@@ -0,0 +1,149 @@
+/**
+ * @file max_clique_coloring.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_MAX_CLIQUE_COLORING_H_
+#define SRC_ALGORITHMS_MAX_CLIQUE_COLORING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./product_orbits.h"
+#include "mcis/dense_product_graph.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_finder.h"
+
+/**
+ * @brief Default time limit for one maximum clique search in milliseconds,
+ * used when the run options set none. On timeout the best clique found so
+ * far is returned.
+ */
+constexpr int MAX_CLIQUE_TIMEOUT_MS = 5000;
+
+/**
+ * @brief Largest product graph adjacency (in bytes) the finder will build.
+ * Renumbering keeps two copies alive, so this is half of the bitset
+ * Bron-Kerbosch limit.
+ */
+constexpr size_t MAX_CLIQUE_MAX_ADJACENCY_BYTES = size_t{1} << 30;
+
+/**
+ * @class MaxCliqueColoring
+ *
+ * Implements a branch-and-bound maximum clique search (MCQ/BBMC style) over
+ * the dense modular product graph. Product vertices are renumbered by
+ * non-increasing degree, and at every node of the search the candidate set is
+ * greedily colored with bitset color classes: a vertex of color k can extend
+ * the current clique by at most k vertices, so branches whose color bound
+ * cannot beat the incumbent are cut, and vertices below that bound are never
+ * branched on at all. Only a single maximum clique is searched for, instead
+ * of enumerating every maximal clique.
+ */
+class MaxCliqueColoring : public MCISFinder {
+ public:
+    /**
+     * @brief Finds an MCIS between a set of graphs using coloring
+     * branch-and-bound.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds an MCIS between a set of frozen graphs using coloring
+     * branch-and-bound.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty or the product graph
+     * does not fit in MAX_CLIQUE_MAX_ADJACENCY_BYTES.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds the MCIS between a set of graphs using coloring
+     * branch-and-bound, pruning
+     * product tuples with the run options' candidate filter first.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between a set of frozen graphs using coloring
+     * branch-and-bound,
+     * pruning product tuples with the run options' candidate filter first.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty or the product graph
+     * does not fit in MAX_CLIQUE_MAX_ADJACENCY_BYTES.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views without copying
+     * them; product tuples hold parent vertex IDs.
+     * @param views One view per input graph.
+     * @param options Run options; candidate_filter and candidate_stats apply.
+     * @return A vector of pointers to Graph objects representing the MCIS
+     * found, or an error if a view is empty or the product graph is too
+     * large.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views as owned
+     * mappings, without building any Graph.
+     * @param views One view per input graph.
+     * @param options Run options, as for find().
+     * @return The found results, or an error if a view is empty.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) override;
+
+ protected:
+    /**
+     * @brief Searches for a maximum clique of a product graph. The product
+     * graph build, symmetry and result conversion around it are shared with
+     * subclasses, which override only this search.
+     * @param product_graph The product graph to search, renumbered by
+     * non-increasing degree.
+     * @param options Run options; the limits, token, progress callback and
+     * report apply.
+     * @param symmetry If set, the product symmetries used to skip
+     * symmetric branches.
+     * @return The largest clique found.
+     */
+    virtual std::vector<uint32_t> find_maximum_clique(
+        const DenseProductGraph& product_graph, const RunOptions& options,
+        const ProductSymmetry* symmetry);
+};
+
+#endif  // SRC_ALGORITHMS_MAX_CLIQUE_COLORING_H_
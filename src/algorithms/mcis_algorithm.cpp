@@ -11,15 +11,201 @@
 
 #include "mcis/mcis_algorithm.h"
 
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "./bron_kerbosch_bitset.h"
 #include "./bron_kerbosch_serial.h"
+#include "./max_clique_coloring.h"
+#include "./mcsplit.h"
+#include "./parallel_max_clique.h"
 #include "mcis/algorithms/kpt.h"
+#include "mcis/graph_view.h"
+
+namespace {
+
+std::vector<CompactGraph> freeze_all(const std::vector<const Graph*>& graphs) {
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        compact_graphs.push_back(graph->freeze());
+    }
+    return compact_graphs;
+}
+
+std::vector<const CompactGraph*> pointers_to(
+    const std::vector<CompactGraph>& graphs) {
+    std::vector<const CompactGraph*> ptrs;
+    ptrs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        ptrs.push_back(&graph);
+    }
+    return ptrs;
+}
+
+std::vector<GraphView> tag_views(const std::vector<const CompactGraph*>& graphs,
+                                 const std::string& tag) {
+    std::vector<GraphView> views;
+    views.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        views.emplace_back(*graph, tag);
+    }
+    return views;
+}
+
+/**
+ * @brief FNV-1a over 64-bit words, used to key cached and folded results.
+ */
+class CacheKey {
+ public:
+    CacheKey& add(uint64_t word) {
+        hash = (hash ^ word) * 0x100000001b3;
+        return *this;
+    }
+
+    CacheKey& add(std::string_view text) {
+        return add(std::hash<std::string_view>{}(text));
+    }
+
+    uint64_t value() const { return hash; }
+
+ private:
+    uint64_t hash = 0xcbf29ce484222325;
+};
+
+// One refinement round is enough to tell graphs with node IDs apart
+uint64_t graph_key(const CompactGraph& graph) {
+    return graph.structural_hash(true, 1);
+}
+
+uint64_t inputs_key(const std::vector<const CompactGraph*>& graphs,
+                    const std::optional<std::string>& tag) {
+    CacheKey key;
+    key.add(graphs.size()).add(tag.has_value()).add(tag.value_or(""));
+    for (const auto* graph : graphs) {
+        key.add(graph_key(*graph));
+    }
+    return key.value();
+}
+
+uint64_t filter_key(AlgorithmType type, const RunOptions& options) {
+    const CandidateFilterOptions& filter = options.candidate_filter;
+    CacheKey key;
+    key.add(static_cast<uint64_t>(type))
+        .add(filter.match_tags)
+        .add(filter.match_sources_and_sinks)
+        .add(filter.max_degree_difference.value_or(UINT32_MAX) + uint64_t{1})
+        .add(filter.max_level_difference.value_or(UINT32_MAX) + uint64_t{1});
+    if (type == AlgorithmType::MCSPLIT) {
+        key.add(options.mcsplit.connected)
+            .add(options.mcsplit.directed)
+            .add(options.mcsplit.match_tags);
+    }
+    return key.value();
+}
+
+/**
+ * @brief A graph taking part in a fold: an input or a cached intermediate.
+ */
+struct FoldOperand {
+    const CompactGraph* graph = nullptr;
+    uint64_t key = 0;
+    std::shared_ptr<const CompactGraph> owned;
+};
+
+void add_stats(CandidateFilterStats& total, const CandidateFilterStats& more) {
+    total.total += more.total;
+    total.kept += more.kept;
+    total.pruned_by_tag += more.pruned_by_tag;
+    total.pruned_by_source_sink += more.pruned_by_source_sink;
+    total.pruned_by_degree += more.pruned_by_degree;
+    total.pruned_by_level += more.pruned_by_level;
+}
+
+uint64_t run_key(AlgorithmType type, const RunOptions& options,
+                 uint64_t inputs) {
+    return CacheKey().add(filter_key(type, options)).add(inputs).value();
+}
+
+std::string cache_path(const std::string& directory, uint64_t key,
+                       const std::string& suffix) {
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016" PRIx64, key);
+    return (std::filesystem::path(directory) / (name + suffix)).string();
+}
+
+// The count file is written last, so an interrupted save reads as a miss
+std::optional<std::vector<CompactGraph>> load_cached_results(
+    const std::string& directory, uint64_t key, size_t& best_size,
+    size_t& upper_bound) {
+    // Entries written without the sizes may hold stopped searches
+    std::ifstream count_file(cache_path(directory, key, ".count"));
+    size_t count;
+    if (!(count_file >> count >> best_size >> upper_bound)) {
+        return std::nullopt;
+    }
+    std::vector<CompactGraph> results;
+    results.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto graph = CompactGraph::load_binary(
+            cache_path(directory, key, "_" + std::to_string(i) + ".mcsr"));
+        if (!graph) {
+            return std::nullopt;
+        }
+        results.push_back(std::move(*graph));
+    }
+    return results;
+}
+
+// Estimated relative cost of a batch job: the size of its product graph
+double job_cost(const BatchJob& job) {
+    double cost = 1.0;
+    for (const auto* graph : job.graphs) {
+        cost *= static_cast<double>(graph->get_num_nodes());
+    }
+    return cost;
+}
+
+void save_cached_results(const std::string& directory, uint64_t key,
+                         const std::vector<CompactGraph>& results,
+                         size_t best_size, size_t upper_bound) {
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].save_binary(cache_path(
+                directory, key, "_" + std::to_string(i) + ".mcsr"))) {
+            return;
+        }
+    }
+    std::ofstream count_file(cache_path(directory, key, ".count"));
+    count_file << results.size() << ' ' << best_size << ' ' << upper_bound
+               << '\n';
+}
+
+}  // namespace
 
 MCISAlgorithm::MCISAlgorithm() {
     algorithms.push_back(new BronKerboschSerial());
     algorithms.push_back(new KPT());
+    algorithms.push_back(new BronKerboschBitset());
+    algorithms.push_back(new MaxCliqueColoring());
+    algorithms.push_back(new ParallelMaxClique());
+    algorithms.push_back(new McSplit());
 }
 
 MCISAlgorithm::~MCISAlgorithm() {
@@ -30,54 +216,464 @@ MCISAlgorithm::~MCISAlgorithm() {
 
 std::expected<std::vector<Graph*>, mcis::AlgorithmError> MCISAlgorithm::run(
     const std::vector<const Graph*>& graphs, AlgorithmType type,
-    std::optional<std::string> tag) {
+    std::optional<std::string> tag, const RunOptions& options) {
+    if (tag || result_cache_enabled) {
+        // Freeze once and filter through views rather than copying
+        // subgraphs; the cache keys on the snapshots too
+        std::vector<CompactGraph> compact_graphs = freeze_all(graphs);
+        return run(pointers_to(compact_graphs), type, std::move(tag), options);
+    }
+    return algorithms[static_cast<int>(type)]->find(graphs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> MCISAlgorithm::run(
+    std::initializer_list<const Graph*> graphs, AlgorithmType type,
+    std::optional<std::string> tag, const RunOptions& options) {
+    return run(std::vector<const Graph*>(graphs), type, std::move(tag),
+               options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> MCISAlgorithm::run(
+    const std::vector<const CompactGraph*>& graphs, AlgorithmType type,
+    std::optional<std::string> tag, const RunOptions& options) {
+    MCISFinder* finder = algorithms[static_cast<int>(type)];
+    auto find = [&](const RunOptions& searched) {
+        return tag ? finder->find(tag_views(graphs, *tag), searched)
+                   : finder->find(graphs, tag, searched);
+    };
+    if (!result_cache_enabled) {
+        return find(options);
+    }
+    return cached_find(run_key(type, options, inputs_key(graphs, tag)),
+                       options, find);
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+MCISAlgorithm::run_results(const std::vector<const Graph*>& graphs,
+                           AlgorithmType type, std::optional<std::string> tag,
+                           const RunOptions& options) {
+    std::vector<CompactGraph> compact_graphs = freeze_all(graphs);
+    return run_results(pointers_to(compact_graphs), type, std::move(tag),
+                       options);
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+MCISAlgorithm::run_results(std::initializer_list<const Graph*> graphs,
+                           AlgorithmType type, std::optional<std::string> tag,
+                           const RunOptions& options) {
+    return run_results(std::vector<const Graph*>(graphs), type,
+                       std::move(tag), options);
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+MCISAlgorithm::run_results(const std::vector<const CompactGraph*>& graphs,
+                           AlgorithmType type, std::optional<std::string> tag,
+                           const RunOptions& options) {
+    std::vector<GraphView> views;
     if (tag) {
-        std::vector<Graph> subgraphs;
-        subgraphs.reserve(graphs.size());
-        std::vector<const Graph*> subgraph_ptrs;
-        subgraph_ptrs.reserve(graphs.size());
-        for (const auto& graph : graphs) {
-            subgraphs.push_back(graph->get_subgraph_with_tag(*tag));
-            subgraph_ptrs.push_back(&subgraphs.back());
-        }
-        return algorithms[static_cast<int>(type)]->find(subgraph_ptrs, tag);
+        views = tag_views(graphs, *tag);
     } else {
-        return algorithms[static_cast<int>(type)]->find(graphs, tag);
+        views.reserve(graphs.size());
+        for (const auto* graph : graphs) {
+            views.emplace_back(*graph);
+        }
     }
+    return algorithms[static_cast<int>(type)]->find_results(views, options);
 }
 
 template <typename T>
     requires std::is_base_of_v<MCISFinder, T>
 std::expected<std::vector<Graph*>, mcis::AlgorithmError> MCISAlgorithm::run(
     const std::vector<const Graph*>& graphs, T* algorithm,
-    std::optional<std::string> tag) {
+    std::optional<std::string> tag, const RunOptions& options) {
+    // Call through the base class so finders that only override the
+    // two-argument find do not hide the overload taking options
+    MCISFinder* finder = algorithm;
     if (tag) {
-        std::vector<Graph> subgraphs;
-        subgraphs.reserve(graphs.size());
-        std::vector<const Graph*> subgraph_ptrs;
-        subgraph_ptrs.reserve(graphs.size());
-        for (const auto& graph : graphs) {
-            subgraphs.push_back(graph->get_subgraph_with_tag(*tag));
-            subgraph_ptrs.push_back(&subgraphs.back());
-        }
-        return algorithm->find(subgraph_ptrs, tag);
+        std::vector<CompactGraph> compact_graphs = freeze_all(graphs);
+        return finder->find(tag_views(pointers_to(compact_graphs), *tag),
+                            options);
+    }
+    return finder->find(graphs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MCISAlgorithm::run_folded(const std::vector<const Graph*>& graphs,
+                          AlgorithmType type, std::optional<std::string> tag,
+                          const RunOptions& options) {
+    std::vector<CompactGraph> compact_graphs = freeze_all(graphs);
+    return run_folded(pointers_to(compact_graphs), type, std::move(tag),
+                      options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MCISAlgorithm::run_folded(std::initializer_list<const Graph*> graphs,
+                          AlgorithmType type, std::optional<std::string> tag,
+                          const RunOptions& options) {
+    return run_folded(std::vector<const Graph*>(graphs), type, std::move(tag),
+                      options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError>
+MCISAlgorithm::run_folded(const std::vector<const CompactGraph*>& graphs,
+                          AlgorithmType type, std::optional<std::string> tag,
+                          const RunOptions& options) {
+    if (graphs.size() <= 2) {
+        return run(graphs, type, std::move(tag), options);
+    }
+    MCISFinder* finder = algorithms[static_cast<int>(type)];
+    const uint64_t rules = filter_key(type, options);
+
+    // Tagged inputs are filtered up front, so the folds themselves are
+    // untagged runs on the materialized subgraphs
+    std::vector<CompactGraph> filtered;
+    if (tag) {
+        filtered.reserve(graphs.size());
+        for (const auto& view : tag_views(graphs, *tag)) {
+            filtered.push_back(view.materialize());
+        }
+    }
+    std::vector<FoldOperand> round;
+    round.reserve(graphs.size());
+    for (size_t i = 0; i < graphs.size(); ++i) {
+        const CompactGraph* graph = tag ? &filtered[i] : graphs[i];
+        if (graph->get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+        round.push_back({graph, graph_key(*graph), nullptr});
+    }
+    // Smallest first keeps the intermediates small, and a fixed order
+    // makes the same inputs fold through the same cached pairs
+    std::ranges::sort(round, [](const FoldOperand& a, const FoldOperand& b) {
+        const auto size_a = std::pair{a.graph->get_num_nodes(),
+                                      a.graph->get_num_edges()};
+        const auto size_b = std::pair{b.graph->get_num_nodes(),
+                                      b.graph->get_num_edges()};
+        return size_a != size_b ? size_a < size_b : a.key < b.key;
+    });
+
+    const int num_threads
+        = options.num_threads > 0 ? options.num_threads : omp_get_max_threads();
+    CandidateFilterStats total_stats;
+    while (round.size() > 1) {
+        const auto num_pairs = static_cast<int64_t>(round.size() / 2);
+        std::vector<FoldOperand> next(round.size() - num_pairs);
+        std::vector<std::optional<mcis::AlgorithmError>> errors(num_pairs);
+        std::vector<CandidateFilterStats> stats(num_pairs);
+#pragma omp parallel for schedule(dynamic) if (num_pairs > 1) \
+    num_threads(std::min<int64_t>(num_pairs, num_threads))
+        for (int64_t p = 0; p < num_pairs; ++p) {
+            const FoldOperand& left = round[2 * p];
+            const FoldOperand& right = round[2 * p + 1];
+            FoldOperand& folded = next[p];
+            folded.key
+                = CacheKey().add(rules).add(left.key).add(right.key).value();
+            {
+                std::lock_guard lock(fold_cache_mutex);
+                auto cached = fold_cache.find(folded.key);
+                if (cached != fold_cache.end()) {
+                    folded.owned = cached->second;
+                }
+            }
+            if (!folded.owned) {
+                if (left.graph->get_num_nodes() == 0
+                    || right.graph->get_num_nodes() == 0) {
+                    folded.owned = std::make_shared<const CompactGraph>();
+                } else {
+                    RunOptions pair_options = options;
+                    pair_options.candidate_stats = &stats[p];
+                    pair_options.report = nullptr;
+                    if (num_pairs > 1) {
+                        // The pairs already occupy the threads
+                        pair_options.num_threads = 1;
+                    }
+                    const std::vector<const CompactGraph*> pair
+                        = {left.graph, right.graph};
+                    auto result
+                        = finder->find(pair, std::nullopt, pair_options);
+                    if (!result) {
+                        errors[p] = result.error();
+                        continue;
+                    }
+                    folded.owned = result->empty()
+                                       ? std::make_shared<const CompactGraph>()
+                                       : std::make_shared<const CompactGraph>(
+                                             (*result)[0]->freeze());
+                    for (auto* graph : *result) {
+                        delete graph;
+                    }
+                }
+                std::lock_guard lock(fold_cache_mutex);
+                folded.owned
+                    = fold_cache.try_emplace(folded.key, folded.owned)
+                          .first->second;
+            }
+            folded.graph = folded.owned.get();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                return std::unexpected(*error);
+            }
+        }
+        for (const auto& pair_stats : stats) {
+            add_stats(total_stats, pair_stats);
+        }
+        if (round.size() % 2 == 1) {
+            next.back() = std::move(round.back());
+        }
+        round = std::move(next);
+    }
+    if (options.candidate_stats != nullptr) {
+        *options.candidate_stats = total_stats;
+    }
+
+    std::vector<Graph*> results;
+    if (round[0].graph->get_num_nodes() > 0) {
+        results.push_back(new Graph(round[0].graph->thaw()));
+    }
+    return results;
+}
+
+size_t MCISAlgorithm::fold_cache_size() {
+    std::lock_guard lock(fold_cache_mutex);
+    return fold_cache.size();
+}
+
+void MCISAlgorithm::clear_fold_cache() {
+    std::lock_guard lock(fold_cache_mutex);
+    fold_cache.clear();
+}
+
+void MCISAlgorithm::enable_result_cache(std::optional<std::string> directory) {
+    if (directory) {
+        std::error_code error;
+        std::filesystem::create_directories(*directory, error);
+    }
+    std::lock_guard lock(result_cache_mutex);
+    result_cache_enabled = true;
+    result_cache_directory = std::move(directory);
+}
+
+void MCISAlgorithm::disable_result_cache() {
+    std::lock_guard lock(result_cache_mutex);
+    result_cache_enabled = false;
+    result_cache_directory.reset();
+    result_cache.clear();
+    result_cache_counts = {};
+}
+
+void MCISAlgorithm::clear_result_cache() {
+    std::lock_guard lock(result_cache_mutex);
+    result_cache.clear();
+    result_cache_counts = {};
+}
+
+ResultCacheStats MCISAlgorithm::result_cache_stats() {
+    std::lock_guard lock(result_cache_mutex);
+    ResultCacheStats stats = result_cache_counts;
+    stats.entries = result_cache.size();
+    return stats;
+}
+
+MCISAlgorithm::FindResult MCISAlgorithm::cached_find(
+    uint64_t key, const RunOptions& options,
+    const std::function<FindResult(const RunOptions&)>& find) {
+    // Copies of a snapshot share its arrays, so taking them is cheap
+    std::optional<CachedRun> cached;
+    std::optional<std::string> directory;
+    {
+        std::lock_guard lock(result_cache_mutex);
+        auto entry = result_cache.find(key);
+        if (entry != result_cache.end()) {
+            cached = entry->second;
+        }
+        directory = result_cache_directory;
+    }
+    if (!cached && directory) {
+        CachedRun loaded;
+        if (auto results = load_cached_results(
+                *directory, key, loaded.best_size, loaded.upper_bound)) {
+            loaded.results = std::move(*results);
+            cached = std::move(loaded);
+        }
+    }
+    if (cached) {
+        std::lock_guard lock(result_cache_mutex);
+        ++result_cache_counts.hits;
+        result_cache.try_emplace(key, *cached);
     } else {
-        return algorithm->find(graphs, tag);
+        // Search with a report of our own, since only completed searches
+        // may be cached
+        SearchReport report;
+        RunOptions searched = options;
+        searched.report = &report;
+        FindResult result = find(searched);
+        if (options.report) {
+            *options.report = report;
+        }
+        const bool cacheable
+            = result && report.status == SearchStatus::COMPLETE;
+        CachedRun run{{}, report.best_size, report.upper_bound};
+        if (cacheable) {
+            run.results.reserve(result->size());
+            for (const auto* graph : *result) {
+                run.results.push_back(graph->freeze());
+            }
+            if (directory) {
+                save_cached_results(*directory, key, run.results,
+                                    run.best_size, run.upper_bound);
+            }
+        }
+        std::lock_guard lock(result_cache_mutex);
+        ++result_cache_counts.misses;
+        if (cacheable) {
+            result_cache.try_emplace(key, std::move(run));
+        }
+        return result;
+    }
+
+    if (options.report) {
+        *options.report = SearchReport{};
+        options.report->best_size = cached->best_size;
+        options.report->upper_bound = cached->upper_bound;
     }
+    std::vector<Graph*> results;
+    results.reserve(cached->results.size());
+    for (const auto& graph : cached->results) {
+        results.push_back(new Graph(graph.thaw()));
+    }
+    return results;
 }
 
 std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
 MCISAlgorithm::run_many(const std::vector<const Graph*>& graphs,
                         std::vector<AlgorithmType> types,
-                        std::optional<std::string> tag) {
+                        std::optional<std::string> tag,
+                        const RunOptions& options) {
+    // Freeze once so every algorithm shares the snapshots and their indexes
+    std::vector<CompactGraph> compact_graphs = freeze_all(graphs);
+    return run_many(pointers_to(compact_graphs), std::move(types), tag,
+                    options);
+}
+
+std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
+MCISAlgorithm::run_many(std::initializer_list<const Graph*> graphs,
+                        std::vector<AlgorithmType> types,
+                        std::optional<std::string> tag,
+                        const RunOptions& options) {
+    return run_many(std::vector<const Graph*>(graphs), std::move(types),
+                    std::move(tag), options);
+}
+
+std::expected<std::vector<std::vector<Graph*>>, mcis::AlgorithmError>
+MCISAlgorithm::run_many(const std::vector<const CompactGraph*>& graphs,
+                        std::vector<AlgorithmType> types,
+                        std::optional<std::string> tag,
+                        const RunOptions& options) {
+    // Filter by tag once rather than once per algorithm
+    std::vector<GraphView> views;
+    if (tag) {
+        views = tag_views(graphs, *tag);
+    }
+    const uint64_t inputs = result_cache_enabled ? inputs_key(graphs, tag) : 0;
+
     std::vector<std::vector<Graph*>> results;
     for (const auto& type : types) {
-        auto result = run(graphs, type, tag);
+        MCISFinder* finder = algorithms[static_cast<int>(type)];
+        auto find = [&](const RunOptions& searched) {
+            return tag ? finder->find(views, searched)
+                       : finder->find(graphs, tag, searched);
+        };
+        auto result
+            = result_cache_enabled
+                  ? cached_find(run_key(type, options, inputs), options, find)
+                  : find(options);
         if (result) {
             results.push_back(*result);
         } else {
+            for (auto& previous : results) {
+                for (auto* graph : previous) {
+                    delete graph;
+                }
+            }
             return std::unexpected(result.error());
         }
     }
     return results;
 }
+
+std::vector<BatchResult> MCISAlgorithm::run_batch(
+    const std::vector<BatchJob>& jobs, int num_threads,
+    const std::function<void(const BatchResult&)>& on_result) {
+    // Longest jobs first, so the short ones fill in around them at the end
+    std::vector<double> costs;
+    costs.reserve(jobs.size());
+    for (const auto& job : jobs) {
+        costs.push_back(job_cost(job));
+    }
+    std::vector<size_t> order(jobs.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::ranges::stable_sort(order, std::greater{},
+                             [&](size_t job) { return costs[job]; });
+
+    // Freeze each distinct input once; jobs that share a graph share its
+    // snapshot
+    std::unordered_map<const Graph*, size_t> snapshot_of;
+    std::vector<const Graph*> distinct;
+    for (const auto& job : jobs) {
+        for (const auto* graph : job.graphs) {
+            if (snapshot_of.emplace(graph, distinct.size()).second) {
+                distinct.push_back(graph);
+            }
+        }
+    }
+    const int threads = num_threads > 0 ? num_threads : omp_get_max_threads();
+    std::vector<CompactGraph> snapshots(distinct.size());
+    const auto num_distinct = static_cast<int64_t>(distinct.size());
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+    for (int64_t i = 0; i < num_distinct; ++i) {
+        snapshots[i] = distinct[i]->freeze();
+    }
+
+    std::vector<BatchResult> results(jobs.size());
+    std::mutex on_result_mutex;
+    const auto num_jobs = static_cast<int64_t>(order.size());
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+    for (int64_t i = 0; i < num_jobs; ++i) {
+        const size_t index = order[i];
+        const BatchJob& job = jobs[index];
+        BatchResult& result = results[index];
+        result.job = index;
+        RunOptions options = job.options;
+        options.report = &result.report;
+        options.candidate_stats = &result.candidate_stats;
+
+        std::vector<const CompactGraph*> inputs;
+        inputs.reserve(job.graphs.size());
+        for (const auto* graph : job.graphs) {
+            inputs.push_back(&snapshots[snapshot_of.at(graph)]);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto found = run(inputs, job.type, job.tag, options);
+        result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (found) {
+            std::vector<Graph> graphs;
+            graphs.reserve(found->size());
+            for (auto* graph : *found) {
+                graphs.push_back(std::move(*graph));
+                delete graph;
+            }
+            result.graphs = std::move(graphs);
+        } else {
+            result.graphs = std::unexpected(found.error());
+        }
+
+        if (on_result) {
+            std::lock_guard lock(on_result_mutex);
+            on_result(result);
+        }
+    }
+    return results;
+}
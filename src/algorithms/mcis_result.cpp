@@ -0,0 +1,101 @@
+/**
+ * @file mcis_result.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/mcis_result.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct MCISResult::LazyGraph {
+    std::once_flag once;
+    std::optional<Graph> graph;
+};
+
+MCISResult::MCISResult(std::vector<CompactGraph> inputs,
+                       std::vector<VertexId> mapping)
+    : inputs(std::move(inputs)),
+      mapping(std::move(mapping)),
+      lazy(std::make_shared<LazyGraph>()) {
+    if (empty()) {
+        return;
+    }
+
+    // Edges are found from the first input's out-rows, then checked in the
+    // others
+    const CompactGraph& first = this->inputs[0];
+    const auto first_column = column(0);
+    std::vector<uint32_t> index_of(first.get_num_nodes(), UINT32_MAX);
+    for (uint32_t i = 0; i < first_column.size(); ++i) {
+        index_of[first_column[i]] = i;
+    }
+    for (uint32_t a = 0; a < first_column.size(); ++a) {
+        for (const auto target : first.out_neighbors(first_column[a])) {
+            const uint32_t b = index_of[target];
+            if (b == UINT32_MAX) {
+                continue;
+            }
+            bool in_every_graph = true;
+            for (size_t g = 1; g < this->inputs.size() && in_every_graph;
+                 ++g) {
+                in_every_graph = this->inputs[g].has_edge(column(g)[a],
+                                                          column(g)[b]);
+            }
+            if (in_every_graph) {
+                induced.emplace_back(a, b);
+            }
+        }
+    }
+    std::ranges::sort(induced);
+}
+
+std::string MCISResult::get_id(size_t i) const {
+    std::string id;
+    for (size_t g = 0; g < inputs.size(); ++g) {
+        if (g > 0) {
+            id += "_";
+        }
+        id += inputs[g].get_id(column(g)[i]);
+    }
+    return id;
+}
+
+Graph MCISResult::to_graph() const {
+    Graph graph;
+    std::vector<std::string> ids;
+    ids.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        ids.push_back(get_id(i));
+        graph.add_node(ids.back());
+        // Keep the first graph's tag so the result can be matched again
+        const std::string& tag = inputs[0].get_tag(column(0)[i]);
+        if (!tag.empty()) {
+            graph.set_node_tag(ids.back(), tag);
+        }
+    }
+    for (const auto& [a, b] : induced) {
+        graph.add_edge(ids[a], ids[b], 1);
+    }
+    return graph;
+}
+
+const Graph& MCISResult::graph() const {
+    if (!lazy) {
+        static const Graph empty_graph;
+        return empty_graph;
+    }
+    std::call_once(lazy->once, [&] { lazy->graph.emplace(to_graph()); });
+    return *lazy->graph;
+}
@@ -0,0 +1,539 @@
+/**
+ * @file mcsplit.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * The search keeps, for every input graph, one array holding its unmatched
+ * vertices grouped by label class. A class is a contiguous segment of each
+ * array; splitting a class reorders its segments in place, so every level
+ * only records the segment bounds of its classes, and the segments of a
+ * parent class always hold the same vertices, whatever order its children
+ * left them in.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./mcsplit.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./metrics_recorder.h"
+#include "./search_control.h"
+
+namespace {
+
+constexpr uint32_t NO_CLASS = UINT32_MAX;
+
+/**
+ * @brief An input view renumbered by non-increasing degree, with its
+ * adjacency in the local numbering.
+ */
+struct LocalGraph {
+    std::vector<CompactGraph::VertexId> parent;
+    std::vector<uint32_t> out_offsets, out_adjacency;
+    std::vector<uint32_t> in_offsets, in_adjacency;
+
+    explicit LocalGraph(const GraphView& view) {
+        const auto vertices = view.vertices();
+        const auto n = static_cast<uint32_t>(vertices.size());
+        std::vector<uint32_t> degree(view.graph().get_num_nodes(), 0);
+        for (const auto v : vertices) {
+            degree[v] = view.out_degree(v) + view.in_degree(v);
+        }
+        parent.assign(vertices.begin(), vertices.end());
+        std::ranges::stable_sort(parent, [&](auto a, auto b) {
+            return degree[a] > degree[b];
+        });
+
+        std::vector<uint32_t> local(view.graph().get_num_nodes(), 0);
+        for (uint32_t i = 0; i < n; ++i) {
+            local[parent[i]] = i;
+        }
+        out_offsets.assign(n + 1, 0);
+        in_offsets.assign(n + 1, 0);
+        for (uint32_t i = 0; i < n; ++i) {
+            view.for_each_out_neighbor(parent[i], [&](auto u) {
+                out_adjacency.push_back(local[u]);
+            });
+            out_offsets[i + 1] = static_cast<uint32_t>(out_adjacency.size());
+            view.for_each_in_neighbor(parent[i], [&](auto u) {
+                in_adjacency.push_back(local[u]);
+            });
+            in_offsets[i + 1] = static_cast<uint32_t>(in_adjacency.size());
+        }
+    }
+
+    uint32_t size() const { return static_cast<uint32_t>(parent.size()); }
+};
+
+/**
+ * @brief The label classes of one search node. Class c occupies
+ * start[c * k + g], length[c * k + g] of graph g's vertex array.
+ */
+struct LabelClasses {
+    std::vector<uint32_t> start;
+    std::vector<uint32_t> length;
+    // Whether the class's vertices are adjacent to a mapped vertex
+    std::vector<uint8_t> adjacent;
+
+    size_t size() const { return adjacent.size(); }
+
+    void clear() {
+        start.clear();
+        length.clear();
+        adjacent.clear();
+    }
+};
+
+class McSplitSearch {
+ public:
+    McSplitSearch(const std::vector<GraphView>& views,
+                  const McSplitOptions& rules)
+        : k(views.size()),
+          rules(rules),
+          relation(views.size()),
+          vertices(views.size()),
+          scratch(views.size()) {
+        graphs.reserve(k);
+        for (const auto& view : views) {
+            graphs.emplace_back(view);
+        }
+        for (size_t g = 0; g < k; ++g) {
+            relation[g].assign(graphs[g].size(), 0);
+        }
+        initial_classes(views);
+    }
+
+    /**
+     * @brief The largest total a mapping can reach from the initial classes.
+     */
+    size_t root_bound() const { return bound(levels.front().classes); }
+
+    /**
+     * @brief Runs the search.
+     * @param search_control The limits and reporting of the search.
+     * @return The best mapping, k parent vertex IDs per mapped tuple.
+     */
+    std::vector<CompactGraph::VertexId> run(SearchControl& search_control) {
+        control = &search_control;
+        expand(0);
+        control->count(pending_expansions);
+        counters.flush(control->metrics());
+
+        std::vector<CompactGraph::VertexId> tuples(best.size());
+        for (size_t i = 0; i < best.size(); ++i) {
+            tuples[i] = graphs[i % k].parent[best[i]];
+        }
+        return tuples;
+    }
+
+ private:
+    struct Level {
+        LabelClasses classes;
+        // Sorted candidates of the branching class in every graph but the
+        // first, and the tuple being tried
+        std::vector<std::vector<uint32_t>> candidates;
+        std::vector<size_t> cursor;
+    };
+
+    const size_t k;
+    const McSplitOptions& rules;
+    SearchControl* control = nullptr;
+    std::vector<LocalGraph> graphs;
+    // Relation of each vertex to the vertex just mapped, per graph
+    std::vector<std::vector<uint8_t>> relation;
+    // Unmatched vertices of each graph, grouped by class
+    std::vector<std::vector<uint32_t>> vertices;
+    std::vector<std::vector<uint32_t>> scratch;
+    // A deque keeps references to existing levels valid while it grows
+    std::deque<Level> levels;
+    // Mapped tuples, k local IDs each
+    std::vector<uint32_t> mapping;
+    std::vector<uint32_t> best;
+    uint64_t pending_expansions = 0;
+    MetricCounters counters;
+
+    Level& level(size_t depth) {
+        while (levels.size() <= depth) {
+            levels.push_back(
+                {{}, std::vector<std::vector<uint32_t>>(k), {}});
+        }
+        return levels[depth];
+    }
+
+    bool out_of_time() {
+        if (++pending_expansions == SearchControl::CHECK_INTERVAL) {
+            pending_expansions = 0;
+            return control->check(SearchControl::CHECK_INTERVAL,
+                                  best.size() / k);
+        }
+        return control->stopped();
+    }
+
+    /**
+     * @brief Builds the root classes: one per tag shared by every graph
+     * when tags must match, or a single class holding every vertex.
+     */
+    void initial_classes(const std::vector<GraphView>& views) {
+        LabelClasses& root = level(0).classes;
+        std::vector<std::vector<uint32_t>> labels(k);
+        uint32_t num_labels = 1;
+        if (rules.match_tags) {
+            // Tags are compared by name across graphs
+            std::unordered_map<std::string, uint32_t> ids;
+            for (size_t g = 0; g < k; ++g) {
+                const CompactGraph& graph = views[g].graph();
+                for (const auto v : graphs[g].parent) {
+                    labels[g].push_back(
+                        ids.try_emplace(graph.get_tag(v),
+                                        static_cast<uint32_t>(ids.size()))
+                            .first->second);
+                }
+            }
+            num_labels = static_cast<uint32_t>(ids.size());
+        } else {
+            for (size_t g = 0; g < k; ++g) {
+                labels[g].assign(graphs[g].size(), 0);
+            }
+        }
+
+        std::vector<uint32_t> counts(num_labels * k, 0);
+        for (size_t g = 0; g < k; ++g) {
+            for (const auto label : labels[g]) {
+                ++counts[label * k + g];
+            }
+        }
+        std::vector<uint32_t> class_of(num_labels, NO_CLASS);
+        for (uint32_t label = 0; label < num_labels; ++label) {
+            const auto first = counts.begin() + label * k;
+            if (std::all_of(first, first + k,
+                            [](uint32_t c) { return c > 0; })) {
+                class_of[label] = static_cast<uint32_t>(root.size());
+                for (size_t g = 0; g < k; ++g) {
+                    root.start.push_back(0);
+                    root.length.push_back(first[g]);
+                }
+                root.adjacent.push_back(0);
+            }
+        }
+        for (size_t g = 0; g < k; ++g) {
+            uint32_t offset = 0;
+            for (size_t c = 0; c < root.size(); ++c) {
+                root.start[c * k + g] = offset;
+                offset += root.length[c * k + g];
+            }
+            vertices[g].resize(offset);
+            scratch[g].resize(offset);
+            std::vector<uint32_t> next(root.size());
+            for (size_t c = 0; c < root.size(); ++c) {
+                next[c] = root.start[c * k + g];
+            }
+            // Vertices are numbered by degree, so each class starts out in
+            // degree order
+            for (uint32_t v = 0; v < graphs[g].size(); ++v) {
+                const uint32_t c = class_of[labels[g][v]];
+                if (c != NO_CLASS) {
+                    vertices[g][next[c]++] = v;
+                }
+            }
+        }
+    }
+
+    size_t bound(const LabelClasses& classes) const {
+        size_t total = mapping.size() / k;
+        for (size_t c = 0; c < classes.size(); ++c) {
+            total += *std::min_element(classes.length.begin() + c * k,
+                                       classes.length.begin() + (c + 1) * k);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Picks the class to branch on: the one whose largest side is
+     * smallest, among those adjacent to the mapping if it must stay
+     * connected.
+     */
+    size_t select(const LabelClasses& classes) const {
+        const bool connected = rules.connected && !mapping.empty();
+        size_t chosen = NO_CLASS;
+        uint32_t chosen_size = UINT32_MAX;
+        for (size_t c = 0; c < classes.size(); ++c) {
+            if (connected && !classes.adjacent[c]) {
+                continue;
+            }
+            const uint32_t size
+                = *std::max_element(classes.length.begin() + c * k,
+                                    classes.length.begin() + (c + 1) * k);
+            if (size < chosen_size) {
+                chosen = c;
+                chosen_size = size;
+            }
+        }
+        return chosen;
+    }
+
+    /**
+     * @brief Moves a vertex to the end of its segment and drops it from the
+     * class.
+     */
+    void exclude(LabelClasses& classes, size_t c, size_t g, uint32_t v) {
+        const uint32_t first = classes.start[c * k + g];
+        const uint32_t last = first + --classes.length[c * k + g];
+        auto& array = vertices[g];
+        std::swap(*std::find(array.begin() + first,
+                             array.begin() + last + 1, v),
+                  array[last]);
+    }
+
+    /**
+     * @brief Splits every class of a node by the relation of its vertices
+     * to the tuple mapped last, which the classes no longer hold.
+     */
+    void split(const LabelClasses& classes, LabelClasses& next,
+               const uint32_t* tuple) {
+        const uint32_t num_relations = rules.directed ? 4 : 2;
+        const uint8_t in_bit = rules.directed ? 2 : 1;
+        for (size_t g = 0; g < k; ++g) {
+            const LocalGraph& graph = graphs[g];
+            const uint32_t u = tuple[g];
+            for (uint32_t e = graph.out_offsets[u];
+                 e < graph.out_offsets[u + 1]; ++e) {
+                relation[g][graph.out_adjacency[e]] |= 1;
+            }
+            for (uint32_t e = graph.in_offsets[u]; e < graph.in_offsets[u + 1];
+                 ++e) {
+                relation[g][graph.in_adjacency[e]] |= in_bit;
+            }
+        }
+
+        next.clear();
+        std::vector<uint32_t> counts(num_relations * k);
+        for (size_t c = 0; c < classes.size(); ++c) {
+            std::fill(counts.begin(), counts.end(), 0);
+            for (size_t g = 0; g < k; ++g) {
+                const uint32_t first = classes.start[c * k + g];
+                const uint32_t length = classes.length[c * k + g];
+                uint32_t* segment = vertices[g].data() + first;
+                for (uint32_t i = 0; i < length; ++i) {
+                    ++counts[relation[g][segment[i]] * k + g];
+                }
+                // Counting sort of the segment by relation
+                uint32_t offsets[4] = {0, 0, 0, 0};
+                for (uint32_t r = 1; r < num_relations; ++r) {
+                    offsets[r] = offsets[r - 1] + counts[(r - 1) * k + g];
+                }
+                uint32_t* buffer = scratch[g].data() + first;
+                for (uint32_t i = 0; i < length; ++i) {
+                    buffer[offsets[relation[g][segment[i]]]++] = segment[i];
+                }
+                std::copy(buffer, buffer + length, segment);
+            }
+            for (uint32_t r = 0; r < num_relations; ++r) {
+                const auto first = counts.begin() + r * k;
+                if (!std::all_of(first, first + k,
+                                 [](uint32_t n) { return n > 0; })) {
+                    continue;
+                }
+                for (size_t g = 0; g < k; ++g) {
+                    uint32_t before = 0;
+                    for (uint32_t q = 0; q < r; ++q) {
+                        before += counts[q * k + g];
+                    }
+                    next.start.push_back(classes.start[c * k + g] + before);
+                    next.length.push_back(first[g]);
+                }
+                next.adjacent.push_back(classes.adjacent[c] || r != 0);
+            }
+        }
+
+        for (size_t g = 0; g < k; ++g) {
+            const LocalGraph& graph = graphs[g];
+            const uint32_t u = tuple[g];
+            for (uint32_t e = graph.out_offsets[u];
+                 e < graph.out_offsets[u + 1]; ++e) {
+                relation[g][graph.out_adjacency[e]] = 0;
+            }
+            for (uint32_t e = graph.in_offsets[u]; e < graph.in_offsets[u + 1];
+                 ++e) {
+                relation[g][graph.in_adjacency[e]] = 0;
+            }
+        }
+    }
+
+    void expand(size_t depth) {
+        if (out_of_time()) {
+            return;
+        }
+        Level& lvl = levels[depth];
+        LabelClasses& classes = lvl.classes;
+        counters.node(classes.size());
+        if (mapping.size() > best.size()) {
+            best = mapping;
+        }
+        if (bound(classes) <= best.size() / k) {
+            counters.prune();
+            return;
+        }
+        const size_t c = select(classes);
+        if (c == NO_CLASS) {
+            return;
+        }
+
+        // Branch on the first graph's highest-degree vertex of the class
+        const uint32_t first = classes.start[c * k];
+        const uint32_t* side = vertices[0].data() + first;
+        const uint32_t v
+            = *std::min_element(side, side + classes.length[c * k]);
+        exclude(classes, c, 0, v);
+
+        bool any = true;
+        for (size_t g = 1; g < k; ++g) {
+            const uint32_t* segment
+                = vertices[g].data() + classes.start[c * k + g];
+            lvl.candidates[g].assign(segment,
+                                     segment + classes.length[c * k + g]);
+            std::ranges::sort(lvl.candidates[g]);
+            any = any && !lvl.candidates[g].empty();
+        }
+        lvl.cursor.assign(k, 0);
+        Level& next = level(depth + 1);
+        const size_t mapped = mapping.size();
+        mapping.resize(mapped + k);
+        mapping[mapped] = v;
+        while (any) {
+            for (size_t g = 1; g < k; ++g) {
+                mapping[mapped + g] = lvl.candidates[g][lvl.cursor[g]];
+                exclude(classes, c, g, mapping[mapped + g]);
+            }
+            split(classes, next.classes, mapping.data() + mapped);
+            counters.intersect();
+            expand(depth + 1);
+            for (size_t g = 1; g < k; ++g) {
+                ++classes.length[c * k + g];
+            }
+            if (control->stopped()) {
+                mapping.resize(mapped);
+                return;
+            }
+
+            // Next tuple, last graph fastest
+            size_t g = k;
+            while (g-- > 1 && ++lvl.cursor[g] == lvl.candidates[g].size()) {
+                lvl.cursor[g] = 0;
+            }
+            any = g > 0;
+        }
+        mapping.resize(mapped);
+
+        // Leave v unmatched
+        next.classes = classes;
+        if (next.classes.length[c * k] == 0) {
+            next.classes.start.erase(next.classes.start.begin() + c * k,
+                                     next.classes.start.begin() + (c + 1) * k);
+            next.classes.length.erase(
+                next.classes.length.begin() + c * k,
+                next.classes.length.begin() + (c + 1) * k);
+            next.classes.adjacent.erase(next.classes.adjacent.begin() + c);
+        }
+        expand(depth + 1);
+    }
+};
+
+}  // namespace
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> McSplit::find(
+    const std::vector<const Graph*>& graphs, std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> McSplit::find(
+    const std::vector<const CompactGraph*>& graphs,
+    std::optional<std::string> tag) {
+    return find(graphs, tag, RunOptions{});
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> McSplit::find(
+    const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+    const RunOptions& options) {
+    for (const auto& graph : graphs) {
+        if (graph->get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+    }
+
+    std::vector<CompactGraph> compact_graphs;
+    compact_graphs.reserve(graphs.size());
+    std::vector<const CompactGraph*> compact_ptrs;
+    compact_ptrs.reserve(graphs.size());
+    for (const auto& graph : graphs) {
+        compact_graphs.push_back(graph->freeze());
+        compact_ptrs.push_back(&compact_graphs.back());
+    }
+    return find(compact_ptrs, tag, options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> McSplit::find(
+    const std::vector<const CompactGraph*>& graphs,
+    std::optional<std::string> tag, const RunOptions& options) {
+    return find(views_of(graphs, tag), options);
+}
+
+std::expected<std::vector<Graph*>, mcis::AlgorithmError> McSplit::find(
+    const std::vector<GraphView>& views, const RunOptions& options) {
+    return to_graphs(find_results(views, options));
+}
+
+std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+McSplit::find_results(const std::vector<GraphView>& views,
+                      const RunOptions& options) {
+    if (views.empty()) {
+        return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+    }
+    for (const auto& view : views) {
+        if (view.get_num_nodes() == 0) {
+            return std::unexpected(mcis::AlgorithmError::EMPTY_GRAPH);
+        }
+    }
+
+    McSplitOptions rules = options.mcsplit;
+    rules.match_tags = rules.match_tags || options.candidate_filter.match_tags;
+
+    ScopedPhase search_phase(options.metrics, "search");
+    McSplitSearch search(views, rules);
+    SearchControl control(options,
+                          std::chrono::milliseconds(MCSPLIT_TIMEOUT_MS),
+                          search.root_bound());
+    std::vector<CompactGraph::VertexId> tuples = search.run(control);
+    const size_t size = tuples.size() / views.size();
+    control.finish(size, true);
+    search_phase.stop();
+
+    // Tuples are stored one after another; results keep one column per
+    // graph
+    ScopedPhase conversion_phase(options.metrics, "result_conversion");
+    const size_t k = views.size();
+    std::vector<CompactGraph> inputs;
+    inputs.reserve(k);
+    std::vector<CompactGraph::VertexId> mapping(tuples.size());
+    for (size_t g = 0; g < k; ++g) {
+        inputs.push_back(views[g].graph());
+        for (size_t i = 0; i < size; ++i) {
+            mapping[g * size + i] = tuples[i * k + g];
+        }
+    }
+    std::vector<MCISResult> results;
+    if (size > 0) {
+        results.emplace_back(std::move(inputs), std::move(mapping));
+    }
+    return results;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file mcsplit.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_MCSPLIT_H_
+#define SRC_ALGORITHMS_MCSPLIT_H_
+
+#include <string>
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/mcis_finder.h"
+
+/**
+ * @brief Default time limit for one McSplit search in milliseconds, used
+ * when the run options set none. On timeout the best mapping found so far
+ * is returned.
+ */
+constexpr int MCSPLIT_TIMEOUT_MS = 5000;
+
+/**
+ * @class McSplit
+ *
+ * Implements McSplit-style branch-and-bound for the maximum common induced
+ * subgraph, generalized from two graphs to N. Instead of building a product
+ * graph, the unmatched vertices of every graph are kept partitioned into
+ * label classes: vertices that may still be mapped onto each other are
+ * exactly those in the same class in every graph. A class starts from the
+ * vertices' tags (or holds every vertex), and mapping one vertex of each
+ * graph splits every class by how its vertices relate to the mapped ones
+ * (no edge, an out-edge, an in-edge or both). Each class can add at most
+ * its smallest side to the mapping, which bounds the search, and a level
+ * only stores its class bounds, so memory is linear in the graph sizes.
+ *
+ * Vertices are tried in non-increasing degree order, so the first mappings
+ * are dense. RunOptions::mcsplit selects a connectedness requirement and
+ * whether edge directions and tags must be kept; the candidate filter does
+ * not apply, except that its match_tags rule also matches tags here.
+ */
+class McSplit : public MCISFinder {
+ public:
+    /**
+     * @brief Finds an MCIS between a set of graphs.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds an MCIS between a set of frozen graphs.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag) override;
+
+    /**
+     * @brief Finds an MCIS between a set of graphs.
+     * @param graphs A vector of pointers to the input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; mcsplit, the limits, token, progress
+     * callback, report and metrics apply.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const Graph*>& graphs, std::optional<std::string> tag,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds an MCIS between a set of frozen graphs.
+     * @param graphs A vector of pointers to the compact input graphs.
+     * @param tag An optional tag to filter nodes by.
+     * @param options Run options; mcsplit, the limits, token, progress
+     * callback, report and metrics apply.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS, or an error if the graphs are empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<const CompactGraph*>& graphs,
+        std::optional<std::string> tag, const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views without copying
+     * them.
+     * @param views One view per input graph.
+     * @param options Run options; mcsplit, the limits, token, progress
+     * callback, report and metrics apply.
+     * @return A vector holding one pointer to a Graph object representing the
+     * found MCIS (none if no vertices can be matched), or an error if a view
+     * is empty.
+     */
+    std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+        const std::vector<GraphView>& views,
+        const RunOptions& options) override;
+
+    /**
+     * @brief Finds the MCIS between induced subgraph views as owned
+     * mappings, without building any Graph.
+     * @param views One view per input graph.
+     * @param options Run options, as for find().
+     * @return The found results, or an error if a view is empty.
+     */
+    std::expected<std::vector<MCISResult>, mcis::AlgorithmError>
+    find_results(const std::vector<GraphView>& views,
+                 const RunOptions& options) override;
+};
+
+#endif  // SRC_ALGORITHMS_MCSPLIT_H_
@@ -0,0 +1,116 @@
+/**
+ * @file metrics_recorder.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./metrics_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace {
+
+// Every recording goes through one lock: phases end and workers flush
+// rarely, so it is never contended in practice
+std::mutex metrics_mutex;
+
+uint32_t thread_number() {
+    static std::atomic<uint32_t> next{0};
+    thread_local const uint32_t number = next.fetch_add(1);
+    return number;
+}
+
+int64_t to_microseconds(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               time.time_since_epoch())
+        .count();
+}
+
+void write_json_string(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+}  // namespace
+
+void ScopedPhase::record(std::chrono::steady_clock::time_point end) {
+    const auto elapsed = end - start;
+    const uint32_t thread = thread_number();
+    std::lock_guard lock(metrics_mutex);
+    auto phase = std::ranges::find(metrics->phases, std::string_view(name),
+                                   &PhaseMetrics::name);
+    if (phase == metrics->phases.end()) {
+        metrics->phases.push_back({name, 0, {}});
+        phase = std::prev(metrics->phases.end());
+    }
+    ++phase->calls;
+    phase->total
+        += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    if (metrics->record_trace) {
+        metrics->trace.push_back(
+            {name, to_microseconds(start),
+             to_microseconds(end) - to_microseconds(start), thread});
+    }
+}
+
+void MetricCounters::add_to(SearchMetrics& metrics) const {
+    std::lock_guard lock(metrics_mutex);
+    metrics.search_nodes += search_nodes;
+    metrics.pruned_branches += pruned_branches;
+    metrics.peak_frontier = std::max(metrics.peak_frontier, peak_frontier);
+    metrics.set_intersections += set_intersections;
+    metrics.pivot_selections += pivot_selections;
+    metrics.conflict_checks += conflict_checks;
+}
+
+const PhaseMetrics* SearchMetrics::phase(std::string_view name) const {
+    const auto it = std::ranges::find(phases, name, &PhaseMetrics::name);
+    return it == phases.end() ? nullptr : &*it;
+}
+
+void SearchMetrics::write_chrome_trace(std::ostream& out) const {
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < trace.size(); ++i) {
+        const TraceEvent& event = trace[i];
+        out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(out, event.name);
+        out << ",\"cat\":\"mcis\",\"ph\":\"X\",\"ts\":" << event.start_us
+            << ",\"dur\":" << event.duration_us << ",\"pid\":1,\"tid\":"
+            << event.thread << '}';
+    }
+    out << "\n]}\n";
+}
+
+std::optional<mcis::GraphError> SearchMetrics::write_chrome_trace(
+    const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    write_chrome_trace(file);
+    if (!file) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file metrics_recorder.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_METRICS_RECORDER_H_
+#define SRC_ALGORITHMS_METRICS_RECORDER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "mcis/search_metrics.h"
+
+/**
+ * @class ScopedPhase
+ * @brief Times a phase from construction until stop() or destruction and
+ * adds it to the metrics, if any. Safe to use from several threads.
+ */
+class ScopedPhase {
+ public:
+    ScopedPhase(SearchMetrics* metrics, const char* name)
+        : metrics(SearchMetrics::ENABLED ? metrics : nullptr), name(name) {
+        if (this->metrics != nullptr) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedPhase() { stop(); }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+    /**
+     * @brief Ends the phase early; later calls do nothing.
+     */
+    void stop() {
+        if (metrics != nullptr) {
+            record(std::chrono::steady_clock::now());
+            metrics = nullptr;
+        }
+    }
+
+ private:
+    SearchMetrics* metrics;
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+
+    void record(std::chrono::steady_clock::time_point end);
+};
+
+/**
+ * @struct MetricCounters
+ * @brief Hot-path counters of one search worker. Workers count locally and
+ * add the totals to the shared metrics once, in flush(). Every method is a
+ * no-op when metrics are compiled out.
+ */
+struct MetricCounters {
+    uint64_t search_nodes = 0;
+    uint64_t pruned_branches = 0;
+    uint64_t peak_frontier = 0;
+    uint64_t set_intersections = 0;
+    uint64_t pivot_selections = 0;
+    uint64_t conflict_checks = 0;
+
+    /**
+     * @brief Counts a search node with the given number of candidates.
+     */
+    void node(size_t frontier) {
+        if constexpr (SearchMetrics::ENABLED) {
+            ++search_nodes;
+            peak_frontier = std::max<uint64_t>(peak_frontier, frontier);
+        }
+    }
+
+    void prune(uint64_t branches = 1) {
+        if constexpr (SearchMetrics::ENABLED) {
+            pruned_branches += branches;
+        }
+    }
+
+    void intersect(uint64_t intersections = 1) {
+        if constexpr (SearchMetrics::ENABLED) {
+            set_intersections += intersections;
+        }
+    }
+
+    void pivot() {
+        if constexpr (SearchMetrics::ENABLED) {
+            ++pivot_selections;
+        }
+    }
+
+    void conflict_check(uint64_t checks = 1) {
+        if constexpr (SearchMetrics::ENABLED) {
+            conflict_checks += checks;
+        }
+    }
+
+    /**
+     * @brief Adds the counts to the metrics, if any, and resets them.
+     * Safe to call from several threads.
+     */
+    void flush(SearchMetrics* metrics) {
+        if constexpr (SearchMetrics::ENABLED) {
+            if (metrics != nullptr) {
+                add_to(*metrics);
+            }
+            *this = MetricCounters();
+        }
+    }
+
+ private:
+    void add_to(SearchMetrics& metrics) const;
+};
+
+#endif  // SRC_ALGORITHMS_METRICS_RECORDER_H_
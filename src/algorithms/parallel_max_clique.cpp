@@ -0,0 +1,152 @@
+/**
+ * @file parallel_max_clique.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./parallel_max_clique.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "./bitset_ops.h"
+#include "./coloring_search.h"
+#include "./metrics_recorder.h"
+
+std::vector<uint32_t> ParallelMaxClique::find_maximum_clique(
+    const DenseProductGraph& product_graph, const RunOptions& options,
+    const ProductSymmetry* symmetry) {
+    ScopedPhase search_phase(options.metrics, "search");
+    const size_t words = product_graph.words_per_row;
+    SearchControl control(options,
+                          std::chrono::milliseconds(MAX_CLIQUE_TIMEOUT_MS),
+                          product_graph.num_vertices);
+    CliqueIncumbent incumbent(product_graph.greedy_clique(), control);
+    int num_threads = options.num_threads;
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+
+    // One search workspace per thread. A task never reaches a scheduling
+    // point while it runs, so a thread's workspace is used by one task at a
+    // time; the producer keeps its own workspace for coloring.
+    std::deque<ColoringSearch> workers;
+    for (int t = 0; t < num_threads; ++t) {
+        workers.emplace_back(product_graph, incumbent, symmetry);
+    }
+
+    auto spawn = [&](std::vector<uint32_t> prefix,
+                     std::vector<uint64_t> candidates, bool closed) {
+#pragma omp task firstprivate(prefix, candidates, closed) shared(workers)
+        workers[omp_get_thread_num()].search(prefix, candidates.data(),
+                                             closed);
+    };
+
+#pragma omp parallel num_threads(num_threads)
+#pragma omp single
+    {
+        ColoringSearch producer(product_graph, incumbent);
+        MetricCounters root_counters;
+        ProductOrbits root_orbits, branch_orbits;
+        std::vector<uint64_t> remaining(words, 0);
+        for (size_t v = 0; v < product_graph.num_vertices; ++v) {
+            mcis::bitset::set(remaining.data(), v);
+        }
+        std::vector<uint32_t> order, colors;
+        producer.color(remaining.data(), incumbent.size() + 1, order, colors);
+        incumbent.bound(colors.empty() ? incumbent.size()
+                                       : std::max<size_t>(incumbent.size(),
+                                                          colors.back()));
+
+        // The producer breaks symmetry at the two levels it expands, so
+        // the tasks' candidates stay closed under their prefix stabilizers
+        bool root_symmetric = false;
+        if (symmetry != nullptr && !order.empty()) {
+            symmetry->orbits({}, remaining.data(), root_orbits);
+            root_symmetric = !root_orbits.trivial();
+        }
+        const bool branches_closed = root_symmetric && root_orbits.complete();
+
+        std::vector<uint64_t> P1(words), P2(words);
+        std::vector<uint32_t> order1, colors1;
+        for (size_t i = order.size(); i-- > 0;) {
+            if (colors[i] <= incumbent.size() || incumbent.check_limits(0)) {
+                break;
+            }
+            const uint32_t v = order[i];
+            if (root_symmetric && !mcis::bitset::test(remaining.data(), v)) {
+                // Left with the orbit of an earlier root branch
+                continue;
+            }
+            mcis::bitset::and_into(P1.data(), remaining.data(),
+                                   product_graph.row(v), words);
+            // Later branches only see what is left, so v's orbit can leave
+            // with v: its cliques there are images of v's
+            if (root_symmetric) {
+                root_counters.prune(
+                    root_orbits.remove_orbit(v, remaining.data()));
+            } else {
+                mcis::bitset::reset(remaining.data(), v);
+            }
+
+            if (!mcis::bitset::any(P1.data(), words)) {
+                incumbent.offer({v});
+                continue;
+            }
+            if (mcis::bitset::count(P1.data(), words)
+                < PARALLEL_SPLIT_MIN_CANDIDATES) {
+                spawn({v}, P1, branches_closed);
+                continue;
+            }
+
+            // Large subtree: hand out its second-level branches instead
+            producer.color(P1.data(), incumbent.size(), order1, colors1);
+            bool branch_symmetric = false;
+            if (branches_closed && SYMMETRY_BREAKING_MAX_DEPTH > 1) {
+                const uint32_t prefix[] = {v};
+                symmetry->orbits(prefix, P1.data(), branch_orbits);
+                branch_symmetric = !branch_orbits.trivial();
+            }
+            const bool leaves_closed
+                = branch_symmetric && branch_orbits.complete();
+            for (size_t j = order1.size(); j-- > 0;) {
+                if (1 + colors1[j] <= incumbent.size()) {
+                    break;
+                }
+                const uint32_t u = order1[j];
+                if (branch_symmetric && !mcis::bitset::test(P1.data(), u)) {
+                    continue;
+                }
+                mcis::bitset::and_into(P2.data(), P1.data(),
+                                       product_graph.row(u), words);
+                if (branch_symmetric) {
+                    root_counters.prune(
+                        branch_orbits.remove_orbit(u, P1.data()));
+                } else {
+                    mcis::bitset::reset(P1.data(), u);
+                }
+                if (mcis::bitset::any(P2.data(), words)) {
+                    spawn({v, u}, P2, leaves_closed);
+                } else {
+                    incumbent.offer({v, u});
+                }
+            }
+        }
+        root_counters.flush(options.metrics);
+    }
+
+    for (auto& worker : workers) {
+        worker.flush();
+    }
+    return incumbent.take();
+}
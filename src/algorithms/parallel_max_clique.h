@@ -0,0 +1,58 @@
+/**
+ * @file parallel_max_clique.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_PARALLEL_MAX_CLIQUE_H_
+#define SRC_ALGORITHMS_PARALLEL_MAX_CLIQUE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "./max_clique_coloring.h"
+#include "mcis/dense_product_graph.h"
+#include "mcis/run_options.h"
+
+/**
+ * @brief Top-level branches with at least this many candidates are split
+ * once more, so that a few huge subtrees do not serialize the search.
+ */
+constexpr size_t PARALLEL_SPLIT_MIN_CANDIDATES = 256;
+
+/**
+ * @class ParallelMaxClique
+ *
+ * Parallel version of the coloring branch-and-bound maximum clique search.
+ * The top of the search tree is colored once and every surviving branch
+ * (split one level deeper when it is large) becomes an OpenMP task; idle
+ * threads pick up pending tasks from the shared pool, so uneven subtrees are
+ * balanced dynamically. All workers prune against one atomically published
+ * incumbent size, and the search uses RunOptions::num_threads threads.
+ * Building the product graph and converting the clique are inherited from
+ * MaxCliqueColoring.
+ */
+class ParallelMaxClique : public MaxCliqueColoring {
+ protected:
+    /**
+     * @brief Searches for a maximum clique of a product graph in parallel.
+     * @param product_graph The product graph to search, renumbered by
+     * non-increasing degree.
+     * @param options Run options; the thread count, limits, token,
+     * progress callback and report apply.
+     * @param symmetry If set, the product symmetries used to skip
+     * symmetric branches.
+     * @return The largest clique found.
+     */
+    std::vector<uint32_t> find_maximum_clique(
+        const DenseProductGraph& product_graph, const RunOptions& options,
+        const ProductSymmetry* symmetry) override;
+};
+
+#endif  // SRC_ALGORITHMS_PARALLEL_MAX_CLIQUE_H_
@@ -0,0 +1,127 @@
+/**
+ * @file product_orbits.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./product_orbits.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "./bitset_ops.h"
+
+size_t ProductOrbits::remove_orbit(uint32_t p, uint64_t* candidates) const {
+    const uint32_t o = orbit_of[p];
+    size_t removed = 0;
+    for (uint32_t i = offsets[o]; i < offsets[o + 1]; ++i) {
+        const uint32_t q = members[i];
+        if (q != p && mcis::bitset::test(candidates, q)) {
+            mcis::bitset::reset(candidates, q);
+            ++removed;
+        }
+    }
+    mcis::bitset::reset(candidates, p);
+    return removed;
+}
+
+ProductSymmetry::ProductSymmetry(const DenseProductGraph& product,
+                                 const std::vector<GraphView>& views)
+    : product(&product), views(&views) {
+    for (const auto& view : views) {
+        caches.push_back(std::make_unique<Cache>());
+        caches.back()->max_entries
+            = SYMMETRY_CACHE_MAX_BYTES
+              / (sizeof(uint32_t) * (view.graph().get_num_nodes() + 1));
+    }
+}
+
+std::optional<ProductSymmetry> ProductSymmetry::build(
+    const DenseProductGraph& product, const std::vector<GraphView>& views) {
+    for (const auto& view : views) {
+        if (!VertexOrbits(view).trivial()) {
+            return ProductSymmetry(product, views);
+        }
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<const VertexOrbits> ProductSymmetry::stabilizer(
+    size_t graph, const std::vector<VertexId>& fixed) const {
+    Cache& cache = *caches[graph];
+    {
+        std::lock_guard lock(cache.mutex);
+        const auto it = cache.stabilizers.find(fixed);
+        if (it != cache.stabilizers.end()) {
+            return it->second;
+        }
+    }
+    auto orbits = std::make_shared<const VertexOrbits>((*views)[graph], fixed);
+    std::lock_guard lock(cache.mutex);
+    if (cache.stabilizers.size() < cache.max_entries) {
+        cache.stabilizers.try_emplace(fixed, orbits);
+    }
+    return orbits;
+}
+
+void ProductSymmetry::orbits(std::span<const uint32_t> prefix,
+                             const uint64_t* candidates,
+                             ProductOrbits& orbits) const {
+    const size_t k = product->num_graphs;
+    std::vector<std::shared_ptr<const VertexOrbits>> components;
+    components.reserve(k);
+    std::vector<VertexId> fixed;
+    orbits.exact = true;
+    for (size_t g = 0; g < k; ++g) {
+        // The pointwise stabilizer does not depend on the order
+        fixed.clear();
+        for (const auto p : prefix) {
+            fixed.push_back(product->component(p, g));
+        }
+        std::ranges::sort(fixed);
+        fixed.erase(std::unique(fixed.begin(), fixed.end()), fixed.end());
+        components.push_back(stabilizer(g, fixed));
+        orbits.exact = orbits.exact && components.back()->complete();
+    }
+
+    orbits.orbit_of.resize(product->num_vertices);
+    orbits.members.clear();
+    std::map<std::vector<uint32_t>, uint32_t> ids;
+    std::vector<uint32_t> key(k);
+    mcis::bitset::for_each_bit(
+        candidates, product->words_per_row, [&](size_t p) {
+            for (size_t g = 0; g < k; ++g) {
+                key[g] = components[g]->orbit(product->component(p, g));
+            }
+            orbits.orbit_of[p]
+                = ids.try_emplace(key, static_cast<uint32_t>(ids.size()))
+                      .first->second;
+            orbits.members.push_back(static_cast<uint32_t>(p));
+        });
+    orbits.num_orbits = ids.size();
+    orbits.num_members = orbits.members.size();
+
+    // Counting sort of the candidates by orbit
+    orbits.offsets.assign(ids.size() + 1, 0);
+    for (const auto p : orbits.members) {
+        ++orbits.offsets[orbits.orbit_of[p] + 1];
+    }
+    for (size_t o = 0; o < ids.size(); ++o) {
+        orbits.offsets[o + 1] += orbits.offsets[o];
+    }
+    std::vector<uint32_t> next(orbits.offsets.begin(),
+                               orbits.offsets.end() - 1);
+    std::vector<uint32_t> sorted(orbits.members.size());
+    for (const auto p : orbits.members) {
+        sorted[next[orbits.orbit_of[p]]++] = p;
+    }
+    orbits.members.swap(sorted);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file product_orbits.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_PRODUCT_ORBITS_H_
+#define SRC_ALGORITHMS_PRODUCT_ORBITS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "mcis/dense_product_graph.h"
+#include "mcis/graph_view.h"
+#include "mcis/vertex_orbits.h"
+
+/**
+ * @brief Clique searches break symmetry at search nodes whose prefix has
+ * fewer vertices than this. Stabilizers usually become trivial well before,
+ * which ends symmetry breaking below them anyway.
+ */
+constexpr size_t SYMMETRY_BREAKING_MAX_DEPTH = 64;
+
+/**
+ * @brief Largest size (in bytes) of the stabilizer orbits ProductSymmetry
+ * keeps per input graph; further ones are recomputed at every use.
+ */
+constexpr size_t SYMMETRY_CACHE_MAX_BYTES = size_t{64} << 20;
+
+/**
+ * @class ProductOrbits
+ * @brief Orbits of a node's candidates under the stabilizer of its prefix,
+ * as computed by ProductSymmetry. Storage is reused between nodes.
+ */
+class ProductOrbits {
+ public:
+    /**
+     * @brief Removes every candidate in p's orbit from a candidate row.
+     * @param p A product vertex that was a candidate when the orbits were
+     * computed.
+     * @param candidates Row of words_per_row words.
+     * @return The number of vertices other than p that were removed.
+     */
+    size_t remove_orbit(uint32_t p, uint64_t* candidates) const;
+
+    /**
+     * @brief Checks whether some candidates share an orbit.
+     */
+    bool trivial() const { return num_orbits == num_members; }
+
+    /**
+     * @brief Checks whether the orbits are exact, so deeper search nodes
+     * may break symmetry under their smaller stabilizers.
+     */
+    bool complete() const { return exact; }
+
+ private:
+    friend class ProductSymmetry;
+
+    std::vector<uint32_t> orbit_of;
+
+    /**
+     * @brief Candidates of orbit o are members[offsets[o]..offsets[o + 1]).
+     */
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> members;
+    size_t num_orbits = 0;
+    size_t num_members = 0;
+    bool exact = true;
+};
+
+/**
+ * @class ProductSymmetry
+ * @brief Symmetries of a product graph that come from the automorphisms of
+ * its input views, applied to every graph of the tuple at once. Each input
+ * automorphism keeps tags, degrees, levels and edge directions within its
+ * view, so it maps kept tuples to kept tuples and product edges to product
+ * edges; two product vertices share an orbit when every component pair
+ * does.
+ *
+ * This makes symmetry breaking in the clique searches exact. At a search
+ * node with prefix R whose candidates are closed under the automorphisms
+ * fixing R, once the branch on v is finished every clique through a
+ * candidate of v's orbit is the image of one through v, so the whole orbit
+ * can leave the candidates; what is left stays closed under the smaller
+ * stabilizer of each child's prefix.
+ *
+ * Search nodes share few distinct sets of fixed vertices per input graph, so
+ * the orbits of each graph's stabilizers are cached by fixed set.
+ */
+class ProductSymmetry {
+ public:
+    /**
+     * @brief Checks the views for symmetry.
+     * @param product The product graph built from the views, in any order.
+     * @param views One view per input graph; must outlive the result.
+     * @return The symmetries, or std::nullopt if no view has any.
+     */
+    static std::optional<ProductSymmetry> build(
+        const DenseProductGraph& product, const std::vector<GraphView>& views);
+
+    /**
+     * @brief Computes the orbits of a search node's candidates under the
+     * automorphisms that fix every prefix vertex. Safe to call from several
+     * threads.
+     * @param prefix The node's clique.
+     * @param candidates The node's candidate row.
+     * @param orbits Receives the orbits.
+     */
+    void orbits(std::span<const uint32_t> prefix, const uint64_t* candidates,
+                ProductOrbits& orbits) const;
+
+ private:
+    using VertexId = CompactGraph::VertexId;
+
+    struct Cache {
+        size_t max_entries = 0;
+        std::mutex mutex;
+        std::map<std::vector<VertexId>, std::shared_ptr<const VertexOrbits>>
+            stabilizers;
+    };
+
+    ProductSymmetry(const DenseProductGraph& product,
+                    const std::vector<GraphView>& views);
+
+    /**
+     * @brief Retrieves the orbits of one graph's pointwise stabilizer of a
+     * sorted set of vertices, computing them on a cache miss.
+     */
+    std::shared_ptr<const VertexOrbits> stabilizer(
+        size_t graph, const std::vector<VertexId>& fixed) const;
+
+    const DenseProductGraph* product;
+    const std::vector<GraphView>* views;
+    std::vector<std::unique_ptr<Cache>> caches;
+};
+
+#endif  // SRC_ALGORITHMS_PRODUCT_ORBITS_H_
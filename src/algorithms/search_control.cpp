@@ -0,0 +1,110 @@
+/**
+ * @file search_control.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "./search_control.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+SearchControl::SearchControl(
+    const RunOptions& options,
+    std::optional<std::chrono::milliseconds> default_limit, size_t upper_bound)
+    : options(options),
+      start(std::chrono::steady_clock::now()),
+      deadline(std::chrono::steady_clock::time_point::max()),
+      upper(upper_bound),
+      next_progress(start + options.progress_interval) {
+    if (options.time_limit) {
+        deadline = start + *options.time_limit;
+    } else if (!options.deadline && default_limit) {
+        deadline = start + *default_limit;
+    }
+    if (options.deadline) {
+        deadline = std::min(deadline, *options.deadline);
+    }
+    // A search cancelled or out of time before it starts does no work
+    if (options.stop_token.stop_requested()) {
+        halt(SearchStatus::CANCELLED);
+    } else if (start > deadline) {
+        halt(SearchStatus::TIME_LIMIT);
+    }
+}
+
+void SearchControl::halt(SearchStatus reason) {
+    SearchStatus expected = SearchStatus::COMPLETE;
+    status.compare_exchange_strong(expected, reason);
+    stop.store(true, std::memory_order_relaxed);
+}
+
+bool SearchControl::check(uint64_t new_expansions, size_t incumbent) {
+    const uint64_t total
+        = expansions.fetch_add(new_expansions, std::memory_order_relaxed)
+          + new_expansions;
+    if (stopped()) {
+        return true;
+    }
+    if (options.stop_token.stop_requested()) {
+        halt(SearchStatus::CANCELLED);
+    } else if (options.expansion_budget && total >= *options.expansion_budget) {
+        halt(SearchStatus::BUDGET_EXHAUSTED);
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now > deadline) {
+        halt(SearchStatus::TIME_LIMIT);
+    }
+    if (options.progress && now >= next_progress) {
+        // A worker that finds the callback busy skips this report
+        std::unique_lock lock(progress_mutex, std::try_to_lock);
+        if (lock.owns_lock() && now >= next_progress) {
+            next_progress = now + options.progress_interval;
+            options.progress(snapshot(incumbent));
+        }
+    }
+    return stopped();
+}
+
+void SearchControl::bound(size_t upper_bound) {
+    size_t current = upper.load(std::memory_order_relaxed);
+    while (upper_bound < current
+           && !upper.compare_exchange_weak(current, upper_bound,
+                                           std::memory_order_relaxed)) {
+    }
+}
+
+SearchProgress SearchControl::snapshot(size_t incumbent) const {
+    SearchProgress progress;
+    progress.incumbent_size = incumbent;
+    progress.upper_bound
+        = std::max(incumbent, upper.load(std::memory_order_relaxed));
+    progress.expansions = expansions.load(std::memory_order_relaxed);
+    progress.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return progress;
+}
+
+void SearchControl::finish(size_t best_size, bool exhaustive) {
+    if (exhaustive && !stopped()) {
+        bound(best_size);
+    }
+    const SearchProgress last = snapshot(best_size);
+    if (options.report != nullptr) {
+        options.report->status = status.load();
+        options.report->best_size = best_size;
+        options.report->upper_bound = last.upper_bound;
+        options.report->expansions = last.expansions;
+        options.report->elapsed = last.elapsed;
+    }
+    if (options.progress) {
+        std::lock_guard lock(progress_mutex);
+        options.progress(last);
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file search_control.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_ALGORITHMS_SEARCH_CONTROL_H_
+#define SRC_ALGORITHMS_SEARCH_CONTROL_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "mcis/run_options.h"
+
+/**
+ * @class SearchControl
+ * @brief The limits, cancellation and progress reporting of one search,
+ * shared by all of its workers. Workers count expansions locally and call
+ * check() every CHECK_INTERVAL of them, so the clock is read rarely and the
+ * shared counters are touched once per interval.
+ */
+class SearchControl {
+ public:
+    /**
+     * @brief Expansions a worker performs between two calls of check().
+     */
+    static constexpr uint64_t CHECK_INTERVAL = 1024;
+
+    /**
+     * @param options The run's limits, token, callback and report.
+     * @param default_limit Time limit used when options set none.
+     * @param upper_bound Initial bound on the best solution size.
+     */
+    SearchControl(const RunOptions& options,
+                  std::optional<std::chrono::milliseconds> default_limit,
+                  size_t upper_bound);
+
+    bool stopped() const { return stop.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief The run's metrics, or nullptr if it collects none.
+     */
+    SearchMetrics* metrics() const { return options.metrics; }
+
+    /**
+     * @brief Adds a worker's expansions since its last call, checks the
+     * token, budget and deadline, and reports progress when it is due.
+     * @param new_expansions Expansions since the worker's last call.
+     * @param incumbent Size of the best solution known to the worker.
+     * @return True if the search should stop.
+     */
+    bool check(uint64_t new_expansions, size_t incumbent);
+
+    /**
+     * @brief Adds a worker's last expansions when it finishes.
+     */
+    void count(uint64_t new_expansions) {
+        expansions.fetch_add(new_expansions, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Lowers the upper bound on the best solution size.
+     */
+    void bound(size_t upper_bound);
+
+    /**
+     * @brief Fills the report and makes the final progress call.
+     * @param best_size Size of the returned solution.
+     * @param exhaustive Whether the search covered its whole space, which
+     * proves best_size optimal for the exact finders.
+     */
+    void finish(size_t best_size, bool exhaustive);
+
+ private:
+    const RunOptions& options;
+    const std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point deadline;
+    std::atomic<uint64_t> expansions{0};
+    std::atomic<size_t> upper;
+    std::atomic<bool> stop{false};
+    std::atomic<SearchStatus> status{SearchStatus::COMPLETE};
+    std::mutex progress_mutex;
+    std::chrono::steady_clock::time_point next_progress;
+
+    void halt(SearchStatus reason);
+    SearchProgress snapshot(size_t incumbent) const;
+};
+
+#endif  // SRC_ALGORITHMS_SEARCH_CONTROL_H_
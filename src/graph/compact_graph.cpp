@@ -0,0 +1,253 @@
+/**
+ * @file compact_graph.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <mcis/compact_graph.h>
+#include <mcis/graph.h>
+#include <mcis/graph_view.h>
+#include <mcis/reachability_index.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Row offsets of a graph without vertices
+constexpr uint32_t EMPTY_OFFSETS[1] = {0};
+
+/**
+ * @brief Heap storage behind a CompactGraph built in memory.
+ */
+struct OwnedArrays {
+    std::vector<CompactGraph::TagId> node_tags;
+    std::vector<uint32_t> out_offsets;
+    std::vector<CompactGraph::VertexId> out_targets;
+    std::vector<int> out_weights;
+    std::vector<uint32_t> in_offsets;
+    std::vector<CompactGraph::VertexId> in_sources;
+    std::vector<int> in_weights;
+};
+
+}  // namespace
+
+struct CompactGraph::LazyAnalyses {
+    std::once_flag reachability_once;
+    std::unique_ptr<ReachabilityIndex> reachability;
+
+    // Empty once ids holds every name
+    NameFunction name_of;
+    std::once_flag ids_once;
+    std::vector<std::string> ids;
+
+    std::once_flag id_index_once;
+    std::unordered_map<std::string, VertexId> id_to_index;
+};
+
+CompactGraph::CompactGraph()
+    : out_offsets(EMPTY_OFFSETS),
+      in_offsets(EMPTY_OFFSETS),
+      analyses(std::make_shared<LazyAnalyses>()) {}
+
+CompactGraph::CompactGraph(std::vector<std::string> ids,
+                           std::vector<TagId> node_tags,
+                           std::vector<std::string> tag_table,
+                           std::vector<uint32_t> out_offsets,
+                           std::vector<VertexId> out_targets,
+                           std::vector<int> out_weights)
+    : CompactGraph(NameFunction(), std::move(node_tags), std::move(tag_table),
+                   std::move(out_offsets), std::move(out_targets),
+                   std::move(out_weights)) {
+    analyses->ids = std::move(ids);
+}
+
+CompactGraph::CompactGraph(NameFunction name_of, std::vector<TagId> node_tags,
+                           std::vector<std::string> tag_table,
+                           std::vector<uint32_t> out_offsets,
+                           std::vector<VertexId> out_targets,
+                           std::vector<int> out_weights)
+    : tag_table(std::move(tag_table)),
+      analyses(std::make_shared<LazyAnalyses>()) {
+    analyses->name_of = std::move(name_of);
+    auto arrays = std::make_shared<OwnedArrays>();
+    arrays->node_tags = std::move(node_tags);
+    arrays->out_offsets = std::move(out_offsets);
+    arrays->out_targets = std::move(out_targets);
+    arrays->out_weights = std::move(out_weights);
+    const auto n = static_cast<uint32_t>(arrays->node_tags.size());
+    if (arrays->out_offsets.empty()) {
+        arrays->out_offsets.assign(n + 1, 0);
+    }
+    std::vector<uint32_t>& offsets = arrays->out_offsets;
+    std::vector<VertexId>& targets = arrays->out_targets;
+    std::vector<int>& weights = arrays->out_weights;
+
+    // Sort each out-row by target so has_edge can binary search
+    std::vector<std::pair<VertexId, int>> row;
+    for (VertexId v = 0; v < n; ++v) {
+        const uint32_t begin = offsets[v];
+        const uint32_t end = offsets[v + 1];
+        if (std::is_sorted(targets.begin() + begin, targets.begin() + end)) {
+            continue;
+        }
+        row.clear();
+        for (uint32_t e = begin; e < end; ++e) {
+            row.emplace_back(targets[e], weights[e]);
+        }
+        std::sort(row.begin(), row.end());
+        for (uint32_t e = begin; e < end; ++e) {
+            targets[e] = row[e - begin].first;
+            weights[e] = row[e - begin].second;
+        }
+    }
+
+    // Counting sort of the out-edges into the in-edge CSR; scanning sources
+    // in ascending order keeps every in-row sorted
+    std::vector<uint32_t>& in_offs = arrays->in_offsets;
+    in_offs.assign(n + 1, 0);
+    for (VertexId target : targets) {
+        ++in_offs[target + 1];
+    }
+    std::partial_sum(in_offs.begin(), in_offs.end(), in_offs.begin());
+
+    arrays->in_sources.resize(targets.size());
+    arrays->in_weights.resize(targets.size());
+    std::vector<uint32_t> cursor(in_offs.begin(), in_offs.end() - 1);
+    for (VertexId v = 0; v < n; ++v) {
+        for (uint32_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+            uint32_t slot = cursor[targets[e]]++;
+            arrays->in_sources[slot] = v;
+            arrays->in_weights[slot] = weights[e];
+            is_weighted = is_weighted || (weights[e] != 0);
+        }
+    }
+
+    this->node_tags = arrays->node_tags;
+    this->out_offsets = arrays->out_offsets;
+    this->out_targets = arrays->out_targets;
+    this->out_weights = arrays->out_weights;
+    this->in_offsets = arrays->in_offsets;
+    this->in_sources = arrays->in_sources;
+    this->in_weights = arrays->in_weights;
+    storage = std::move(arrays);
+}
+
+CompactGraph::CompactGraph(
+    std::shared_ptr<const void> storage, NameFunction name_of,
+    std::vector<std::string> tag_table, std::span<const TagId> node_tags,
+    std::span<const uint32_t> out_offsets,
+    std::span<const VertexId> out_targets, std::span<const int> out_weights,
+    std::span<const uint32_t> in_offsets, std::span<const VertexId> in_sources,
+    std::span<const int> in_weights, bool is_weighted)
+    : node_tags(node_tags),
+      tag_table(std::move(tag_table)),
+      out_offsets(out_offsets),
+      out_targets(out_targets),
+      out_weights(out_weights),
+      in_offsets(in_offsets),
+      in_sources(in_sources),
+      in_weights(in_weights),
+      is_weighted(is_weighted),
+      storage(std::move(storage)),
+      analyses(std::make_shared<LazyAnalyses>()) {
+    analyses->name_of = std::move(name_of);
+}
+
+bool CompactGraph::has_edge(VertexId from, VertexId to) const {
+    auto row = out_neighbors(from);
+    return std::binary_search(row.begin(), row.end(), to);
+}
+
+std::optional<CompactGraph::VertexId> CompactGraph::get_index(
+    const std::string& id) const {
+    std::call_once(analyses->id_index_once, [this] {
+        const std::vector<std::string>& ids = names();
+        analyses->id_to_index.reserve(ids.size());
+        for (VertexId v = 0; v < ids.size(); ++v) {
+            analyses->id_to_index.emplace(ids[v], v);
+        }
+    });
+    auto it = analyses->id_to_index.find(id);
+    if (it == analyses->id_to_index.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<CompactGraph::TagId> CompactGraph::find_tag(
+    const std::string& tag) const {
+    for (TagId t = 0; t < tag_table.size(); ++t) {
+        if (tag_table[t] == tag) {
+            return t;
+        }
+    }
+    return std::nullopt;
+}
+
+CompactGraph CompactGraph::get_subgraph_with_tag(const std::string& tag) const {
+    if (!find_tag(tag)) {
+        return CompactGraph();
+    }
+    return GraphView(*this, tag).materialize();
+}
+
+const ReachabilityIndex& CompactGraph::reachability() const {
+    std::call_once(analyses->reachability_once, [this] {
+        analyses->reachability = std::make_unique<ReachabilityIndex>(*this);
+    });
+    return *analyses->reachability;
+}
+
+const std::vector<std::string>& CompactGraph::names() const {
+    std::call_once(analyses->ids_once, [this] {
+        if (!analyses->name_of) {
+            return;
+        }
+        const auto n = static_cast<int64_t>(get_num_nodes());
+        analyses->ids.resize(n);
+#pragma omp parallel for schedule(static)
+        for (int64_t v = 0; v < n; ++v) {
+            analyses->ids[v] = analyses->name_of(static_cast<VertexId>(v));
+        }
+        analyses->name_of = nullptr;
+    });
+    return analyses->ids;
+}
+
+Graph CompactGraph::thaw() const {
+    const std::vector<std::string>& ids = names();
+    Graph graph;
+    graph.reserve_nodes(get_num_nodes());
+    graph.add_node_set(ids);
+    for (VertexId v = 0; v < get_num_nodes(); ++v) {
+        if (!get_tag(v).empty()) {
+            graph.set_node_tag(ids[v], get_tag(v));
+        }
+    }
+    std::vector<std::string> children;
+    for (VertexId v = 0; v < get_num_nodes(); ++v) {
+        auto targets = out_neighbors(v);
+        if (targets.empty()) {
+            continue;
+        }
+        children.clear();
+        for (VertexId target : targets) {
+            children.push_back(ids[target]);
+        }
+        auto weights = out_edge_weights(v);
+        graph.add_edge_set(ids[v], children,
+                           std::vector<int>(weights.begin(), weights.end()));
+    }
+    return graph;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file csr_generator.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_GRAPH_CSR_GENERATOR_H_
+#define SRC_GRAPH_CSR_GENERATOR_H_
+
+#include <omp.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mcis/compact_graph.h"
+
+/**
+ * @struct GeneratedCsr
+ * @brief Out-edge CSR arrays of a generated graph, ready for CompactGraph.
+ */
+struct GeneratedCsr {
+    std::vector<uint32_t> offsets;
+    std::vector<CompactGraph::VertexId> targets;
+    std::vector<int> weights;
+};
+
+/**
+ * @brief Builds the out-edge CSR of a graph whose edges follow closed-form
+ * index formulas, so every row is computed independently and in parallel.
+ * All weights are 0.
+ * @param num_vertices Number of vertices.
+ * @param out_degree out_degree(v) is the number of out-edges of v.
+ * @param fill fill(v, row) writes the out_degree(v) targets of v, ascending.
+ * @param num_threads Number of threads (0 for the OpenMP default).
+ * @return The CSR arrays.
+ */
+template <typename Degree, typename Fill>
+GeneratedCsr generate_csr(uint32_t num_vertices, Degree out_degree, Fill fill,
+                          int num_threads) {
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+    const auto n = static_cast<int64_t>(num_vertices);
+    GeneratedCsr csr;
+    csr.offsets.assign(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t v = 0; v < n; ++v) {
+        csr.offsets[v + 1] = out_degree(static_cast<CompactGraph::VertexId>(v));
+    }
+    for (uint32_t v = 0; v < num_vertices; ++v) {
+        csr.offsets[v + 1] += csr.offsets[v];
+    }
+
+    csr.targets.resize(csr.offsets.back());
+    csr.weights.assign(csr.offsets.back(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t v = 0; v < n; ++v) {
+        fill(static_cast<CompactGraph::VertexId>(v),
+             csr.targets.data() + csr.offsets[v]);
+    }
+    return csr;
+}
+
+#endif  // SRC_GRAPH_CSR_GENERATOR_H_
@@ -11,15 +11,107 @@
 #include <mcis/graph.h>
 #include <omp.h>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <expected>
 #include <iostream>
+#include <memory>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "./csr_generator.h"
+#include "./signal_kernels.h"
 #include "mcis/errors.h"
+#include "mcis/graph_batch.h"
 
-const double SQRT2 = sqrt(2);
+namespace {
+
+// Moves the graphs the caller asked for into the result
+std::vector<Graph> selected_graphs(HaarWaveletGraph type, Graph&& average,
+                                   Graph&& coefficient) {
+    std::vector<Graph> graphs;
+    graphs.reserve(2);
+    if (type != HaarWaveletGraph::PRUNED_COEFFICIENT) {
+        graphs.push_back(std::move(average));
+    }
+    if (type != HaarWaveletGraph::PRUNED_AVERAGE) {
+        graphs.push_back(std::move(coefficient));
+    }
+    return graphs;
+}
+
+// Builds the topology of the signal-driven graphs. Vertices are s_i, then
+// the average levels 0, 1, ..., d - 1 and, in the coefficient graph, the
+// coefficient levels; level l of either starts n - (n >> l) after its first
+// level and node j of it combines nodes 2j and 2j + 1 of the level below.
+CompactGraph haar_signal_topology(uint32_t n, bool coeff, int num_threads) {
+    const auto levels = static_cast<uint32_t>(std::countr_zero(n));
+    const uint32_t averages = n;
+    const uint32_t coefficients = 2 * n - 1;
+    const uint32_t num_vertices = coeff ? 3 * n - 2 : 2 * n - 1;
+    // Level of the node at offset o into the averages or coefficients
+    auto level_of = [=](uint32_t o) {
+        return levels - static_cast<uint32_t>(std::bit_width(n - o - 1));
+    };
+    auto level_start = [=](uint32_t level) { return n - (n >> level); };
+
+    // Inputs of level 0 are the samples, and inputs of level l + 1 the
+    // averages of level l. Coefficients have no out-edges.
+    auto next = [=](CompactGraph::VertexId v, uint32_t& o) {
+        if (v < averages) {
+            o = v / 2;
+            return levels > 0;
+        }
+        const uint32_t level = level_of(v - averages);
+        if (v >= coefficients || level + 1 == levels) {
+            return false;
+        }
+        o = level_start(level + 1) + (v - averages - level_start(level)) / 2;
+        return true;
+    };
+    auto out_degree = [=](CompactGraph::VertexId v) -> uint32_t {
+        uint32_t o = 0;
+        return next(v, o) ? (coeff ? 2 : 1) : 0;
+    };
+    auto fill = [=](CompactGraph::VertexId v, CompactGraph::VertexId* row) {
+        uint32_t o = 0;
+        if (next(v, o)) {
+            row[0] = averages + o;
+            if (coeff) {
+                row[1] = coefficients + o;
+            }
+        }
+    };
+    GeneratedCsr csr = generate_csr(num_vertices, out_degree, fill, num_threads);
+
+    std::vector<CompactGraph::TagId> node_tags(num_vertices, 0);
+    std::fill(node_tags.begin() + averages, node_tags.begin() + coefficients,
+              1);
+    std::fill(node_tags.begin() + coefficients, node_tags.end(), 2);
+    auto name_of = [=](CompactGraph::VertexId v) {
+        if (v < averages) {
+            return "s_" + std::to_string(v);
+        }
+        const bool is_coeff = v >= coefficients;
+        const uint32_t o = v - (is_coeff ? coefficients : averages);
+        const uint32_t level = level_of(o);
+        return (is_coeff ? "d^" : "a^") + std::to_string(level) + "_"
+               + std::to_string(o - level_start(level));
+    };
+    std::vector<std::string> tag_table{"", "+/sqrt(2)"};
+    if (coeff) {
+        tag_table.push_back("-/sqrt(2)");
+    }
+    return CompactGraph(name_of, std::move(node_tags), std::move(tag_table),
+                        std::move(csr.offsets), std::move(csr.targets),
+                        std::move(csr.weights));
+}
+
+}  // namespace
 
 std::expected<std::vector<Graph>, mcis::GraphError>
 Graph::create_haar_wavelet_transform_graph_from_dimensions(
@@ -90,13 +182,89 @@ Graph::create_haar_wavelet_transform_graph_from_dimensions(
         }
     }
 
-    if (type == HaarWaveletGraph::PRUNED_AVERAGE) {
-        return std::vector<Graph>{pruned_avg_graph};
+    return selected_graphs(type, std::move(pruned_avg_graph),
+                           std::move(pruned_coeff_graph));
+}
+
+std::expected<std::vector<CompactGraph>, mcis::GraphError>
+CompactGraph::create_haar_wavelet_transform_graph_from_dimensions(
+    int n, int d, int k, HaarWaveletGraph type, int num_threads) {
+    if (n <= 0 || d <= 0 || d >= 31 || k <= 0) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+    const uint64_t num_signals = uint64_t{static_cast<uint32_t>(k)} << d;
+    if (n % num_signals != 0 || 2 * num_signals > UINT32_MAX) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+
+    // Vertices are s_i followed by level 0, 1, ..., d - 1 of the transform;
+    // vertex signals + k * (2^d - 2^(d - level)) + j is node j of a level
+    const auto signals = static_cast<uint32_t>(num_signals);
+    const auto blocks = static_cast<uint32_t>(k);
+    const uint32_t levels = static_cast<uint32_t>(d);
+    const uint32_t num_vertices = 2 * signals - blocks;
+    auto level_start = [=](uint32_t level) -> VertexId {
+        return signals + blocks * ((1u << levels) - (1u << (levels - level)));
+    };
+    auto level_of = [=](VertexId v) {
+        uint32_t level = 0;
+        while (level + 1 < levels && v >= level_start(level + 1)) {
+            ++level;
+        }
+        return level;
+    };
+
+    auto build = [&](bool coeff) {
+        // Node j of a level averages nodes 2j and 2j + 1 of the level below.
+        // The coefficient graph keeps only the first level's edges: its
+        // deeper nodes take averages, which are pruned from it.
+        auto out_degree = [=](VertexId v) -> uint32_t {
+            if (v < signals) {
+                return 1;
+            }
+            return !coeff && level_of(v) + 1 < levels ? 1 : 0;
+        };
+        auto fill = [=](VertexId v, VertexId* row) {
+            if (v < signals) {
+                row[0] = signals + v / 2;
+            } else if (!coeff) {
+                const uint32_t level = level_of(v);
+                if (level + 1 < levels) {
+                    row[0] = level_start(level + 1)
+                             + (v - level_start(level)) / 2;
+                }
+            }
+        };
+        GeneratedCsr csr
+            = generate_csr(num_vertices, out_degree, fill, num_threads);
+
+        std::vector<TagId> node_tags(num_vertices, 1);
+        std::fill(node_tags.begin(), node_tags.begin() + signals, 0);
+        const std::string prefix = coeff ? "d^" : "a^";
+        auto name_of = [=](VertexId v) {
+            if (v < signals) {
+                return "s_" + std::to_string(v);
+            }
+            const uint32_t level = level_of(v);
+            return prefix + std::to_string(level) + "_"
+                   + std::to_string(v - level_start(level));
+        };
+        return CompactGraph(name_of, std::move(node_tags),
+                            {"", coeff ? "-/sqrt(2)" : "+/sqrt(2)"},
+                            std::move(csr.offsets), std::move(csr.targets),
+                            std::move(csr.weights));
+    };
+
+    std::vector<CompactGraph> graphs;
+    if (type == HaarWaveletGraph::PRUNED_AVERAGE
+        || type == HaarWaveletGraph::BOTH) {
+        graphs.push_back(build(false));
     }
-    if (type == HaarWaveletGraph::PRUNED_COEFFICIENT) {
-        return std::vector<Graph>{pruned_coeff_graph};
+    if (type == HaarWaveletGraph::PRUNED_COEFFICIENT
+        || type == HaarWaveletGraph::BOTH) {
+        graphs.push_back(build(true));
     }
-    return std::vector<Graph>{pruned_avg_graph, pruned_coeff_graph};
+    return graphs;
 }
 
 std::ostream& operator<<(std::ostream& os,
@@ -119,116 +287,116 @@ std::ostream& operator<<(std::ostream& os,
 std::expected<std::vector<Graph>, mcis::GraphError>
 Graph::create_haar_wavelet_transform_graph_from_signal(
     const std::vector<double>& signal, HaarWaveletGraph type) {
-    int n = static_cast<int>(signal.size());
-    if (n <= 0 || (n & (n - 1)) != 0) {
-        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    auto graphs = create_haar_wavelet_transform_graphs_from_signals({signal},
+                                                                    type);
+    if (!graphs) {
+        return std::unexpected(graphs.error());
     }
-    int d = static_cast<int>(log2(n));
+    return std::move(graphs->front());
+}
 
-    Graph pruned_avg_graph;
-    Graph pruned_coeff_graph;
+std::expected<std::vector<std::vector<Graph>>, mcis::GraphError>
+Graph::create_haar_wavelet_transform_graphs_from_signals(
+    const std::vector<std::vector<double>>& signals, HaarWaveletGraph type) {
+    auto batches
+        = GraphBatch::create_haar_wavelet_transform_batch_from_signals(signals,
+                                                                       type);
+    if (!batches) {
+        return std::unexpected(batches.error());
+    }
 
-    std::vector<std::vector<double>> averages(d);
-    std::vector<std::vector<double>> coefficients(d);
-
-    for (int i = 0; i < d; ++i) {
-        int size = n / (1 << (i + 1));
-        averages[i].resize(size);
-        coefficients[i].resize(size);
-    }
-
-    std::vector<double> current_level_signal = signal;
-    for (int i = 0; i < d; ++i) {
-        int current_size = n / (1 << i);
-        int next_size = n / (1 << (i + 1));
-        std::vector<double> next_level_averages(next_size);
-
-        for (int j = 0; j < next_size; ++j) {
-            averages[i][j] = (current_level_signal[2 * j]
-                              + current_level_signal[2 * j + 1])
-                             / SQRT2;
-            coefficients[i][j] = (current_level_signal[2 * j]
-                                  - current_level_signal[2 * j + 1])
-                                 / SQRT2;
-            next_level_averages[j] = averages[i][j];
+    // Each channel's graphs are independent
+    std::vector<std::vector<Graph>> results(signals.size());
+    const auto num_channels = static_cast<int64_t>(signals.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < num_channels; ++c) {
+        for (const auto& batch : *batches) {
+            results[c].push_back(batch.materialize(c));
         }
-        current_level_signal = next_level_averages;
     }
+    return results;
+}
 
-    auto build_graph = [&](Graph& graph, bool is_coeff_graph) {
-        for (int i = 0; i < n; ++i) {
-            graph.add_node("s_" + std::to_string(i));
-            graph.set_node_tag("s_" + std::to_string(i),
-                               std::to_string(signal[i]));
+std::expected<std::vector<GraphBatch>, mcis::GraphError>
+GraphBatch::create_haar_wavelet_transform_batch_from_signals(
+    const std::vector<std::vector<double>>& signals, HaarWaveletGraph type,
+    int num_threads) {
+    if (signals.empty()) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+    const size_t n = signals[0].size();
+    if (n == 0 || (n & (n - 1)) != 0 || n > UINT32_MAX / 4) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+    for (const auto& signal : signals) {
+        if (signal.size() != n) {
+            return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
         }
+    }
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+    const size_t channels = signals.size();
+    const int d = std::countr_zero(n);
 
-        for (int i = d; i > 0; --i) {
-            for (int j = 0; j < (n / (1 << i)); ++j) {
-                std::string avg_node_name
-                    = "a^" + std::to_string(d - i) + "_" + std::to_string(j);
-                graph.add_node(avg_node_name);
-                graph.set_node_tag(
-                    avg_node_name,
-                    "+/sqrt(2)," + std::to_string(averages[d - i][j]));
-
-                if (i == d) {
-                    graph.add_edge("s_" + std::to_string(2 * j), avg_node_name,
-                                   0);
-                    graph.add_edge("s_" + std::to_string(2 * j + 1),
-                                   avg_node_name, 0);
-                } else {
-                    graph.add_edge("a^" + std::to_string(d - i - 1) + "_"
-                                       + std::to_string(2 * j),
-                                   avg_node_name, 0);
-                    graph.add_edge("a^" + std::to_string(d - i - 1) + "_"
-                                       + std::to_string(2 * j + 1),
-                                   avg_node_name, 0);
-                }
-            }
+    // Interleave the channels so each butterfly is one vector operation
+    // across them, then transform the block in place. Level l's averages
+    // are the next level's input, so they are copied out first, in the
+    // order of the topology's average vertices.
+    std::vector<double> block(n * channels);
+    for (size_t c = 0; c < channels; ++c) {
+        for (size_t i = 0; i < n; ++i) {
+            block[i * channels + c] = signals[c][i];
         }
+    }
+    std::vector<double> averages((n - 1) * channels);
+    for (int level = 0; level < d; ++level) {
+        mcis::signal::haar_level_in_place(block.data(), n, channels, level);
+        const size_t stride = size_t{1} << level;
+        double* out = averages.data() + (n - (n >> level)) * channels;
+        for (size_t i = 0; i < n; i += 2 * stride) {
+            std::copy_n(block.data() + i * channels, channels, out);
+            out += channels;
+        }
+    }
 
-        if (is_coeff_graph) {
-            for (int i = d; i > 0; --i) {
-                for (int j = 0; j < (n / (1 << i)); ++j) {
-                    std::string coeff_node_name = "d^" + std::to_string(d - i)
-                                                  + "_" + std::to_string(j);
-                    graph.add_node(coeff_node_name);
-                    graph.set_node_tag(
-                        coeff_node_name,
-                        "-/sqrt(2)," + std::to_string(coefficients[d - i][j]));
-
-                    if (i == d) {
-                        graph.add_edge("s_" + std::to_string(2 * j),
-                                       coeff_node_name, 0);
-                        graph.add_edge("s_" + std::to_string(2 * j + 1),
-                                       coeff_node_name, 0);
-                    } else {
-                        graph.add_edge("a^" + std::to_string(d - i - 1) + "_"
-                                           + std::to_string(2 * j),
-                                       coeff_node_name, 0);
-                        graph.add_edge("a^" + std::to_string(d - i - 1) + "_"
-                                           + std::to_string(2 * j + 1),
-                                       coeff_node_name, 0);
+    auto make = [&](bool coeff) {
+        GraphBatch batch(std::make_shared<const CompactGraph>(
+                             haar_signal_topology(static_cast<uint32_t>(n),
+                                                  coeff, num_threads)),
+                         channels);
+        const auto num_channels = static_cast<int64_t>(channels);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t c = 0; c < num_channels; ++c) {
+            std::span<double> column = batch.values(c);
+            for (size_t i = 0; i < n; ++i) {
+                column[i] = signals[c][i];
+            }
+            for (size_t o = 0; o + 1 < n; ++o) {
+                column[n + o] = averages[o * channels + c];
+            }
+            if (coeff) {
+                // Coefficient j of level l stays at sample (2j + 1) * 2^l
+                double* out = column.data() + 2 * n - 1;
+                for (int level = 0; level < d; ++level) {
+                    const size_t stride = size_t{1} << level;
+                    for (size_t i = stride; i < n; i += 2 * stride) {
+                        *out++ = block[i * channels + c];
                     }
                 }
             }
         }
+        return batch;
     };
 
+    std::vector<GraphBatch> batches;
     if (type == HaarWaveletGraph::PRUNED_AVERAGE
         || type == HaarWaveletGraph::BOTH) {
-        build_graph(pruned_avg_graph, false);
+        batches.push_back(make(false));
     }
     if (type == HaarWaveletGraph::PRUNED_COEFFICIENT
         || type == HaarWaveletGraph::BOTH) {
-        build_graph(pruned_coeff_graph, true);
-    }
-
-    if (type == HaarWaveletGraph::PRUNED_AVERAGE) {
-        return std::vector<Graph>{pruned_avg_graph};
-    }
-    if (type == HaarWaveletGraph::PRUNED_COEFFICIENT) {
-        return std::vector<Graph>{pruned_coeff_graph};
+        batches.push_back(make(true));
     }
-    return std::vector<Graph>{pruned_avg_graph, pruned_coeff_graph};
+    return batches;
 }
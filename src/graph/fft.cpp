@@ -11,11 +11,23 @@
 #include <mcis/graph.h>
 #include <omp.h>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <complex>
+#include <cstdint>
 #include <expected>
+#include <memory>
+#include <numbers>
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "./csr_generator.h"
+#include "./signal_kernels.h"
 #include "mcis/errors.h"
+#include "mcis/graph_batch.h"
 
 // Cooley-Tukey FFT algorithm, specifically the decimation-in-time
 // (DIT) variant, which is a ecursive "divide and conquer" algorithm
@@ -98,3 +110,174 @@ std::expected<Graph, mcis::GraphError> Graph::create_fft_graph_from_dimensions(
 
     return graph;
 }
+
+std::expected<CompactGraph, mcis::GraphError>
+CompactGraph::create_fft_graph_from_dimensions(int n, int num_threads) {
+    if (n <= 0 || (n & (n - 1)) != 0) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+
+    // Level 0 holds x_i, levels 1..stages hold s<level>_i and level
+    // stages + 1 holds X_i; vertex level * n + i is the i-th of its level
+    const auto points = static_cast<uint32_t>(n);
+    const auto stages = static_cast<uint32_t>(std::countr_zero(points));
+    if (uint64_t{points} * (2 * stages + 2) > UINT32_MAX) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+    const uint32_t num_vertices = points * (stages + 2);
+
+    auto reverse_bits = [stages](uint32_t val) {
+        uint32_t reversed_val = 0;
+        for (uint32_t i = 0; i < stages; ++i) {
+            if ((val >> i) & 1) {
+                reversed_val |= 1u << (stages - 1 - i);
+            }
+        }
+        return reversed_val;
+    };
+
+    // With a single point there is no last stage, so X_0 stays unconnected
+    auto out_degree = [=](VertexId v) -> uint32_t {
+        const uint32_t level = v / points;
+        if (level < stages) {
+            return 2;
+        }
+        return level == stages && stages > 0 ? 1 : 0;
+    };
+    auto fill = [=](VertexId v, VertexId* row) {
+        const uint32_t level = v / points;
+        const uint32_t i = v % points;
+        const VertexId next = (level + 1) * points;
+        if (level < stages) {
+            // The butterfly of stage level + 1 pairs i with i ^ half
+            const uint32_t partner = i ^ (points >> (level + 1));
+            row[0] = next + std::min(i, partner);
+            row[1] = next + std::max(i, partner);
+        } else if (level == stages && stages > 0) {
+            row[0] = next + reverse_bits(i);
+        }
+    };
+    GeneratedCsr csr
+        = generate_csr(num_vertices, out_degree, fill, num_threads);
+
+    std::vector<TagId> node_tags(num_vertices, 0);
+    std::fill(node_tags.begin() + points,
+              node_tags.begin() + points * (stages + 1), 1);
+
+    auto name_of = [points, stages](VertexId v) {
+        const uint32_t level = v / points;
+        const std::string i = std::to_string(v % points);
+        if (level == 0) {
+            return "x_" + i;
+        }
+        if (level == stages + 1) {
+            return "X_" + i;
+        }
+        return "s" + std::to_string(level) + "_" + i;
+    };
+    return CompactGraph(name_of, std::move(node_tags), {"", "+/-*"},
+                        std::move(csr.offsets), std::move(csr.targets),
+                        std::move(csr.weights));
+}
+
+std::expected<Graph, mcis::GraphError> Graph::create_fft_graph_from_signal(
+    const std::vector<std::complex<double>>& signal, FftComponent component) {
+    auto batch = GraphBatch::create_fft_batch_from_signals({signal}, component);
+    if (!batch) {
+        return std::unexpected(batch.error());
+    }
+    return batch->materialize(0);
+}
+
+std::expected<GraphBatch, mcis::GraphError>
+GraphBatch::create_fft_batch_from_signals(
+    const std::vector<std::vector<std::complex<double>>>& signals,
+    FftComponent component, int num_threads) {
+    if (signals.empty() || signals[0].size() > INT32_MAX) {
+        return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+    }
+    const size_t n = signals[0].size();
+    for (const auto& signal : signals) {
+        if (signal.size() != n) {
+            return std::unexpected(mcis::GraphError::INVALID_PARAMETERS);
+        }
+    }
+    auto topology = CompactGraph::create_fft_graph_from_dimensions(
+        static_cast<int>(n), num_threads);
+    if (!topology) {
+        return std::unexpected(topology.error());
+    }
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+    GraphBatch batch(std::make_shared<const CompactGraph>(std::move(*topology)),
+                     signals.size());
+
+    auto value = [component](double re, double im) {
+        switch (component) {
+            case FftComponent::IMAGINARY:
+                return im;
+            case FftComponent::MAGNITUDE:
+                return std::hypot(re, im);
+            case FftComponent::REAL:
+            default:
+                return re;
+        }
+    };
+
+    // The butterflies of stage s pair i with i ^ (n >> s), which is the
+    // decimation-in-frequency order: the inputs stay in natural order and
+    // the last stage holds the spectrum bit-reversed, as the X_i edges
+    // expect. Stage s uses every (2^(s - 1))-th root of unity; its
+    // twiddles start at n - (n >> (s - 1)) in the table.
+    const int stages = std::countr_zero(n);
+    std::vector<double> w_re(n > 1 ? n - 1 : 0);
+    std::vector<double> w_im(w_re.size());
+    for (int stage = 1; stage <= stages; ++stage) {
+        const size_t half = n >> stage;
+        const size_t offset = n - (n >> (stage - 1));
+        for (size_t j = 0; j < half; ++j) {
+            const double angle = -std::numbers::pi * static_cast<double>(j)
+                                 / static_cast<double>(half);
+            w_re[offset + j] = std::cos(angle);
+            w_im[offset + j] = std::sin(angle);
+        }
+    }
+    std::vector<uint32_t> reversed(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (int b = 0; b < stages; ++b) {
+            if ((i >> b) & 1) {
+                reversed[i] |= 1u << (stages - 1 - b);
+            }
+        }
+    }
+
+    // Vertex level * n + i is point i of a level, as in the topology
+    const auto num_channels = static_cast<int64_t>(signals.size());
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t c = 0; c < num_channels; ++c) {
+        std::vector<double> re(n);
+        std::vector<double> im(n);
+        std::span<double> column = batch.values(c);
+        for (size_t i = 0; i < n; ++i) {
+            re[i] = signals[c][i].real();
+            im[i] = signals[c][i].imag();
+            column[i] = value(re[i], im[i]);
+        }
+        for (int stage = 1; stage <= stages; ++stage) {
+            const size_t offset = n - (n >> (stage - 1));
+            mcis::signal::fft_dif_stage(re.data(), im.data(), n, n >> stage,
+                                        w_re.data() + offset,
+                                        w_im.data() + offset);
+            double* out = column.data() + stage * n;
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = value(re[i], im[i]);
+            }
+        }
+        double* out = column.data() + (stages + 1) * n;
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = value(re[reversed[i]], im[reversed[i]]);
+        }
+    }
+    return batch;
+}
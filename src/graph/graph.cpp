@@ -9,12 +9,18 @@
  * This software is licensed under the MIT License.
  */
 #include <mcis/graph.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -22,228 +28,256 @@
 
 #include "./time.h"
 
+namespace {
+
+// Arena bytes reserved per node and per edge endpoint when copying a graph
+constexpr size_t ARENA_BYTES_PER_NODE = sizeof(Node) + 64;
+constexpr size_t ARENA_BYTES_PER_EDGE_END = 32;
+
+}  // namespace
+
 Graph::Graph() = default;
 
+Graph::Graph(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+
 Graph::Graph(const std::vector<Node>& node_list) {
     for (const auto& node : node_list) {
-        add_node(node.get_id());
+        add_node(std::string(node.get_id_view()));
     }
 }
 
-Graph::Graph(const Graph& other) {
-    std::unordered_map<Node*, Node*> node_map;
-    node_map.reserve(other.nodes.size());
-    for (const auto& pair : other.nodes) {
-        Node* old_node = pair.second;
-        Node* new_node = new Node(old_node->get_id());
-        new_node->set_tag(old_node->get_tag());
-        nodes[pair.first] = new_node;
-        node_map[old_node] = new_node;
-    }
-
-    for (const auto& pair : other.nodes) {
-        Node* old_node = pair.second;
-        Node* new_node = node_map[old_node];
-        for (const auto& child_pair : old_node->get_children()) {
-            Node* old_child = child_pair.first;
-            int weight = child_pair.second;
-            Node* new_child = node_map[old_child];
-            new_node->add_edge(new_child, weight);
-        }
-    }
-
-    is_weighted = other.is_weighted;
+Graph::Graph(const Graph& other)
+    : upstream(other.upstream), is_weighted(other.is_weighted) {
+    copy_nodes_from(other);
 }
 
 Graph& Graph::operator=(const Graph& other) {
     if (this != &other) {
-        // Clear existing nodes
-        for (auto& pair : nodes) {
-            delete pair.second;
-        }
-        nodes.clear();
-
-        std::unordered_map<Node*, Node*> node_map;
-        node_map.reserve(other.nodes.size());
-        for (const auto& pair : other.nodes) {
-            Node* old_node = pair.second;
-            Node* new_node = new Node(old_node->get_id());
-            new_node->set_tag(old_node->get_tag());
-            nodes[pair.first] = new_node;
-            node_map[old_node] = new_node;
-        }
-
-        for (const auto& pair : other.nodes) {
-            Node* old_node = pair.second;
-            Node* new_node = node_map[old_node];
-            for (const auto& child_pair : old_node->get_children()) {
-                Node* old_child = child_pair.first;
-                int weight = child_pair.second;
-                Node* new_child = node_map[old_child];
-                new_node->add_edge(new_child, weight);
-            }
-        }
-
+        upstream = other.upstream;
         is_weighted = other.is_weighted;
+        copy_nodes_from(other);
         invalidate_caches();
     }
     return *this;
 }
 
-Graph::Graph(Graph&& other) noexcept : nodes(std::move(other.nodes)) {
+Graph::Graph(Graph&& other) noexcept
+    : upstream(other.upstream),
+      arena(std::move(other.arena)),
+      nodes(std::move(other.nodes)),
+      is_weighted(other.is_weighted),
+      incremental_dag(other.incremental_dag),
+      dag_order(std::move(other.dag_order)),
+      dag_position(std::move(other.dag_position)),
+      dag_order_holes(other.dag_order_holes) {
     other.nodes.clear();
+    other.is_weighted = false;
+    other.disable_incremental_dag();
+    other.invalidate_caches();
 }
 
 Graph& Graph::operator=(Graph&& other) noexcept {
     if (this != &other) {
-        for (auto& pair : nodes) {
-            delete pair.second;
-        }
+        // Dropping the old arena frees the old nodes in bulk
         nodes = std::move(other.nodes);
+        arena = std::move(other.arena);
+        upstream = other.upstream;
+        is_weighted = other.is_weighted;
+        incremental_dag = other.incremental_dag;
+        dag_order = std::move(other.dag_order);
+        dag_position = std::move(other.dag_position);
+        dag_order_holes = other.dag_order_holes;
         other.nodes.clear();
+        other.is_weighted = false;
+        other.disable_incremental_dag();
+        other.invalidate_caches();
+        invalidate_caches();
     }
     return *this;
 }
 
-Graph::~Graph() {
-    for (auto& pair : nodes) {
-        delete pair.second;
-    }
-}
+Graph::~Graph() = default;
 
-bool Graph::is_dag() {
-    if (dag_cache_valid) {
-        return dag_cache_result;
+Node* Graph::create_node(std::string_view id) {
+    if (!arena) {
+        arena = std::make_unique<std::pmr::monotonic_buffer_resource>(upstream);
     }
+    std::pmr::polymorphic_allocator<Node> allocator(arena.get());
+    return allocator.new_object<Node>(id, arena.get());
+}
 
-    // Kahn's algorithm for cycle detection
-    std::unordered_map<std::string, int> in_degree;
-    in_degree.reserve(nodes.size());
-
-    for (const auto& pair : nodes) {
-        in_degree[pair.first] = pair.second->get_num_parents();
+void Graph::copy_nodes_from(const Graph& other) {
+    nodes.clear();
+    size_t edge_ends = 0;
+    for (const auto& [id, node] : other.nodes) {
+        edge_ends += node->children.size() + node->parents.size();
     }
+    arena = std::make_unique<std::pmr::monotonic_buffer_resource>(
+        std::max<size_t>(1024, other.nodes.size() * ARENA_BYTES_PER_NODE
+                                   + edge_ends * ARENA_BYTES_PER_EDGE_END),
+        upstream);
 
-    std::vector<std::string> zero_in_degree;
-    zero_in_degree.reserve(nodes.size() / 4);
-
-    for (const auto& pair : in_degree) {
-        if (pair.second == 0) {
-            zero_in_degree.push_back(pair.first);
+    std::unordered_map<const Node*, Node*> node_map;
+    node_map.reserve(other.nodes.size());
+    nodes.reserve(other.nodes.size());
+    for (const auto& [id, old_node] : other.nodes) {
+        Node* new_node = create_node(id);
+        new_node->tag = old_node->tag;
+        new_node->has_tag_value = old_node->has_tag_value;
+        new_node->tag_value = old_node->tag_value;
+        nodes.emplace(id, new_node);
+        node_map.emplace(old_node, new_node);
+    }
+
+    // Both edge directions are already consistent in other, so they are
+    // copied directly instead of going through add_edge
+    for (const auto& [old_node, new_node] : node_map) {
+        new_node->children.reserve(old_node->children.size());
+        for (const auto& [child, weight] : old_node->children) {
+            new_node->children.emplace(node_map[child], weight);
         }
-    }
-
-    int visited_count = 0;
-    const int total_nodes = static_cast<int>(nodes.size());
-
-    while (!zero_in_degree.empty()) {
-        std::string node_id = zero_in_degree.back();
-        zero_in_degree.pop_back();
-        visited_count++;
-
-        // early termination
-        if (visited_count == total_nodes) {
-            dag_cache_result = true;
-            dag_cache_valid = true;
-            return true;
+        new_node->parents.reserve(old_node->parents.size());
+        for (const auto& [parent, weight] : old_node->parents) {
+            new_node->parents.emplace(node_map[parent], weight);
         }
+        new_node->num_children = old_node->num_children;
+        new_node->num_parents = old_node->num_parents;
+    }
 
-        Node* node = nodes[node_id];
-        for (const auto& child_pair : node->get_children()) {
-            Node* child = child_pair.first;
-            in_degree[child->get_id()]--;
-            if (in_degree[child->get_id()] == 0) {
-                zero_in_degree.push_back(child->get_id());
+    disable_incremental_dag();
+    if (other.incremental_dag) {
+        incremental_dag = true;
+        dag_order.reserve(other.nodes.size());
+        for (const Node* old_node : other.dag_order) {
+            if (old_node) {
+                track_dag_node(node_map[old_node]);
             }
         }
     }
-
-    dag_cache_result = (visited_count == total_nodes);
-    dag_cache_valid = true;
-    return dag_cache_result;
 }
 
+bool Graph::is_dag() { return incremental_dag || analysis().is_dag; }
+
 void Graph::print_graph() const {
     for (const auto& pair : nodes) {
         const Node* node = pair.second;
-        std::cout << node->get_id() << ": [";
+        std::cout << node->get_id_view() << ": [";
         bool first = true;
         for (const auto& child_pair : node->get_children()) {
             if (!first) {
                 std::cout << ", ";
             }
-            std::cout << child_pair.first->get_id() << "(" << child_pair.second
-                      << ")";
+            std::cout << child_pair.first->get_id_view() << "("
+                      << child_pair.second << ")";
             first = false;
         }
         std::cout << "]\n";
     }
 }
 
+void Graph::attach_node(NodeMap::iterator it) {
+    it->second = create_node(it->first);
+    if (incremental_dag) {
+        track_dag_node(it->second);
+    }
+}
+
 std::optional<mcis::GraphError> Graph::add_node(const std::string& id) {
-    if (nodes.count(id)) {
+    auto [it, inserted] = nodes.try_emplace(id, nullptr);
+    if (!inserted) {
+        return mcis::GraphError::NODE_ALREADY_EXISTS;
+    }
+    attach_node(it);
+    invalidate_caches();
+    return std::nullopt;
+}
+
+std::optional<mcis::GraphError> Graph::add_node(std::string&& id) {
+    auto [it, inserted] = nodes.try_emplace(std::move(id), nullptr);
+    if (!inserted) {
         return mcis::GraphError::NODE_ALREADY_EXISTS;
     }
-    nodes[id] = new Node(id);
+    attach_node(it);
     invalidate_caches();
     return std::nullopt;
 }
 
 std::optional<mcis::GraphError> Graph::add_node_set(
     const std::vector<std::string>& ids) {
-    bool any_added = false;
+    nodes.reserve(nodes.size() + ids.size());
+    std::optional<mcis::GraphError> error;
     for (const std::string& id : ids) {
-        if (nodes.count(id)) {
-            return mcis::GraphError::NODE_ALREADY_EXISTS;
+        auto [it, inserted] = nodes.try_emplace(id, nullptr);
+        if (!inserted) {
+            error = mcis::GraphError::NODE_ALREADY_EXISTS;
+            break;
         }
-        nodes[id] = new Node(id);
-        any_added = true;
+        attach_node(it);
     }
 
-    if (any_added) {
+    if (!ids.empty()) {
         invalidate_caches();
     }
-    return std::nullopt;
+    return error;
 }
 
-std::optional<mcis::GraphError> Graph::remove_node(const std::string& id) {
+std::optional<mcis::GraphError> Graph::add_node_set(
+    std::vector<std::string>&& ids) {
+    nodes.reserve(nodes.size() + ids.size());
+    std::optional<mcis::GraphError> error;
+    for (std::string& id : ids) {
+        auto [it, inserted] = nodes.try_emplace(std::move(id), nullptr);
+        if (!inserted) {
+            error = mcis::GraphError::NODE_ALREADY_EXISTS;
+            break;
+        }
+        attach_node(it);
+    }
+
+    if (!ids.empty()) {
+        invalidate_caches();
+    }
+    return error;
+}
+
+std::optional<mcis::GraphError> Graph::remove_node(std::string_view id) {
     auto it = nodes.find(id);
     if (it == nodes.end()) {
         return mcis::GraphError::NODE_DOES_NOT_EXIST;
     }
 
+    // Neighbours drop their entries for the node; its own maps go with it
     Node* node_to_remove = it->second;
-
-    auto children_copy = node_to_remove->get_children();
-    for (const auto& [child, weight] : children_copy) {
-        node_to_remove->remove_edge(
-            child);  // This properly updates parent counts
+    for (const auto& [child, weight] : node_to_remove->children) {
+        child->parents.erase(node_to_remove);
+        --child->num_parents;
     }
-
-    for (auto& pair : nodes) {
-        Node* node = pair.second;
-        if (node != node_to_remove) {
-            const auto& children = node->get_children();
-            if (children.find(node_to_remove) != children.end()) {
-                node->remove_edge(node_to_remove);
-            }
-        }
+    for (const auto& [parent, weight] : node_to_remove->parents) {
+        parent->children.erase(node_to_remove);
+        --parent->num_children;
     }
 
-    delete node_to_remove;
+    if (incremental_dag) {
+        untrack_dag_node(node_to_remove);
+    }
+    std::destroy_at(node_to_remove);
     nodes.erase(it);
     invalidate_caches();
     return std::nullopt;
 }
 
-std::optional<mcis::GraphError> Graph::add_edge(const std::string& from_id,
-                                                const std::string& to_id,
+std::optional<mcis::GraphError> Graph::add_edge(std::string_view from_id,
+                                                std::string_view to_id,
                                                 int weight) {
     auto from_it = nodes.find(from_id);
     auto to_it = nodes.find(to_id);
     if (from_it == nodes.end() || to_it == nodes.end()) {
         return mcis::GraphError::NODE_DOES_NOT_EXIST;
     }
+    if (incremental_dag && from_it != to_it
+        && !order_dag_edge(from_it->second, to_it->second)) {
+        return mcis::GraphError::CYCLE_DETECTED;
+    }
     is_weighted = is_weighted || (weight != 0);
     if (auto error = from_it->second->add_edge(to_it->second, weight)) {
         return mcis::GraphError::EDGE_ALREADY_EXISTS;
@@ -253,7 +287,7 @@ std::optional<mcis::GraphError> Graph::add_edge(const std::string& from_id,
 }
 
 std::optional<mcis::GraphError> Graph::add_edge_set(
-    const std::string& from_id, const std::vector<std::string>& to_ids,
+    std::string_view from_id, const std::vector<std::string>& to_ids,
     const std::vector<int>& weights) {
     bool use_zero_weights = weights.empty() || weights.size() != to_ids.size();
     auto from_it = nodes.find(from_id);
@@ -261,29 +295,31 @@ std::optional<mcis::GraphError> Graph::add_edge_set(
         return mcis::GraphError::NODE_DOES_NOT_EXIST;
     }
 
-    bool any_added = false;
-
-    for (size_t i = 0; i < to_ids.size(); ++i) {
+    // Edges added before an error stay, so the caches go either way
+    std::optional<mcis::GraphError> error;
+    for (size_t i = 0; i < to_ids.size() && !error; ++i) {
         int weight = use_zero_weights ? 0 : weights[i];
         auto to_it = nodes.find(to_ids[i]);
-        if (to_it != nodes.end()) {
-            if (auto error = from_it->second->add_edge(to_it->second, weight)) {
-                return mcis::GraphError::EDGE_ALREADY_EXISTS;
-            }
-            any_added = true;
+        if (to_it == nodes.end()) {
+            error = mcis::GraphError::NODE_DOES_NOT_EXIST;
+        } else if (incremental_dag && from_it != to_it
+                   && !order_dag_edge(from_it->second, to_it->second)) {
+            error = mcis::GraphError::CYCLE_DETECTED;
+        } else if (from_it->second->add_edge(to_it->second, weight)) {
+            error = mcis::GraphError::EDGE_ALREADY_EXISTS;
         } else {
-            return mcis::GraphError::NODE_DOES_NOT_EXIST;
+            is_weighted = is_weighted || (weight != 0);
         }
     }
 
-    if (any_added) {
+    if (!to_ids.empty()) {
         invalidate_caches();
     }
-    return std::nullopt;
+    return error;
 }
 
-std::optional<mcis::GraphError> Graph::remove_edge(const std::string& from_id,
-                                                   const std::string& to_id) {
+std::optional<mcis::GraphError> Graph::remove_edge(std::string_view from_id,
+                                                   std::string_view to_id) {
     auto from_it = nodes.find(from_id);
     auto to_it = nodes.find(to_id);
     if (from_it == nodes.end() || to_it == nodes.end()) {
@@ -297,7 +333,7 @@ std::optional<mcis::GraphError> Graph::remove_edge(const std::string& from_id,
 }
 
 std::optional<mcis::GraphError> Graph::change_edge_weight(
-    const std::string& from_id, const std::string& to_id, int new_weight) {
+    std::string_view from_id, std::string_view to_id, int new_weight) {
     auto from_it = nodes.find(from_id);
     auto to_it = nodes.find(to_id);
     if (from_it == nodes.end() || to_it == nodes.end()) {
@@ -307,44 +343,60 @@ std::optional<mcis::GraphError> Graph::change_edge_weight(
         = from_it->second->change_edge_weight(to_it->second, new_weight)) {
         return mcis::GraphError::EDGE_DOES_NOT_EXIST;
     }
+    invalidate_caches();
     return std::nullopt;
 }
 
-std::optional<mcis::GraphError> Graph::set_node_tag(
-    const std::string& id, const std::string& new_tag) {
+std::optional<mcis::GraphError> Graph::set_node_tag(std::string_view id,
+                                                    std::string_view new_tag) {
     auto it = nodes.find(id);
     if (it == nodes.end()) {
         return mcis::GraphError::NODE_DOES_NOT_EXIST;
     }
     it->second->set_tag(new_tag);
+    invalidate_caches();
+    return std::nullopt;
+}
+
+std::optional<mcis::GraphError> Graph::set_node_tag(std::string_view id,
+                                                    std::string_view new_tag,
+                                                    double value) {
+    auto it = nodes.find(id);
+    if (it == nodes.end()) {
+        return mcis::GraphError::NODE_DOES_NOT_EXIST;
+    }
+    it->second->set_tag(new_tag, value);
+    invalidate_caches();
     return std::nullopt;
 }
 
 Graph Graph::get_subgraph_with_tag(const std::string& tag) const {
-    Graph subgraph;
-    std::unordered_map<Node*, Node*> old_to_new_node_map;
+    Graph subgraph(upstream);
+    const std::optional<TagSymbols::Symbol> symbol = TagSymbols::find(tag);
+    if (!symbol) {
+        return subgraph;
+    }
+    std::unordered_map<const Node*, Node*> old_to_new_node_map;
 
     // First, create all the nodes in the subgraph
-    for (const auto& pair : nodes) {
-        if (pair.second->get_tag() == tag) {
-            subgraph.add_node(pair.second->get_id());
-            old_to_new_node_map[pair.second]
-                = subgraph.get_node(pair.second->get_id());
+    for (const auto& [id, node] : nodes) {
+        if (node->tag == *symbol) {
+            Node* new_node = subgraph.create_node(id);
+            new_node->tag = node->tag;
+            new_node->has_tag_value = node->has_tag_value;
+            new_node->tag_value = node->tag_value;
+            subgraph.nodes.emplace(id, new_node);
+            old_to_new_node_map.emplace(node, new_node);
         }
     }
 
     // Now, add the edges, but only between nodes that are in the subgraph
-    for (const auto& pair : nodes) {
-        if (pair.second->get_tag() == tag) {
-            Node* old_node = pair.second;
-            Node* new_node = old_to_new_node_map[old_node];
-            for (const auto& child_pair : old_node->get_children()) {
-                Node* old_child = child_pair.first;
-                if (old_child->get_tag() == tag) {
-                    Node* new_child = old_to_new_node_map[old_child];
-                    subgraph.add_edge(new_node->get_id(), new_child->get_id(),
-                                      child_pair.second);
-                }
+    for (const auto& [old_node, new_node] : old_to_new_node_map) {
+        for (const auto& [old_child, weight] : old_node->children) {
+            auto it = old_to_new_node_map.find(old_child);
+            if (it != old_to_new_node_map.end()) {
+                new_node->add_edge(it->second, weight);
+                subgraph.is_weighted = subgraph.is_weighted || weight != 0;
             }
         }
     }
@@ -352,7 +404,65 @@ Graph Graph::get_subgraph_with_tag(const std::string& tag) const {
     return subgraph;
 }
 
-Node* Graph::get_node(const std::string& id) const {
+CompactGraph Graph::freeze() const {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (frozen_cache && frozen_version == version) {
+        return *frozen_cache;
+    }
+
+    std::vector<Node*> order;
+    order.reserve(nodes.size());
+    for (const auto& pair : nodes) {
+        order.push_back(pair.second);
+    }
+    std::sort(order.begin(), order.end(), [](const Node* a, const Node* b) {
+        return a->get_id_view() < b->get_id_view();
+    });
+
+    std::unordered_map<Node*, CompactGraph::VertexId> index;
+    index.reserve(order.size());
+    std::vector<std::string> ids;
+    ids.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        index[order[i]] = static_cast<CompactGraph::VertexId>(i);
+        ids.emplace_back(order[i]->get_id_view());
+    }
+
+    // Tag values are not part of the snapshot; labels map to tag IDs
+    std::unordered_map<TagSymbols::Symbol, CompactGraph::TagId> tag_index;
+    std::vector<std::string> tag_table;
+    std::vector<CompactGraph::TagId> node_tags;
+    node_tags.reserve(order.size());
+    std::vector<uint32_t> out_offsets;
+    out_offsets.reserve(order.size() + 1);
+    out_offsets.push_back(0);
+    std::vector<CompactGraph::VertexId> out_targets;
+    std::vector<int> out_weights;
+
+    for (Node* node : order) {
+        auto [it, inserted] = tag_index.try_emplace(
+            node->tag, static_cast<CompactGraph::TagId>(tag_table.size()));
+        if (inserted) {
+            tag_table.emplace_back(TagSymbols::label(node->tag));
+        }
+        node_tags.push_back(it->second);
+
+        for (const auto& [child, weight] : node->get_children()) {
+            out_targets.push_back(index[child]);
+            out_weights.push_back(weight);
+        }
+        out_offsets.push_back(static_cast<uint32_t>(out_targets.size()));
+    }
+
+    frozen_cache = std::make_shared<const CompactGraph>(
+        std::move(ids), std::move(node_tags), std::move(tag_table),
+        std::move(out_offsets), std::move(out_targets),
+        std::move(out_weights));
+    frozen_version = version;
+    return *frozen_cache;
+}
+
+Node* Graph::get_node(std::string_view id) const {
     auto it = nodes.find(id);
     if (it != nodes.end()) {
         return it->second;
@@ -362,7 +472,7 @@ Node* Graph::get_node(const std::string& id) const {
 
 int Graph::get_num_nodes() const { return static_cast<int>(nodes.size()); }
 
-const std::unordered_map<std::string, Node*>& Graph::get_nodes() const {
+const NodeMap& Graph::get_nodes() const {
     return nodes;
 }
 
@@ -372,7 +482,7 @@ bool Graph::operator==(const Graph& other) const {
     }
 
     for (const auto& pair : nodes) {
-        const std::string& node_id = pair.first;
+        const std::string_view node_id = pair.first;
         Node* this_node = pair.second;
         Node* other_node = other.get_node(node_id);
         if (!other_node || *this_node != *other_node) {
@@ -392,104 +502,95 @@ std::ostream& operator<<(std::ostream& os, const Graph& graph) {
     }
     std::sort(
         node_list.begin(), node_list.end(),
-        [](const Node* a, const Node* b) { return a->get_id() < b->get_id(); });
+        [](const Node* a, const Node* b) {
+            return a->get_id_view() < b->get_id_view();
+        });
     for (const auto node : node_list) {
         os << *node << "\n";
     }
     return os;
 }
 
-void Graph::generate_diagram_file(const std::string& graph_name) const {
+std::optional<mcis::GraphError> Graph::generate_diagram_file(
+    const std::string& graph_name, const DiagramOptions& options) const {
     // https://www.graphviz.org/pdf/dotguide.pdf
     std::string filename = currentDateTime() + "_" + graph_name;
-    std::string dotpath = "../../dot/" + filename + ".gv";
-    std::string diagrampath = "../../diagrams/" + filename + ".png";
+    std::string dotpath = options.dot_directory + filename + ".gv";
     std::ofstream outputFile(dotpath);
-
-    outputFile << "digraph G {\n";
-    if (!is_weighted) {
-        for (const auto& [_, node] : nodes) {
-            std::string node_id = node->get_id();
-            size_t super_pos = node_id.find('^');
-            size_t sub_pos = node_id.find('_');
-
-            if (node_id.find('^') != std::string::npos
-                || node_id.find('_') != std::string::npos) {
-                outputFile << "    " << std::quoted(node->get_id())
-                           << " [label=<v<SUB>" << node_id.substr(sub_pos + 1)
-                           << "</SUB><SUP>"
-                           << node_id.substr(super_pos + 1,
-                                             sub_pos - super_pos - 1)
-                           << "</SUP>(" << node->get_tag() << ")>];\n";
-            }
-            for (const auto& [child, weight] : node->get_children()) {
-                outputFile << "    " << std::quoted(node->get_id()) << " -> "
-                           << std::quoted(child->get_id()) << ";\n";
-            }
-        }
-    } else {
-        for (const auto& [_, node] : nodes) {
-            for (const auto& [child, weight] : node->get_children()) {
-                outputFile << "    " << std::quoted(node->get_id()) << " -> "
-                           << std::quoted(child->get_id()) << " [label=\""
-                           << weight << "\"];\n";
-            }
-        }
+    if (auto error = write_dot(outputFile, true)) {
+        return error;
     }
-    outputFile << "}\n";
     outputFile.close();
+    if (!options.render) {
+        return std::nullopt;
+    }
 
-    system(("dot -Tpng " + dotpath + " -o " + diagrampath).c_str());
+    // Run dot directly rather than through a shell
+    std::string diagrampath = options.image_directory + filename + ".png";
+    std::vector<std::string> args
+        = {"dot", "-Tpng", dotpath, "-o", diagrampath};
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+        argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+    pid_t pid;
+    if (posix_spawnp(&pid, "dot", nullptr, nullptr, argv.data(), environ)
+        != 0) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status)
+        || WEXITSTATUS(status) != 0) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    return std::nullopt;
 }
 
 int Graph::remove_nodes_bulk(const std::vector<std::string>& node_ids) {
-    if (node_ids.empty()) {
-        return 0;
-    }
-
-    std::vector<Node*> nodes_to_remove;
-    nodes_to_remove.reserve(node_ids.size());
-
+    // Mark every node once, keeping its map position for the erase
+    std::unordered_set<const Node*> removal_set;
+    removal_set.reserve(node_ids.size());
+    std::vector<decltype(nodes)::iterator> to_remove;
+    to_remove.reserve(node_ids.size());
     for (const std::string& id : node_ids) {
         auto it = nodes.find(id);
-        if (it != nodes.end()) {
-            nodes_to_remove.push_back(it->second);
+        if (it != nodes.end() && removal_set.insert(it->second).second) {
+            to_remove.push_back(it);
         }
     }
-
-    if (nodes_to_remove.empty()) return 0;
-
-    std::unordered_set<Node*> removal_set(nodes_to_remove.begin(),
-                                          nodes_to_remove.end());
-
-    for (Node* node_to_remove : nodes_to_remove) {
-        auto children_copy = node_to_remove->get_children();
-        for (const auto& [child, weight] : children_copy) {
-            node_to_remove->remove_edge(child);
-        }
+    if (to_remove.empty()) {
+        return 0;
     }
 
-    for (auto& [id, node] : nodes) {
-        if (removal_set.find(node) == removal_set.end()) {
-            std::vector<Node*> edges_to_remove;
-            for (const auto& [child, weight] : node->get_children()) {
-                if (removal_set.find(child) != removal_set.end()) {
-                    edges_to_remove.push_back(child);
-                }
+    // Rewire surviving neighbours only; edges between two removed nodes go
+    // away with their endpoints
+    for (const auto& it : to_remove) {
+        Node* node = it->second;
+        for (const auto& [child, weight] : node->children) {
+            if (!removal_set.count(child)) {
+                child->parents.erase(node);
+                --child->num_parents;
             }
-            for (Node* child_to_remove : edges_to_remove) {
-                node->remove_edge(child_to_remove);
+        }
+        for (const auto& [parent, weight] : node->parents) {
+            if (!removal_set.count(parent)) {
+                parent->children.erase(node);
+                --parent->num_children;
             }
         }
     }
 
-    for (Node* node_to_remove : nodes_to_remove) {
-        nodes.erase(node_to_remove->get_id());
-        delete node_to_remove;
+    for (const auto& it : to_remove) {
+        if (incremental_dag) {
+            untrack_dag_node(it->second);
+        }
+        std::destroy_at(it->second);
+        nodes.erase(it);
     }
 
     invalidate_caches();
-    return static_cast<int>(nodes_to_remove.size());
+    return static_cast<int>(to_remove.size());
 }
 
 void Graph::reserve_nodes(size_t expected_size) {
@@ -497,6 +598,7 @@ void Graph::reserve_nodes(size_t expected_size) {
 }
 
 void Graph::invalidate_caches() const {
-    dag_cache_valid = false;
+    analysis_cache.reset();
+    frozen_cache.reset();
     ++version;
 }
@@ -0,0 +1,156 @@
+/**
+ * @file graph_analysis.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <mcis/graph.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+void count_degree(std::vector<uint32_t>& histogram, size_t degree) {
+    if (histogram.size() <= degree) {
+        histogram.resize(degree + 1, 0);
+    }
+    ++histogram[degree];
+}
+
+}  // namespace
+
+std::optional<uint32_t> GraphAnalysis::asap_level(const Node* node) const {
+    auto it = topological_index.find(node);
+    if (it == topological_index.end()) {
+        return std::nullopt;
+    }
+    return asap_levels[it->second];
+}
+
+std::optional<uint32_t> GraphAnalysis::alap_level(const Node* node) const {
+    auto it = topological_index.find(node);
+    if (it == topological_index.end()) {
+        return std::nullopt;
+    }
+    return alap_levels[it->second];
+}
+
+const GraphAnalysis& Graph::analysis() const {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (analysis_cache && analysis_cache->version == version) {
+        return *analysis_cache;
+    }
+
+    auto result = std::make_shared<GraphAnalysis>();
+    result->version = version;
+    const uint32_t n = static_cast<uint32_t>(nodes.size());
+
+    // Dense indices in map order first; they become topological positions
+    // once an order is known
+    std::vector<Node*> by_index;
+    by_index.reserve(n);
+    std::unordered_map<const Node*, uint32_t>& index
+        = result->topological_index;
+    index.reserve(n);
+    std::vector<uint32_t> pending(n);
+    std::unordered_map<TagSymbols::Symbol, std::vector<Node*>> by_symbol;
+    for (const auto& [id, node] : nodes) {
+        pending[by_index.size()] = static_cast<uint32_t>(node->parents.size());
+        index.emplace(node, static_cast<uint32_t>(by_index.size()));
+        by_index.push_back(node);
+
+        count_degree(result->in_degree_histogram, node->parents.size());
+        count_degree(result->out_degree_histogram, node->children.size());
+        if (node->parents.empty()) {
+            result->sources.push_back(node);
+        }
+        if (node->children.empty()) {
+            result->sinks.push_back(node);
+        }
+        by_symbol[node->tag].push_back(node);
+    }
+    for (auto& [symbol, tagged] : by_symbol) {
+        result->tag_index.emplace(TagSymbols::label(symbol),
+                                  std::move(tagged));
+    }
+
+    // In incremental DAG mode the maintained order is used as is; otherwise
+    // Kahn's algorithm finds one
+    std::vector<uint32_t> order;
+    order.reserve(n);
+    if (incremental_dag) {
+        for (const Node* node : dag_order) {
+            if (node) {
+                order.push_back(index[node]);
+            }
+        }
+    } else {
+        for (const Node* source : result->sources) {
+            order.push_back(index[source]);
+        }
+        for (size_t head = 0; head < order.size(); ++head) {
+            const Node* node = by_index[order[head]];
+            for (const auto& [child, weight] : node->children) {
+                const uint32_t v = index[child];
+                if (--pending[v] == 0) {
+                    order.push_back(v);
+                }
+            }
+        }
+    }
+    result->is_dag = order.size() == n;
+    if (!result->is_dag) {
+        index.clear();
+        analysis_cache = std::move(result);
+        return *analysis_cache;
+    }
+
+    result->topological_order.reserve(n);
+    for (uint32_t position = 0; position < n; ++position) {
+        Node* node = by_index[order[position]];
+        result->topological_order.push_back(node);
+        index[node] = position;
+    }
+    result->asap_levels.assign(n, 0);
+    for (uint32_t position = 0; position < n; ++position) {
+        const uint32_t level = result->asap_levels[position];
+        for (const auto& [child, weight] :
+             result->topological_order[position]->children) {
+            uint32_t& child_level = result->asap_levels[index[child]];
+            child_level = std::max(child_level, level + 1);
+        }
+    }
+
+    const uint32_t depth
+        = n == 0 ? 0
+                 : *std::max_element(result->asap_levels.begin(),
+                                     result->asap_levels.end())
+                       + 1;
+    result->levels.resize(depth);
+    for (Node* node : result->topological_order) {
+        result->levels[result->asap_levels[index[node]]].push_back(node);
+    }
+    result->alap_levels.assign(n, depth == 0 ? 0 : depth - 1);
+    for (uint32_t position = n; position-- > 0;) {
+        uint32_t& level = result->alap_levels[position];
+        for (const auto& [child, weight] :
+             result->topological_order[position]->children) {
+            level = std::min(level, result->alap_levels[index[child]] - 1);
+        }
+    }
+
+    analysis_cache = std::move(result);
+    return *analysis_cache;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file graph_batch.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/graph_batch.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+GraphBatch::GraphBatch(std::shared_ptr<const CompactGraph> topology,
+                       size_t num_instances)
+    : shared(std::move(topology)),
+      num_instances(num_instances),
+      buffer(num_instances * columns(), 0.0) {}
+
+Graph GraphBatch::materialize(size_t instance) const {
+    Graph graph = shared->thaw();
+    const std::span<const double> column = values(instance);
+    for (VertexId v = 0; v < shared->get_num_nodes(); ++v) {
+        graph.set_node_tag(shared->get_id(v), shared->get_tag(v), column[v]);
+    }
+    return graph;
+}
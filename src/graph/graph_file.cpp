@@ -0,0 +1,341 @@
+/**
+ * @file graph_file.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Binary graph format. A file is a 64-byte header followed by these
+ * sections, in host byte order and each padded to a multiple of 8 bytes:
+ *
+ *   out_offsets   uint32[|V| + 1]
+ *   out_targets   uint32[|E|]
+ *   out_weights   int32[|E|]
+ *   in_offsets    uint32[|V| + 1]
+ *   in_sources    uint32[|E|]
+ *   in_weights    int32[|E|]
+ *   node_tags     uint32[|V|]
+ *   string_ends   uint64[|V| + |T|]  end of each node ID, then of each tag
+ *   strings       char[string_bytes]
+ *
+ * The checksum is FNV-1a over the payload's 64-bit words.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <fcntl.h>
+#include <mcis/compact_graph.h>
+#include <mcis/graph.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mcis/errors.h"
+
+namespace {
+
+// "MCISCSR" and a zero byte, read as a little-endian word; a file written on
+// a host of the other byte order fails this check
+constexpr uint64_t FILE_MAGIC = 0x0052534353494D43;
+constexpr uint32_t FILE_VERSION = 1;
+constexpr uint32_t FLAG_WEIGHTED = 1;
+
+struct FileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t num_nodes;
+    uint32_t num_edges;
+    uint32_t num_tags;
+    uint32_t reserved;
+    uint64_t string_bytes;
+    uint64_t payload_bytes;
+    uint64_t checksum;
+    uint64_t reserved_end;
+};
+static_assert(sizeof(FileHeader) == 64);
+
+enum Section {
+    OUT_OFFSETS,
+    OUT_TARGETS,
+    OUT_WEIGHTS,
+    IN_OFFSETS,
+    IN_SOURCES,
+    IN_WEIGHTS,
+    NODE_TAGS,
+    STRING_ENDS,
+    STRINGS,
+    NUM_SECTIONS,
+};
+
+constexpr uint64_t padded(uint64_t bytes) { return (bytes + 7) & ~uint64_t{7}; }
+
+/**
+ * @brief Byte offsets of every section from the start of the payload.
+ */
+struct Layout {
+    std::array<uint64_t, NUM_SECTIONS> size;
+    std::array<uint64_t, NUM_SECTIONS> offset;
+    uint64_t payload_bytes;
+
+    explicit Layout(const FileHeader& header) {
+        const uint64_t n = header.num_nodes;
+        const uint64_t e = header.num_edges;
+        size = {(n + 1) * 4,
+                e * 4,
+                e * 4,
+                (n + 1) * 4,
+                e * 4,
+                e * 4,
+                n * 4,
+                (n + header.num_tags) * 8,
+                header.string_bytes};
+        uint64_t at = 0;
+        for (int s = 0; s < NUM_SECTIONS; ++s) {
+            offset[s] = at;
+            at += padded(size[s]);
+        }
+        payload_bytes = at;
+    }
+};
+
+/**
+ * @brief Views count elements of a section in place.
+ */
+template <typename T>
+std::span<const T> section_of(const unsigned char* payload,
+                              const Layout& layout, Section s, uint64_t count) {
+    return {reinterpret_cast<const T*>(payload + layout.offset[s]), count};
+}
+
+/**
+ * @brief Checks that CSR offsets or string ends never decrease and that the
+ * last one equals last.
+ */
+template <typename T>
+bool monotonic(std::span<const T> bounds, uint64_t last) {
+    uint64_t previous = 0;
+    for (const T bound : bounds) {
+        if (bound < previous) {
+            return false;
+        }
+        previous = bound;
+    }
+    return previous == last;
+}
+
+/**
+ * @brief Checks that every index is below limit.
+ */
+template <typename T>
+bool all_below(std::span<const T> values, uint64_t limit) {
+    return std::ranges::all_of(values, [limit](T v) { return v < limit; });
+}
+
+class Checksum {
+ public:
+    // bytes must be a multiple of 8
+    void update(const void* data, uint64_t bytes) {
+        const auto* p = static_cast<const unsigned char*>(data);
+        for (uint64_t i = 0; i < bytes; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, p + i, 8);
+            hash = (hash ^ word) * 0x100000001b3;
+        }
+    }
+
+    uint64_t value() const { return hash; }
+
+ private:
+    uint64_t hash = 0xcbf29ce484222325;
+};
+
+/**
+ * @brief A read-only private mapping of a whole file.
+ */
+struct MappedFile {
+    void* address = MAP_FAILED;
+    size_t length = 0;
+
+    ~MappedFile() {
+        if (address != MAP_FAILED) {
+            munmap(address, length);
+        }
+    }
+
+    const unsigned char* bytes() const {
+        return static_cast<const unsigned char*>(address);
+    }
+};
+
+}  // namespace
+
+std::optional<mcis::GraphError> CompactGraph::save_binary(
+    const std::string& path) const {
+    const std::vector<std::string>& ids = names();
+    std::vector<uint64_t> string_ends;
+    string_ends.reserve(ids.size() + tag_table.size());
+    std::string strings;
+    for (const auto& id : ids) {
+        strings += id;
+        string_ends.push_back(strings.size());
+    }
+    for (const auto& tag : tag_table) {
+        strings += tag;
+        string_ends.push_back(strings.size());
+    }
+
+    FileHeader header{};
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.flags = is_weighted ? FLAG_WEIGHTED : 0;
+    header.num_nodes = get_num_nodes();
+    header.num_edges = get_num_edges();
+    header.num_tags = static_cast<uint32_t>(tag_table.size());
+    header.string_bytes = strings.size();
+    const Layout layout(header);
+    header.payload_bytes = layout.payload_bytes;
+
+    const std::array<const void*, NUM_SECTIONS> data
+        = {out_offsets.data(), out_targets.data(), out_weights.data(),
+           in_offsets.data(),  in_sources.data(),  in_weights.data(),
+           node_tags.data(),   string_ends.data(), strings.data()};
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    // The header goes last, once the checksum is known
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    Checksum checksum;
+    for (int s = 0; s < NUM_SECTIONS; ++s) {
+        const uint64_t whole = layout.size[s] & ~uint64_t{7};
+        out.write(static_cast<const char*>(data[s]),
+                  static_cast<std::streamsize>(whole));
+        checksum.update(data[s], whole);
+        if (layout.size[s] > whole) {
+            std::array<unsigned char, 8> tail{};
+            std::memcpy(tail.data(), static_cast<const char*>(data[s]) + whole,
+                        layout.size[s] - whole);
+            out.write(reinterpret_cast<const char*>(tail.data()), 8);
+            checksum.update(tail.data(), 8);
+        }
+    }
+    header.checksum = checksum.value();
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (!out) {
+        return mcis::GraphError::FILE_IO_ERROR;
+    }
+    return std::nullopt;
+}
+
+std::expected<CompactGraph, mcis::GraphError> CompactGraph::load_binary(
+    const std::string& path, bool verify_checksum) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::unexpected(mcis::GraphError::FILE_IO_ERROR);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return std::unexpected(mcis::GraphError::FILE_IO_ERROR);
+    }
+    auto file = std::make_shared<MappedFile>();
+    file->length = static_cast<size_t>(info.st_size);
+    if (file->length < sizeof(FileHeader)) {
+        close(fd);
+        return std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+    }
+    file->address
+        = mmap(nullptr, file->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (file->address == MAP_FAILED) {
+        return std::unexpected(mcis::GraphError::FILE_IO_ERROR);
+    }
+
+    FileHeader header;
+    std::memcpy(&header, file->bytes(), sizeof(header));
+    // A string size past the file could wrap the layout's offsets
+    if (header.magic != FILE_MAGIC || header.version != FILE_VERSION
+        || header.string_bytes > file->length) {
+        return std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+    }
+    const Layout layout(header);
+    if (layout.payload_bytes != header.payload_bytes
+        || file->length != sizeof(FileHeader) + layout.payload_bytes) {
+        return std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+    }
+    const unsigned char* payload = file->bytes() + sizeof(FileHeader);
+    if (verify_checksum) {
+        Checksum checksum;
+        checksum.update(payload, layout.payload_bytes);
+        if (checksum.value() != header.checksum) {
+            return std::unexpected(mcis::GraphError::CHECKSUM_MISMATCH);
+        }
+    }
+
+    // mmap returns page-aligned memory and every section starts on an
+    // 8-byte boundary, so the arrays are used in place
+    const uint64_t n = header.num_nodes;
+    const uint64_t e = header.num_edges;
+    const auto out_offsets
+        = section_of<uint32_t>(payload, layout, OUT_OFFSETS, n + 1);
+    const auto out_targets
+        = section_of<VertexId>(payload, layout, OUT_TARGETS, e);
+    const auto in_offsets
+        = section_of<uint32_t>(payload, layout, IN_OFFSETS, n + 1);
+    const auto in_sources
+        = section_of<VertexId>(payload, layout, IN_SOURCES, e);
+    const auto node_tags = section_of<TagId>(payload, layout, NODE_TAGS, n);
+    const auto string_ends = section_of<uint64_t>(payload, layout, STRING_ENDS,
+                                                  n + header.num_tags);
+    // The checksum may be skipped or match by chance, so check every index
+    // the graph will follow before handing out the arrays: O(V + E)
+    if (out_offsets.front() != 0 || !monotonic(out_offsets, e)
+        || in_offsets.front() != 0 || !monotonic(in_offsets, e)
+        || !monotonic(string_ends,
+                      string_ends.empty() ? 0 : header.string_bytes)
+        || !all_below(out_targets, n) || !all_below(in_sources, n)
+        || !all_below(node_tags, header.num_tags)) {
+        return std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+    }
+    const char* strings
+        = reinterpret_cast<const char*>(payload + layout.offset[STRINGS]);
+    auto string_at = [string_ends, strings](uint64_t i) {
+        const uint64_t begin = i == 0 ? 0 : string_ends[i - 1];
+        return std::string(strings + begin, strings + string_ends[i]);
+    };
+
+    std::vector<std::string> tag_table;
+    tag_table.reserve(header.num_tags);
+    for (uint32_t t = 0; t < header.num_tags; ++t) {
+        tag_table.push_back(string_at(n + t));
+    }
+
+    return CompactGraph(
+        file, string_at, std::move(tag_table),
+        node_tags, out_offsets, out_targets,
+        section_of<int>(payload, layout, OUT_WEIGHTS, e), in_offsets,
+        in_sources, section_of<int>(payload, layout, IN_WEIGHTS, e),
+        (header.flags & FLAG_WEIGHTED) != 0);
+}
+
+std::optional<mcis::GraphError> Graph::save_binary(
+    const std::string& path) const {
+    return freeze().save_binary(path);
+}
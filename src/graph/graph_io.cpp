@@ -0,0 +1,634 @@
+/**
+ * @file graph_io.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Streaming DOT and edge-list export and import for Graph.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <mcis/graph.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <expected>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "mcis/errors.h"
+
+namespace {
+
+/**
+ * @brief Collects output in a large block and hands it to the stream
+ * whenever the block fills up.
+ */
+class BufferedWriter {
+ public:
+    explicit BufferedWriter(std::ostream& out) : out(out) {
+        buffer.reserve(BLOCK_BYTES);
+    }
+
+    BufferedWriter& operator<<(std::string_view text) {
+        buffer.append(text);
+        if (buffer.size() >= BLOCK_BYTES) {
+            flush();
+        }
+        return *this;
+    }
+
+    BufferedWriter& operator<<(int value) {
+        char digits[16];
+        auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        return *this << std::string_view(digits, end - digits);
+    }
+
+    // Shortest form that reads back as the same double
+    BufferedWriter& operator<<(double value) {
+        char digits[32];
+        auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        return *this << std::string_view(digits, end - digits);
+    }
+
+    // Writes s as a DOT quoted string
+    BufferedWriter& quoted(std::string_view s) {
+        buffer.push_back('"');
+        for (const char c : s) {
+            if (c == '"' || c == '\\') {
+                buffer.push_back('\\');
+            }
+            buffer.push_back(c);
+        }
+        buffer.push_back('"');
+        return *this;
+    }
+
+    std::optional<mcis::GraphError> finish() {
+        flush();
+        out.flush();
+        if (!out) {
+            return mcis::GraphError::FILE_IO_ERROR;
+        }
+        return std::nullopt;
+    }
+
+ private:
+    static constexpr size_t BLOCK_BYTES = size_t{1} << 16;
+
+    void flush() {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+    std::ostream& out;
+    std::string buffer;
+};
+
+/**
+ * @brief Buffers parsed nodes, tags and edges and inserts them into a graph
+ * in bulk, GRAPH_IMPORT_CHUNK_EDGES edges at a time. Nodes are created on
+ * first mention, as in DOT.
+ */
+class ChunkedInserter {
+ public:
+    explicit ChunkedInserter(Graph& graph) : graph(graph) {}
+
+    void node(const std::string& id) {
+        if (!graph.get_node(id) && pending.insert(id).second) {
+            new_nodes.push_back(id);
+        }
+    }
+
+    void tag(const std::string& id, std::string tag,
+             std::optional<double> value) {
+        node(id);
+        tags.push_back({id, std::move(tag), value});
+    }
+
+    std::optional<mcis::GraphError> edge(const std::string& from,
+                                         const std::string& to, int weight) {
+        node(from);
+        node(to);
+        edges.push_back({from, to, weight});
+        if (edges.size() >= GRAPH_IMPORT_CHUNK_EDGES) {
+            return flush();
+        }
+        return std::nullopt;
+    }
+
+    std::optional<mcis::GraphError> flush() {
+        if (auto error = graph.add_node_set(new_nodes)) {
+            return error;
+        }
+        new_nodes.clear();
+        pending.clear();
+
+        // One add_edge_set per source, keeping each source's edge order
+        std::stable_sort(edges.begin(), edges.end(),
+                         [](const Edge& a, const Edge& b) {
+                             return a.from < b.from;
+                         });
+        std::vector<std::string> to_ids;
+        std::vector<int> weights;
+        for (size_t begin = 0; begin < edges.size();) {
+            size_t end = begin;
+            to_ids.clear();
+            weights.clear();
+            while (end < edges.size() && edges[end].from == edges[begin].from) {
+                to_ids.push_back(std::move(edges[end].to));
+                weights.push_back(edges[end].weight);
+                ++end;
+            }
+            if (auto error
+                = graph.add_edge_set(edges[begin].from, to_ids, weights)) {
+                return error;
+            }
+            begin = end;
+        }
+        edges.clear();
+
+        for (const auto& [id, tag, value] : tags) {
+            if (value) {
+                graph.set_node_tag(id, tag, *value);
+            } else {
+                graph.set_node_tag(id, tag);
+            }
+        }
+        tags.clear();
+        return std::nullopt;
+    }
+
+ private:
+    struct Edge {
+        std::string from;
+        std::string to;
+        int weight;
+    };
+
+    Graph& graph;
+    std::vector<std::string> new_nodes;
+    std::unordered_set<std::string> pending;
+    struct Tag {
+        std::string id;
+        std::string label;
+        std::optional<double> value;
+    };
+
+    std::vector<Tag> tags;
+    std::vector<Edge> edges;
+};
+
+/**
+ * @brief Splits a DOT stream into tokens, one character at a time through
+ * the stream's own buffer.
+ */
+class DotLexer {
+ public:
+    enum class Kind {
+        ID,
+        ARROW,
+        UNDIRECTED_EDGE,
+        LBRACE,
+        RBRACE,
+        LBRACKET,
+        RBRACKET,
+        EQUALS,
+        SEPARATOR,
+        END,
+        ERROR,
+    };
+
+    struct Token {
+        Kind kind;
+        std::string text;
+    };
+
+    explicit DotLexer(std::istream& in) : in(*in.rdbuf()) {}
+
+    const Token& peek() {
+        if (!lookahead) {
+            lookahead = lex();
+        }
+        return *lookahead;
+    }
+
+    Token next() {
+        Token token = lookahead ? std::move(*lookahead) : lex();
+        lookahead.reset();
+        return token;
+    }
+
+ private:
+    static constexpr int END_OF_FILE = std::char_traits<char>::eof();
+
+    int get() { return in.sbumpc(); }
+    int look() { return in.sgetc(); }
+
+    static bool is_id_char(int c) {
+        return c != END_OF_FILE && !std::isspace(c)
+               && std::string_view("{}[]=;,\"<>").find(static_cast<char>(c))
+                      == std::string_view::npos
+               && c != '/' && c != '#';
+    }
+
+    // Skips whitespace and comments; false on an unterminated comment
+    bool skip_blank() {
+        for (;;) {
+            int c = look();
+            if (c != END_OF_FILE && std::isspace(c)) {
+                get();
+            } else if (c == '#') {
+                skip_line();
+            } else if (c == '/') {
+                get();
+                if (look() == '/') {
+                    skip_line();
+                } else if (look() == '*') {
+                    get();
+                    int previous = 0;
+                    while ((c = get()) != END_OF_FILE
+                           && !(previous == '*' && c == '/')) {
+                        previous = c;
+                    }
+                    if (c == END_OF_FILE) {
+                        return false;
+                    }
+                } else {
+                    return false;
+                }
+            } else {
+                return true;
+            }
+        }
+    }
+
+    void skip_line() {
+        int c;
+        while ((c = get()) != END_OF_FILE && c != '\n') {
+        }
+    }
+
+    Token lex() {
+        if (!skip_blank()) {
+            return {Kind::ERROR, {}};
+        }
+        int c = get();
+        switch (c) {
+            case END_OF_FILE:
+                return {Kind::END, {}};
+            case '{':
+                return {Kind::LBRACE, {}};
+            case '}':
+                return {Kind::RBRACE, {}};
+            case '[':
+                return {Kind::LBRACKET, {}};
+            case ']':
+                return {Kind::RBRACKET, {}};
+            case '=':
+                return {Kind::EQUALS, {}};
+            case ';':
+            case ',':
+                return {Kind::SEPARATOR, {}};
+            case '"':
+                return quoted();
+            case '<':
+                return html();
+            default:
+                break;
+        }
+        if (c == '-' && (look() == '>' || look() == '-')) {
+            return {get() == '>' ? Kind::ARROW : Kind::UNDIRECTED_EDGE, {}};
+        }
+        if (!is_id_char(c)) {
+            return {Kind::ERROR, {}};
+        }
+        std::string text(1, static_cast<char>(c));
+        while (is_id_char(look())) {
+            // "a->b" without spaces splits before the arrow
+            if (look() == '-' && !text.empty()) {
+                get();
+                if (look() == '>' || look() == '-') {
+                    in.sungetc();
+                    break;
+                }
+                text.push_back('-');
+                continue;
+            }
+            text.push_back(static_cast<char>(get()));
+        }
+        return {Kind::ID, std::move(text)};
+    }
+
+    Token quoted() {
+        std::string text;
+        for (int c = get(); c != '"'; c = get()) {
+            if (c == END_OF_FILE) {
+                return {Kind::ERROR, {}};
+            }
+            if (c == '\\' && (look() == '"' || look() == '\\')) {
+                c = get();
+            }
+            text.push_back(static_cast<char>(c));
+        }
+        return {Kind::ID, std::move(text)};
+    }
+
+    // HTML strings nest angle brackets
+    Token html() {
+        std::string text;
+        for (int depth = 1, c = get();; c = get()) {
+            if (c == END_OF_FILE) {
+                return {Kind::ERROR, {}};
+            }
+            depth += c == '<' ? 1 : c == '>' ? -1 : 0;
+            if (depth == 0) {
+                return {Kind::ID, std::move(text)};
+            }
+            text.push_back(static_cast<char>(c));
+        }
+    }
+
+    std::streambuf& in;
+    std::optional<Token> lookahead;
+};
+
+using Attributes = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Parses "[a=b, c=d ...]" if the next token opens one.
+ */
+std::optional<Attributes> parse_attributes(DotLexer& lexer) {
+    Attributes attributes;
+    while (lexer.peek().kind == DotLexer::Kind::LBRACKET) {
+        lexer.next();
+        for (;;) {
+            DotLexer::Token key = lexer.next();
+            if (key.kind == DotLexer::Kind::RBRACKET) {
+                break;
+            }
+            if (key.kind == DotLexer::Kind::SEPARATOR) {
+                continue;
+            }
+            if (key.kind != DotLexer::Kind::ID
+                || lexer.next().kind != DotLexer::Kind::EQUALS) {
+                return std::nullopt;
+            }
+            DotLexer::Token value = lexer.next();
+            if (value.kind != DotLexer::Kind::ID) {
+                return std::nullopt;
+            }
+            attributes.emplace_back(std::move(key.text),
+                                    std::move(value.text));
+        }
+    }
+    return attributes;
+}
+
+template <typename T>
+std::optional<T> parse_number(std::string_view text) {
+    T value;
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(),
+                                        value);
+    if (error != std::errc() || end != text.data() + text.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+}  // namespace
+
+std::optional<mcis::GraphError> Graph::write_dot(std::ostream& out,
+                                                 bool html_labels) const {
+    BufferedWriter writer(out);
+    writer << "digraph G {\n";
+    for (const auto& [id, node] : nodes) {
+        const std::string_view tag = node->get_tag_view();
+        const std::optional<double> value = node->get_tag_value();
+        writer << "    ";
+        writer.quoted(id);
+        const size_t super_pos = id.find('^');
+        const size_t sub_pos = id.find('_');
+        const bool labelled = html_labels
+                              && (super_pos != std::string::npos
+                                  || sub_pos != std::string::npos);
+        if (labelled || !tag.empty() || value) {
+            writer << " [";
+            if (!tag.empty()) {
+                writer << "tag=";
+                writer.quoted(tag);
+            }
+            if (value) {
+                writer << (tag.empty() ? "" : ", ") << "value=\"" << *value
+                       << "\"";
+            }
+            if (labelled) {
+                writer << (tag.empty() && !value ? "" : ", ")
+                       << "label=<v<SUB>"
+                       << std::string_view(id).substr(sub_pos + 1)
+                       << "</SUB><SUP>"
+                       << std::string_view(id).substr(
+                              super_pos + 1, sub_pos - super_pos - 1)
+                       << "</SUP>(" << tag << ")>";
+            }
+            writer << "]";
+        }
+        writer << ";\n";
+    }
+    for (const auto& [id, node] : nodes) {
+        for (const auto& [child, weight] : node->get_children()) {
+            writer << "    ";
+            writer.quoted(id) << " -> ";
+            writer.quoted(child->id);
+            if (is_weighted) {
+                writer << " [label=\"" << weight << "\"]";
+            }
+            writer << ";\n";
+        }
+    }
+    writer << "}\n";
+    return writer.finish();
+}
+
+std::optional<mcis::GraphError> Graph::write_edge_list(
+    std::ostream& out) const {
+    BufferedWriter writer(out);
+    for (const auto& [id, node] : nodes) {
+        if (id.empty()
+            || std::any_of(id.begin(), id.end(), [](unsigned char c) {
+                   return std::isspace(c);
+               })) {
+            return mcis::GraphError::INVALID_PARAMETERS;
+        }
+        if (node->get_children().empty() && node->get_parents().empty()) {
+            writer << id << "\n";
+        }
+        for (const auto& [child, weight] : node->get_children()) {
+            writer << id << " " << std::string_view(child->id);
+            if (is_weighted) {
+                writer << " " << weight;
+            }
+            writer << "\n";
+        }
+    }
+    return writer.finish();
+}
+
+std::expected<Graph, mcis::GraphError> Graph::read_dot(std::istream& in) {
+    using Kind = DotLexer::Kind;
+    const auto invalid = std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+    DotLexer lexer(in);
+    Graph graph;
+    ChunkedInserter inserter(graph);
+
+    DotLexer::Token token = lexer.next();
+    if (token.kind == Kind::ID && token.text == "strict") {
+        token = lexer.next();
+    }
+    if (token.kind != Kind::ID || token.text != "digraph") {
+        return invalid;
+    }
+    if (lexer.peek().kind == Kind::ID) {
+        lexer.next();
+    }
+    if (lexer.next().kind != Kind::LBRACE) {
+        return invalid;
+    }
+
+    for (;;) {
+        token = lexer.next();
+        if (token.kind == Kind::RBRACE) {
+            break;
+        }
+        if (token.kind == Kind::SEPARATOR) {
+            continue;
+        }
+        if (token.kind != Kind::ID || token.text == "subgraph") {
+            return invalid;
+        }
+
+        // Attribute defaults and graph attributes carry nothing we keep
+        if ((token.text == "graph" || token.text == "node"
+             || token.text == "edge")
+            && lexer.peek().kind == Kind::LBRACKET) {
+            if (!parse_attributes(lexer)) {
+                return invalid;
+            }
+            continue;
+        }
+        if (lexer.peek().kind == Kind::EQUALS) {
+            lexer.next();
+            if (lexer.next().kind != Kind::ID) {
+                return invalid;
+            }
+            continue;
+        }
+
+        std::vector<std::string> chain = {std::move(token.text)};
+        while (lexer.peek().kind == Kind::ARROW) {
+            lexer.next();
+            token = lexer.next();
+            if (token.kind != Kind::ID) {
+                return invalid;
+            }
+            chain.push_back(std::move(token.text));
+        }
+        if (lexer.peek().kind == Kind::UNDIRECTED_EDGE) {
+            return invalid;
+        }
+        auto attributes = parse_attributes(lexer);
+        if (!attributes) {
+            return invalid;
+        }
+
+        if (chain.size() == 1) {
+            inserter.node(chain[0]);
+            std::optional<std::string> tag;
+            std::optional<double> tag_value;
+            for (auto& [key, value] : *attributes) {
+                if (key == "tag") {
+                    tag = std::move(value);
+                } else if (key == "value") {
+                    tag_value = parse_number<double>(value);
+                }
+            }
+            if (tag || tag_value) {
+                inserter.tag(chain[0], tag.value_or(""), tag_value);
+            }
+            continue;
+        }
+        int weight = 0;
+        for (const auto& [key, value] : *attributes) {
+            if (key == "label" || key == "weight") {
+                weight = parse_number<int>(value).value_or(weight);
+            }
+        }
+        for (size_t i = 0; i + 1 < chain.size(); ++i) {
+            if (auto error = inserter.edge(chain[i], chain[i + 1], weight)) {
+                return std::unexpected(*error);
+            }
+        }
+    }
+    if (lexer.next().kind != Kind::END) {
+        return invalid;
+    }
+    if (auto error = inserter.flush()) {
+        return std::unexpected(*error);
+    }
+    return graph;
+}
+
+std::expected<Graph, mcis::GraphError> Graph::read_edge_list(
+    std::istream& in) {
+    Graph graph;
+    ChunkedInserter inserter(graph);
+    std::string line;
+    std::vector<std::string_view> fields;
+    while (std::getline(in, line)) {
+        const std::string_view text
+            = std::string_view(line).substr(0, line.find('#'));
+        fields.clear();
+        for (size_t pos = 0;;) {
+            const size_t begin = text.find_first_not_of(" \t\r", pos);
+            if (begin == std::string_view::npos) {
+                break;
+            }
+            pos = std::min(text.find_first_of(" \t\r", begin), text.size());
+            fields.push_back(text.substr(begin, pos - begin));
+        }
+        if (fields.empty()) {
+            continue;
+        }
+        if (fields.size() == 1) {
+            inserter.node(std::string(fields[0]));
+            continue;
+        }
+        std::optional<int> weight = 0;
+        if (fields.size() == 3) {
+            weight = parse_number<int>(fields[2]);
+        }
+        if (fields.size() > 3 || !weight) {
+            return std::unexpected(mcis::GraphError::INVALID_FILE_FORMAT);
+        }
+        if (auto error = inserter.edge(std::string(fields[0]),
+                                       std::string(fields[1]), *weight)) {
+            return std::unexpected(*error);
+        }
+    }
+    if (in.bad()) {
+        return std::unexpected(mcis::GraphError::FILE_IO_ERROR);
+    }
+    if (auto error = inserter.flush()) {
+        return std::unexpected(*error);
+    }
+    return graph;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file graph_view.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/graph_view.h"
+
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+GraphView::GraphView(const CompactGraph& graph)
+    : parent(&graph), members(graph.get_num_nodes()), full(true) {
+    std::iota(members.begin(), members.end(), 0);
+}
+
+GraphView::GraphView(const CompactGraph& graph, const std::string& tag)
+    : parent(&graph), mask((graph.get_num_nodes() + 63) / 64, 0), full(false) {
+    const std::optional<CompactGraph::TagId> tag_id = graph.find_tag(tag);
+    if (!tag_id) {
+        return;
+    }
+    for (VertexId v = 0; v < graph.get_num_nodes(); ++v) {
+        if (graph.get_tag_id(v) == *tag_id) {
+            add(v);
+        }
+    }
+}
+
+uint32_t GraphView::out_degree(VertexId v) const {
+    if (full) {
+        return parent->out_degree(v);
+    }
+    uint32_t degree = 0;
+    for_each_out_neighbor(v, [&](VertexId) { ++degree; });
+    return degree;
+}
+
+uint32_t GraphView::in_degree(VertexId v) const {
+    if (full) {
+        return parent->in_degree(v);
+    }
+    uint32_t degree = 0;
+    for_each_in_neighbor(v, [&](VertexId) { ++degree; });
+    return degree;
+}
+
+CompactGraph GraphView::materialize() const {
+    constexpr VertexId NOT_KEPT = static_cast<VertexId>(-1);
+    std::vector<VertexId> new_index(parent->get_num_nodes(), NOT_KEPT);
+    std::vector<std::string> sub_ids;
+    sub_ids.reserve(members.size());
+    std::vector<CompactGraph::TagId> new_tag(parent->get_tag_table().size(),
+                                             NOT_KEPT);
+    std::vector<std::string> sub_tag_table;
+    std::vector<CompactGraph::TagId> sub_tags;
+    sub_tags.reserve(members.size());
+    for (const auto v : members) {
+        new_index[v] = static_cast<VertexId>(sub_ids.size());
+        sub_ids.push_back(parent->get_id(v));
+        const CompactGraph::TagId tag = parent->get_tag_id(v);
+        if (new_tag[tag] == NOT_KEPT) {
+            new_tag[tag]
+                = static_cast<CompactGraph::TagId>(sub_tag_table.size());
+            sub_tag_table.push_back(parent->get_tag(v));
+        }
+        sub_tags.push_back(new_tag[tag]);
+    }
+
+    std::vector<uint32_t> sub_offsets(sub_ids.size() + 1, 0);
+    std::vector<VertexId> sub_targets;
+    std::vector<int> sub_weights;
+    for (const auto v : members) {
+        auto targets = parent->out_neighbors(v);
+        auto weights = parent->out_edge_weights(v);
+        for (size_t e = 0; e < targets.size(); ++e) {
+            if (new_index[targets[e]] != NOT_KEPT) {
+                sub_targets.push_back(new_index[targets[e]]);
+                sub_weights.push_back(weights[e]);
+            }
+        }
+        sub_offsets[new_index[v] + 1]
+            = static_cast<uint32_t>(sub_targets.size());
+    }
+
+    return CompactGraph(std::move(sub_ids), std::move(sub_tags),
+                        std::move(sub_tag_table), std::move(sub_offsets),
+                        std::move(sub_targets), std::move(sub_weights));
+}
@@ -11,10 +11,14 @@
 #include <mcis/graph.h>
 #include <omp.h>
 
-#include <iostream>
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "./csr_generator.h"
+
 std::expected<Graph, mcis::GraphError> Graph::create_mvm_graph_from_mat_vec(
     const std::vector<std::vector<std::string>>& mat,
     const std::vector<std::string>& vec) {
@@ -58,13 +62,11 @@ std::expected<Graph, mcis::GraphError> Graph::create_mvm_graph_from_mat_vec(
     // edges from the vector elements
     int incr = 0;
     for (int j = 1; j < (m * n + n); j = j + m + 1) {
-        std::string from_node = vec[incr];
+        const std::string& from_node = vec[incr];
         ++incr;
         int k = (j - 1) / (m + 1);
         for (int i = 0; i < m; ++i) {
             std::string to_node = "v^2_" + std::to_string(j - k + i);
-            std::cout << "Adding edge from " << from_node << " to " << to_node
-                      << std::endl;
             graph.add_edge(from_node, to_node, 0);
         }
     }
@@ -72,7 +74,7 @@ std::expected<Graph, mcis::GraphError> Graph::create_mvm_graph_from_mat_vec(
     // edges from the matrix elements
     for (int j = 0; j < n; ++j) {
         for (int i = 0; i < m; ++i) {
-            std::string from_node = mat[i][j];
+            const std::string& from_node = mat[i][j];
             std::string to_node = "v^2_" + std::to_string(i + ((m * j) + 1));
             graph.add_edge(from_node, to_node, 0);
         }
@@ -140,3 +142,84 @@ std::expected<Graph, mcis::GraphError> Graph::create_mvm_graph_from_dimensions(
 
     return create_mvm_graph_from_mat_vec(mat, vec);
 }
+
+std::expected<CompactGraph, mcis::GraphError>
+CompactGraph::create_mvm_graph_from_dimensions(int m, int n, int num_threads) {
+    if (m <= 0 || n <= 0) {
+        return std::unexpected(mcis::GraphError::INVALID_DIMENSIONS);
+    }
+    // Every vertex is the source of at most one edge per product
+    if (uint64_t{4} * m * n > UINT32_MAX) {
+        return std::unexpected(mcis::GraphError::INVALID_DIMENSIONS);
+    }
+
+    // Vertices are v^1_z (inputs, column by column: the vector element and
+    // then the m matrix elements), then v^2_p (products) and then
+    // v^depth_i (partial sums) for depth 3..n+1, each block in index order
+    const auto rows = static_cast<uint32_t>(m);
+    const auto cols = static_cast<uint32_t>(n);
+    const uint32_t inputs = (rows + 1) * cols;
+    const uint32_t products = rows * cols;
+    const uint32_t num_vertices = inputs + products + rows * (cols - 1);
+    auto partial_sum = [=](uint32_t depth, uint32_t row) -> VertexId {
+        return inputs + products + (depth - 3) * rows + row;
+    };
+
+    auto out_degree = [=](VertexId v) -> uint32_t {
+        if (v < inputs) {
+            // A vector element feeds its whole column of products
+            return v % (rows + 1) == 0 ? rows : 1;
+        }
+        if (v < inputs + products) {
+            return cols >= 2 ? 1 : 0;
+        }
+        return 3 + (v - inputs - products) / rows <= cols ? 1 : 0;
+    };
+    auto fill = [=](VertexId v, VertexId* row) {
+        if (v < inputs) {
+            const uint32_t col = v / (rows + 1);
+            const uint32_t offset = v % (rows + 1);
+            if (offset == 0) {
+                for (uint32_t i = 0; i < rows; ++i) {
+                    row[i] = inputs + col * rows + i;
+                }
+            } else {
+                row[0] = inputs + col * rows + offset - 1;
+            }
+        } else if (v < inputs + products) {
+            // Columns 0 and 1 are summed first, column c joins at depth c + 2
+            const uint32_t col = (v - inputs) / rows;
+            if (cols >= 2) {
+                row[0] = partial_sum(col == 0 ? 3 : col + 2,
+                                     (v - inputs) % rows);
+            }
+        } else {
+            const uint32_t depth = 3 + (v - inputs - products) / rows;
+            if (depth <= cols) {
+                row[0] = partial_sum(depth + 1, (v - inputs - products) % rows);
+            }
+        }
+    };
+    GeneratedCsr csr
+        = generate_csr(num_vertices, out_degree, fill, num_threads);
+
+    std::vector<TagId> node_tags(num_vertices, 2);
+    std::fill(node_tags.begin(), node_tags.begin() + inputs, 0);
+    std::fill(node_tags.begin() + inputs,
+              node_tags.begin() + inputs + products, 1);
+
+    auto name_of = [=](VertexId v) {
+        if (v < inputs) {
+            return "v^1_" + std::to_string(v + 1);
+        }
+        if (v < inputs + products) {
+            return "v^2_" + std::to_string(v - inputs + 1);
+        }
+        const uint32_t q = v - inputs - products;
+        return "v^" + std::to_string(3 + q / rows) + "_"
+               + std::to_string(q % rows + 1);
+    };
+    return CompactGraph(name_of, std::move(node_tags), {"", "*", "+"},
+                        std::move(csr.offsets), std::move(csr.targets),
+                        std::move(csr.weights));
+}
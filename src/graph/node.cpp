@@ -14,12 +14,17 @@
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
-Node::Node(const std::string& id)
-    : id(std::move(id)), num_parents(0), num_children(0), tag("") {}
+Node::Node(std::string_view id, std::pmr::memory_resource* resource)
+    : id(id, resource),
+      num_parents(0),
+      num_children(0),
+      children(resource),
+      parents(resource) {}
 
 Node::Node(const Node& other)
     : id(other.id),
@@ -27,7 +32,9 @@ Node::Node(const Node& other)
       num_children(other.num_children),
       children(other.children),
       parents(other.parents),
-      tag(other.tag) {}
+      tag(other.tag),
+      has_tag_value(other.has_tag_value),
+      tag_value(other.tag_value) {}
 
 Node& Node::operator=(const Node& other) {
     if (this != &other) {
@@ -37,6 +44,8 @@ Node& Node::operator=(const Node& other) {
         children = other.children;
         parents = other.parents;
         tag = other.tag;
+        has_tag_value = other.has_tag_value;
+        tag_value = other.tag_value;
     }
     return *this;
 }
@@ -47,7 +56,9 @@ Node::Node(Node&& other) noexcept
       num_children(other.num_children),
       children(std::move(other.children)),
       parents(std::move(other.parents)),
-      tag(std::move(other.tag)) {
+      tag(other.tag),
+      has_tag_value(other.has_tag_value),
+      tag_value(other.tag_value) {
     other.num_parents = 0;
     other.num_children = 0;
 }
@@ -59,7 +70,9 @@ Node& Node::operator=(Node&& other) noexcept {
         num_children = other.num_children;
         children = std::move(other.children);
         parents = std::move(other.parents);
-        tag = std::move(other.tag);
+        tag = other.tag;
+        has_tag_value = other.has_tag_value;
+        tag_value = other.tag_value;
         other.num_parents = 0;
         other.num_children = 0;
     }
@@ -71,11 +84,41 @@ Node::~Node() {
     parents.clear();
 }
 
-std::string Node::get_id() const { return id; }
+std::string Node::get_id() const { return std::string(id); }
+
+std::string Node::get_tag() const {
+    std::string result(TagSymbols::label(tag));
+    if (has_tag_value) {
+        // Untagged signal nodes read as their value alone, as before tags
+        // carried payloads
+        result += (result.empty() ? "" : ",") + std::to_string(tag_value);
+    }
+    return result;
+}
 
-std::string Node::get_tag() const { return tag; }
+std::string_view Node::get_id_view() const { return id; }
 
-void Node::set_tag(const std::string& new_tag) { tag = new_tag; }
+std::string_view Node::get_tag_view() const { return TagSymbols::label(tag); }
+
+TagSymbols::Symbol Node::get_tag_symbol() const { return tag; }
+
+std::optional<double> Node::get_tag_value() const {
+    if (!has_tag_value) {
+        return std::nullopt;
+    }
+    return tag_value;
+}
+
+void Node::set_tag(std::string_view new_tag) {
+    tag = TagSymbols::intern(new_tag);
+    has_tag_value = false;
+}
+
+void Node::set_tag(std::string_view new_tag, double value) {
+    tag = TagSymbols::intern(new_tag);
+    has_tag_value = true;
+    tag_value = value;
+}
 
 int Node::get_num_parents() const { return num_parents; }
 
@@ -129,9 +172,9 @@ std::optional<mcis::NodeError> Node::remove_parent(Node* parent) {
     return std::nullopt;
 }
 
-bool Node::check_parent(const std::string& parent_id) const {
+bool Node::check_parent(std::string_view parent_id) const {
     for (const auto& [parent, weight] : parents) {
-        if (parent->get_id() == parent_id) {
+        if (parent->get_id_view() == parent_id) {
             return true;
         }
     }
@@ -165,13 +208,14 @@ bool Node::operator==(const Node& other) const {
         return false;
     }
 
-    std::unordered_map<std::string, int> other_children_by_id;
+    std::unordered_map<std::string_view, int> other_children_by_id;
+    other_children_by_id.reserve(other.children.size());
     for (const auto& [child_node, weight] : other.children) {
-        other_children_by_id[child_node->get_id()] = weight;
+        other_children_by_id[child_node->get_id_view()] = weight;
     }
 
     for (const auto& [child_node, weight] : children) {
-        auto it = other_children_by_id.find(child_node->get_id());
+        auto it = other_children_by_id.find(child_node->get_id_view());
         if (it == other_children_by_id.end() || it->second != weight) {
             return false;
         }
@@ -182,11 +226,11 @@ bool Node::operator==(const Node& other) const {
 
 bool Node::same_id(const Node& other) const { return id == other.id; }
 
-const std::unordered_map<Node*, int>& Node::get_children() const {
+const std::pmr::unordered_map<Node*, int>& Node::get_children() const {
     return children;
 }
 
-const std::unordered_map<Node*, int>& Node::get_parents() const {
+const std::pmr::unordered_map<Node*, int>& Node::get_parents() const {
     return parents;
 }
 
@@ -217,9 +261,9 @@ void Node::print_full() const {
         keys[idx++] = key;
     }
     std::sort(keys.begin(), keys.end(),
-              [](Node* a, Node* b) { return a->get_id() < b->get_id(); });
+              [](Node* a, Node* b) { return a->id < b->id; });
     for (const auto key : keys) {
-        std::cout << "  Child ID: " << key->get_id()
+        std::cout << "  Child ID: " << key->id
                   << ", Weight: " << children.at(key) << "\n";
     }
 }
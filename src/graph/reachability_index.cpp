@@ -0,0 +1,251 @@
+/**
+ * @file reachability_index.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <mcis/reachability_index.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t UNVISITED = std::numeric_limits<uint32_t>::max();
+constexpr size_t WORD_BITS = 64;
+
+struct Frame {
+    uint32_t vertex;
+    uint32_t next_edge;
+};
+
+}  // namespace
+
+ReachabilityIndex::ReachabilityIndex(const CompactGraph& graph,
+                                     size_t dense_max_components) {
+    build_components(graph);
+    if (num_components <= dense_max_components) {
+        build_closure();
+    } else {
+        build_labels();
+    }
+}
+
+void ReachabilityIndex::build_components(const CompactGraph& graph) {
+    // Iterative Tarjan; components are completed in reverse topological
+    // order of the condensation
+    const uint32_t n = graph.get_num_nodes();
+    std::vector<uint32_t> index(n, UNVISITED);
+    std::vector<uint32_t> lowlink(n, 0);
+    std::vector<bool> on_stack(n, false);
+    std::vector<VertexId> stack;
+    std::vector<Frame> frames;
+    component.assign(n, 0);
+    uint32_t counter = 0;
+
+    auto visit = [&](VertexId v) {
+        index[v] = lowlink[v] = counter++;
+        stack.push_back(v);
+        on_stack[v] = true;
+        frames.push_back({v, 0});
+    };
+
+    for (VertexId root = 0; root < n; ++root) {
+        if (index[root] != UNVISITED) {
+            continue;
+        }
+        visit(root);
+        while (!frames.empty()) {
+            const VertexId v = frames.back().vertex;
+            auto children = graph.out_neighbors(v);
+            if (frames.back().next_edge < children.size()) {
+                const VertexId w = children[frames.back().next_edge++];
+                if (index[w] == UNVISITED) {
+                    visit(w);
+                } else if (on_stack[w]) {
+                    lowlink[v] = std::min(lowlink[v], index[w]);
+                }
+                continue;
+            }
+
+            frames.pop_back();
+            if (!frames.empty()) {
+                const VertexId parent = frames.back().vertex;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+            }
+            if (lowlink[v] == index[v]) {
+                VertexId w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    on_stack[w] = false;
+                    component[w] = num_components;
+                } while (w != v);
+                ++num_components;
+            }
+        }
+    }
+
+    // Flip the completion order so edges point to larger component numbers
+    for (auto& c : component) {
+        c = num_components - 1 - c;
+    }
+
+    dag_offsets.assign(num_components + 1, 0);
+    for (VertexId v = 0; v < n; ++v) {
+        for (const auto w : graph.out_neighbors(v)) {
+            if (component[v] != component[w]) {
+                ++dag_offsets[component[v] + 1];
+            }
+        }
+    }
+    std::partial_sum(dag_offsets.begin(), dag_offsets.end(),
+                     dag_offsets.begin());
+    dag_targets.resize(dag_offsets.back());
+    std::vector<uint32_t> cursor(dag_offsets.begin(), dag_offsets.end() - 1);
+    for (VertexId v = 0; v < n; ++v) {
+        for (const auto w : graph.out_neighbors(v)) {
+            if (component[v] != component[w]) {
+                dag_targets[cursor[component[v]]++] = component[w];
+            }
+        }
+    }
+
+    // Sort and deduplicate every row, compacting the CSR in place
+    uint32_t write = 0;
+    for (uint32_t c = 0; c < num_components; ++c) {
+        auto begin = dag_targets.begin() + dag_offsets[c];
+        auto end = dag_targets.begin() + dag_offsets[c + 1];
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+        dag_offsets[c] = write;
+        write = static_cast<uint32_t>(
+            std::copy(begin, end, dag_targets.begin() + write)
+            - dag_targets.begin());
+    }
+    dag_offsets[num_components] = write;
+    dag_targets.resize(write);
+}
+
+void ReachabilityIndex::build_closure() {
+    words_per_row = (num_components + WORD_BITS - 1) / WORD_BITS;
+    closure.assign(static_cast<size_t>(num_components) * words_per_row, 0);
+    // Successors have larger numbers, so they are complete when c is reached
+    for (uint32_t c = num_components; c-- > 0;) {
+        uint64_t* row = closure.data() + c * words_per_row;
+        row[c / WORD_BITS] |= uint64_t{1} << (c % WORD_BITS);
+        for (uint32_t e = dag_offsets[c]; e < dag_offsets[c + 1]; ++e) {
+            const uint64_t* child
+                = closure.data() + dag_targets[e] * words_per_row;
+            for (size_t w = dag_targets[e] / WORD_BITS; w < words_per_row;
+                 ++w) {
+                row[w] |= child[w];
+            }
+        }
+    }
+}
+
+void ReachabilityIndex::build_labels() {
+    const uint32_t n = num_components;
+    low.assign(REACHABILITY_NUM_LABELINGS * n, 0);
+    post.assign(REACHABILITY_NUM_LABELINGS * n, 0);
+    std::vector<bool> visited(n);
+    std::vector<Frame> frames;
+
+    for (size_t l = 0; l < REACHABILITY_NUM_LABELINGS; ++l) {
+        // Alternate the root and child order so the labelings differ
+        const bool reversed = l % 2 == 1;
+        uint32_t* low_l = low.data() + l * n;
+        uint32_t* post_l = post.data() + l * n;
+        std::fill(visited.begin(), visited.end(), false);
+        uint32_t counter = 0;
+
+        for (uint32_t i = 0; i < n; ++i) {
+            const uint32_t root = reversed ? n - 1 - i : i;
+            if (visited[root]) {
+                continue;
+            }
+            visited[root] = true;
+            frames.push_back({root, 0});
+            while (!frames.empty()) {
+                const uint32_t c = frames.back().vertex;
+                const uint32_t degree = dag_offsets[c + 1] - dag_offsets[c];
+                if (frames.back().next_edge < degree) {
+                    const uint32_t k = frames.back().next_edge++;
+                    const uint32_t d
+                        = dag_targets[reversed ? dag_offsets[c + 1] - 1 - k
+                                               : dag_offsets[c] + k];
+                    if (!visited[d]) {
+                        visited[d] = true;
+                        frames.push_back({d, 0});
+                    }
+                    continue;
+                }
+
+                // Every successor has finished, whichever DFS reached it
+                frames.pop_back();
+                post_l[c] = counter++;
+                low_l[c] = post_l[c];
+                for (uint32_t e = dag_offsets[c]; e < dag_offsets[c + 1];
+                     ++e) {
+                    low_l[c] = std::min(low_l[c], low_l[dag_targets[e]]);
+                }
+            }
+        }
+    }
+}
+
+bool ReachabilityIndex::labels_contain(uint32_t outer, uint32_t inner) const {
+    const size_t n = num_components;
+    for (size_t l = 0; l < REACHABILITY_NUM_LABELINGS; ++l) {
+        if (low[l * n + outer] > low[l * n + inner]
+            || post[l * n + inner] > post[l * n + outer]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReachabilityIndex::reachable(VertexId from, VertexId to) const {
+    const uint32_t source = component[from];
+    const uint32_t target = component[to];
+    if (source == target) {
+        return true;
+    }
+    if (source > target) {
+        return false;
+    }
+    if (is_dense()) {
+        const uint64_t* row = closure.data() + source * words_per_row;
+        return (row[target / WORD_BITS] >> (target % WORD_BITS)) & 1;
+    }
+    if (!labels_contain(source, target)) {
+        return false;
+    }
+
+    // Labels only rule paths out; confirm with a DFS they prune
+    std::vector<bool> visited(num_components, false);
+    std::vector<uint32_t> stack = {source};
+    visited[source] = true;
+    while (!stack.empty()) {
+        const uint32_t c = stack.back();
+        stack.pop_back();
+        for (uint32_t e = dag_offsets[c]; e < dag_offsets[c + 1]; ++e) {
+            const uint32_t d = dag_targets[e];
+            if (d == target) {
+                return true;
+            }
+            if (d < target && !visited[d] && labels_contain(d, target)) {
+                visited[d] = true;
+                stack.push_back(d);
+            }
+        }
+    }
+    return false;
+}
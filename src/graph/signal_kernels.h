@@ -0,0 +1,128 @@
+/**
+ * @file signal_kernels.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * In-place numeric kernels behind the signal-driven DWT and FFT generators.
+ * The Haar kernel works on blocks of interleaved channels and vectorizes
+ * across them, with AVX and NEON paths selected at compile time (see the
+ * MCIS_NATIVE_ARCH CMake option); the scalar fallback is always available.
+ * The FFT stage works on split real and imaginary arrays so each butterfly
+ * run is a contiguous, vectorizable loop.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef SRC_GRAPH_SIGNAL_KERNELS_H_
+#define SRC_GRAPH_SIGNAL_KERNELS_H_
+
+#include <cstddef>
+#include <numbers>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace mcis::signal {
+
+/**
+ * @brief Replaces even[c] and odd[c] by their Haar average (even + odd) /
+ * sqrt(2) and coefficient (even - odd) / sqrt(2), for every c < lanes.
+ */
+inline void haar_butterfly(double* even, double* odd, size_t lanes) {
+    size_t c = 0;
+#if defined(__AVX__)
+    const __m256d root = _mm256_set1_pd(std::numbers::sqrt2);
+    for (; c + 4 <= lanes; c += 4) {
+        const __m256d a = _mm256_loadu_pd(even + c);
+        const __m256d b = _mm256_loadu_pd(odd + c);
+        _mm256_storeu_pd(even + c, _mm256_div_pd(_mm256_add_pd(a, b), root));
+        _mm256_storeu_pd(odd + c, _mm256_div_pd(_mm256_sub_pd(a, b), root));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float64x2_t root = vdupq_n_f64(std::numbers::sqrt2);
+    for (; c + 2 <= lanes; c += 2) {
+        const float64x2_t a = vld1q_f64(even + c);
+        const float64x2_t b = vld1q_f64(odd + c);
+        vst1q_f64(even + c, vdivq_f64(vaddq_f64(a, b), root));
+        vst1q_f64(odd + c, vdivq_f64(vsubq_f64(a, b), root));
+    }
+#endif
+    for (; c < lanes; ++c) {
+        const double a = even[c];
+        const double b = odd[c];
+        even[c] = (a + b) / std::numbers::sqrt2;
+        odd[c] = (a - b) / std::numbers::sqrt2;
+    }
+}
+
+/**
+ * @brief Runs one level of the Haar transform in place on a block of
+ * interleaved channels, where samples[i * channels + c] is sample i of
+ * channel c. Level l combines positions i and i + 2^l for every i that is a
+ * multiple of 2^(l + 1): afterwards position i holds average j = i / 2^(l +
+ * 1) of the level and position i + 2^l its coefficient. Coefficients are
+ * never touched again by later levels; averages are their input.
+ * @param samples The block, length * channels values.
+ * @param length Samples per channel, a power of two.
+ * @param channels Number of channels.
+ * @param level Level to compute, 0 for the first.
+ */
+inline void haar_level_in_place(double* samples, size_t length,
+                                size_t channels, unsigned level) {
+    const size_t stride = size_t{1} << level;
+    for (size_t i = 0; i + stride < length; i += 2 * stride) {
+        haar_butterfly(samples + i * channels,
+                       samples + (i + stride) * channels, channels);
+    }
+}
+
+/**
+ * @brief Runs every level of the Haar transform in place; see
+ * haar_level_in_place for the resulting layout.
+ */
+inline void haar_transform_in_place(double* samples, size_t length,
+                                    size_t channels) {
+    for (unsigned level = 0; (size_t{1} << level) < length; ++level) {
+        haar_level_in_place(samples, length, channels, level);
+    }
+}
+
+/**
+ * @brief Runs one radix-2 decimation-in-frequency stage in place. Within
+ * each block of 2 * half points, point j and j + half become their sum and
+ * their difference times the twiddle w^j.
+ * @param re Real parts of the n points.
+ * @param im Imaginary parts of the n points.
+ * @param n Number of points, a multiple of 2 * half.
+ * @param half Half the block size of the stage.
+ * @param w_re Real parts of the half twiddles of the stage.
+ * @param w_im Imaginary parts of the half twiddles of the stage.
+ */
+inline void fft_dif_stage(double* re, double* im, size_t n, size_t half,
+                          const double* w_re, const double* w_im) {
+    for (size_t block = 0; block < n; block += 2 * half) {
+        double* top_re = re + block;
+        double* top_im = im + block;
+        double* bottom_re = top_re + half;
+        double* bottom_im = top_im + half;
+#pragma omp simd
+        for (size_t j = 0; j < half; ++j) {
+            const double d_re = top_re[j] - bottom_re[j];
+            const double d_im = top_im[j] - bottom_im[j];
+            top_re[j] += bottom_re[j];
+            top_im[j] += bottom_im[j];
+            bottom_re[j] = d_re * w_re[j] - d_im * w_im[j];
+            bottom_im[j] = d_re * w_im[j] + d_im * w_re[j];
+        }
+    }
+}
+
+}  // namespace mcis::signal
+
+#endif  // SRC_GRAPH_SIGNAL_KERNELS_H_
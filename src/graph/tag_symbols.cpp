@@ -0,0 +1,79 @@
+/**
+ * @file tag_symbols.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include <mcis/tag_symbols.h>
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+struct Table {
+    std::shared_mutex mutex;
+
+    // A deque never moves its elements, so views into them stay valid
+    std::deque<std::string> labels = {std::string()};
+    std::unordered_map<std::string_view, TagSymbols::Symbol> symbols
+        = {{std::string_view(), TagSymbols::UNTAGGED}};
+};
+
+Table& table() {
+    static Table instance;
+    return instance;
+}
+
+}  // namespace
+
+TagSymbols::Symbol TagSymbols::intern(std::string_view label) {
+    Table& t = table();
+    {
+        std::shared_lock lock(t.mutex);
+        auto it = t.symbols.find(label);
+        if (it != t.symbols.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock(t.mutex);
+    auto it = t.symbols.find(label);
+    if (it != t.symbols.end()) {
+        return it->second;
+    }
+    const auto symbol = static_cast<Symbol>(t.labels.size());
+    t.labels.emplace_back(label);
+    t.symbols.emplace(t.labels.back(), symbol);
+    return symbol;
+}
+
+std::optional<TagSymbols::Symbol> TagSymbols::find(std::string_view label) {
+    Table& t = table();
+    std::shared_lock lock(t.mutex);
+    auto it = t.symbols.find(label);
+    if (it == t.symbols.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::string_view TagSymbols::label(Symbol symbol) {
+    Table& t = table();
+    std::shared_lock lock(t.mutex);
+    return t.labels[symbol];
+}
+
+size_t TagSymbols::size() {
+    Table& t = table();
+    std::shared_lock lock(t.mutex);
+    return t.labels.size();
+}
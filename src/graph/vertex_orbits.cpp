@@ -0,0 +1,330 @@
+/**
+ * @file vertex_orbits.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Orbit detection by individualization and refinement. Colors are always
+ * renumbered by the rank of each vertex's signature (its own color and the
+ * sorted colors of its out- and in-neighbours), which does not depend on
+ * vertex numbering, so two isomorphic colorings refine to colorings that
+ * agree under the isomorphism. Searching for an automorphism that maps r to
+ * w therefore refines one copy with r individualized and another with w
+ * individualized, and keeps individualizing matching vertices of the first
+ * non-singleton color until both are discrete; the matching colors then
+ * give the candidate map, which is checked against every edge.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/vertex_orbits.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t NONE = UINT32_MAX;
+
+/**
+ * @brief A view's adjacency over local indices 0..m-1 and the refinement
+ * and search built on it.
+ */
+class OrbitSearch {
+ public:
+    OrbitSearch(const GraphView& view,
+                std::span<const CompactGraph::VertexId> fixed, uint64_t budget)
+        : m(view.get_num_nodes()), budget(budget) {
+        const CompactGraph& graph = view.graph();
+        const auto vertices = view.vertices();
+        std::vector<uint32_t> local(graph.get_num_nodes(), NONE);
+        for (uint32_t i = 0; i < m; ++i) {
+            local[vertices[i]] = i;
+        }
+        out_offsets.assign(m + 1, 0);
+        in_offsets.assign(m + 1, 0);
+        for (uint32_t i = 0; i < m; ++i) {
+            view.for_each_out_neighbor(vertices[i], [&](auto u) {
+                out_adjacency.push_back(local[u]);
+            });
+            std::sort(out_adjacency.begin() + out_offsets[i],
+                      out_adjacency.end());
+            out_offsets[i + 1] = static_cast<uint32_t>(out_adjacency.size());
+            view.for_each_in_neighbor(vertices[i], [&](auto u) {
+                in_adjacency.push_back(local[u]);
+            });
+            in_offsets[i + 1] = static_cast<uint32_t>(in_adjacency.size());
+        }
+
+        // Start from the tags, numbered by rank, with every fixed vertex
+        // in a color of its own after them
+        std::vector<uint32_t> tags(m);
+        for (uint32_t i = 0; i < m; ++i) {
+            tags[i] = graph.get_tag_id(vertices[i]);
+        }
+        const auto num_tags
+            = static_cast<uint32_t>(graph.get_tag_table().size());
+        uint32_t own = num_tags;
+        for (const auto v : fixed) {
+            // A vertex fixed twice keeps its first color
+            if (view.contains(v) && tags[local[v]] < num_tags) {
+                tags[local[v]] = own++;
+            }
+        }
+        std::vector<uint32_t> sorted = tags;
+        std::ranges::sort(sorted);
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        base.resize(m);
+        for (uint32_t i = 0; i < m; ++i) {
+            base[i] = static_cast<uint32_t>(
+                std::ranges::lower_bound(sorted, tags[i]) - sorted.begin());
+        }
+        base_colors = refine(base, static_cast<uint32_t>(sorted.size()));
+    }
+
+    /**
+     * @brief Merges every pair of vertices an automorphism found maps onto
+     * each other. Each vertex is tried against one representative of every
+     * orbit already seen in its color, since one equitable color can hold
+     * several orbits; a vertex no representative maps to starts an orbit of
+     * its own.
+     */
+    void run(std::vector<uint32_t>& parent, size_t& num_generators) {
+        std::vector<std::vector<uint32_t>> representatives(base_colors);
+        std::vector<uint32_t> sigma(m);
+        for (uint32_t w = 0; w < m; ++w) {
+            auto& seen = representatives[base[w]];
+            bool matched = false;
+            for (const auto r : seen) {
+                if (exhausted()) {
+                    return;
+                }
+                if (find(parent, r) == find(parent, w)) {
+                    matched = true;
+                    break;
+                }
+                std::vector<uint32_t> a = base;
+                std::vector<uint32_t> b = base;
+                const uint32_t k = individualize(a, r, base_colors);
+                if (k == individualize(b, w, base_colors)
+                    && same_histogram(a, b, k) && extend(a, b, k, sigma)) {
+                    ++num_generators;
+                    for (uint32_t x = 0; x < m; ++x) {
+                        unite(parent, x, sigma[x]);
+                    }
+                    matched = true;
+                    break;
+                }
+            }
+            if (!matched) {
+                seen.push_back(w);
+            }
+        }
+    }
+
+    uint32_t size() const { return m; }
+
+    bool exhausted() const { return refinements >= budget; }
+
+    static uint32_t find(std::vector<uint32_t>& parent, uint32_t x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+ private:
+    const uint32_t m;
+    const uint64_t budget;
+    uint64_t refinements = 0;
+    std::vector<uint32_t> out_offsets, out_adjacency;
+    std::vector<uint32_t> in_offsets, in_adjacency;
+    std::vector<uint32_t> base;
+    uint32_t base_colors = 0;
+
+    // Refinement scratch
+    std::vector<uint32_t> signatures, signature_offsets, order;
+
+    static void unite(std::vector<uint32_t>& parent, uint32_t x, uint32_t y) {
+        x = find(parent, x);
+        y = find(parent, y);
+        if (x != y) {
+            parent[std::max(x, y)] = std::min(x, y);
+        }
+    }
+
+    std::span<const uint32_t> signature(uint32_t v) const {
+        return {signatures.data() + signature_offsets[v],
+                signatures.data() + signature_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Refines a coloring until every vertex of a color sees the same
+     * colors, renumbering colors by the rank of their signatures.
+     * @return The number of colors.
+     */
+    uint32_t refine(std::vector<uint32_t>& color, uint32_t num_colors) {
+        ++refinements;
+        order.resize(m);
+        signature_offsets.resize(m + 1);
+        while (true) {
+            signatures.clear();
+            signature_offsets[0] = 0;
+            for (uint32_t v = 0; v < m; ++v) {
+                signatures.push_back(color[v]);
+                for (const bool outgoing : {true, false}) {
+                    const auto& offsets = outgoing ? out_offsets : in_offsets;
+                    const auto& adjacency
+                        = outgoing ? out_adjacency : in_adjacency;
+                    const size_t begin = signatures.size();
+                    for (uint32_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+                        signatures.push_back(color[adjacency[e]]);
+                    }
+                    std::sort(signatures.begin() + begin, signatures.end());
+                    signatures.push_back(NONE);
+                }
+                signature_offsets[v + 1]
+                    = static_cast<uint32_t>(signatures.size());
+            }
+
+            std::iota(order.begin(), order.end(), 0);
+            std::ranges::sort(order, [&](uint32_t x, uint32_t y) {
+                return std::ranges::lexicographical_compare(signature(x),
+                                                            signature(y));
+            });
+            uint32_t k = 0;
+            for (uint32_t i = 0; i < m; ++i) {
+                if (i > 0
+                    && !std::ranges::equal(signature(order[i - 1]),
+                                           signature(order[i]))) {
+                    ++k;
+                }
+                color[order[i]] = k;
+            }
+            k = m == 0 ? 0 : k + 1;
+            if (k == num_colors) {
+                return k;
+            }
+            num_colors = k;
+        }
+    }
+
+    /**
+     * @brief Gives one vertex a color of its own, just above its old color,
+     * and refines.
+     */
+    uint32_t individualize(std::vector<uint32_t>& color, uint32_t v,
+                           uint32_t num_colors) {
+        for (auto& c : color) {
+            c *= 2;
+        }
+        ++color[v];
+        return refine(color, num_colors + 1);
+    }
+
+    bool same_histogram(const std::vector<uint32_t>& a,
+                        const std::vector<uint32_t>& b, uint32_t k) const {
+        std::vector<int64_t> counts(k, 0);
+        for (uint32_t v = 0; v < m; ++v) {
+            ++counts[a[v]];
+            --counts[b[v]];
+        }
+        return std::ranges::all_of(counts, [](int64_t c) { return c == 0; });
+    }
+
+    /**
+     * @brief Individualizes matching vertices of two equitable colorings
+     * until they are discrete and map to an automorphism.
+     * @param sigma Receives the automorphism on success.
+     * @return True if an automorphism was found within the budget.
+     */
+    bool extend(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b,
+                uint32_t k, std::vector<uint32_t>& sigma) {
+        if (k == m) {
+            std::vector<uint32_t> by_color(m);
+            for (uint32_t v = 0; v < m; ++v) {
+                by_color[b[v]] = v;
+            }
+            for (uint32_t v = 0; v < m; ++v) {
+                sigma[v] = by_color[a[v]];
+            }
+            return is_automorphism(sigma);
+        }
+
+        // Branch on the first vertex of the first color with several
+        std::vector<uint32_t> counts(k, 0);
+        for (const auto c : a) {
+            ++counts[c];
+        }
+        const auto target = static_cast<uint32_t>(
+            std::ranges::find_if(counts, [](uint32_t c) { return c > 1; })
+            - counts.begin());
+        const auto x = static_cast<uint32_t>(
+            std::ranges::find(a, target) - a.begin());
+        for (uint32_t y = 0; y < m; ++y) {
+            if (b[y] != target) {
+                continue;
+            }
+            if (exhausted()) {
+                return false;
+            }
+            std::vector<uint32_t> next_a = a;
+            std::vector<uint32_t> next_b = b;
+            const uint32_t next_k = individualize(next_a, x, k);
+            if (next_k == individualize(next_b, y, k)
+                && same_histogram(next_a, next_b, next_k)
+                && extend(next_a, next_b, next_k, sigma)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool is_automorphism(const std::vector<uint32_t>& sigma) const {
+        // A bijection that keeps colors and maps every edge to an edge maps
+        // the edges onto the edges, since there are as many of each
+        for (uint32_t v = 0; v < m; ++v) {
+            if (base[v] != base[sigma[v]]) {
+                return false;
+            }
+            const auto begin = out_adjacency.begin() + out_offsets[sigma[v]];
+            const auto end = out_adjacency.begin() + out_offsets[sigma[v] + 1];
+            for (uint32_t e = out_offsets[v]; e < out_offsets[v + 1]; ++e) {
+                if (!std::binary_search(begin, end,
+                                        sigma[out_adjacency[e]])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+}  // namespace
+
+VertexOrbits::VertexOrbits(const GraphView& view,
+                           std::span<const VertexId> fixed, uint64_t budget)
+    : orbit_of(view.graph().get_num_nodes(), NO_ORBIT) {
+    OrbitSearch search(view, fixed, budget);
+    std::vector<uint32_t> parent(search.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    search.run(parent, num_generators);
+    exact = !search.exhausted();
+
+    const auto vertices = view.vertices();
+    std::vector<uint32_t> dense(search.size(), NO_ORBIT);
+    for (uint32_t i = 0; i < search.size(); ++i) {
+        uint32_t& id = dense[OrbitSearch::find(parent, i)];
+        if (id == NO_ORBIT) {
+            id = num_orbits++;
+        }
+        orbit_of[vertices[i]] = id;
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file batch_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class BatchTest : public MCISAlgorithmTest {
+ protected:
+    void SetUp() override {
+        MCISAlgorithmTest::SetUp();
+        std::mt19937 rng(11);
+        for (const int n : {6, 9, 12, 14}) {
+            const std::string prefix = "g" + std::to_string(n) + "_";
+            Graph graph = random_dag(n, 0.4, rng, prefix);
+            for (int i = 0; i < n; ++i) {
+                graph.set_node_tag(prefix + std::to_string(i),
+                                   i % 2 ? "+" : "*");
+            }
+            graphs.push_back(std::move(graph));
+        }
+    }
+
+    std::vector<Graph> graphs;
+
+    // All pairs of the fixture graphs, under every exact finder
+    std::vector<BatchJob> all_pairs() const {
+        std::vector<BatchJob> jobs;
+        for (size_t i = 0; i < graphs.size(); ++i) {
+            for (size_t j = i + 1; j < graphs.size(); ++j) {
+                for (const auto type :
+                     {AlgorithmType::MAX_CLIQUE,
+                      AlgorithmType::MAX_CLIQUE_PARALLEL,
+                      AlgorithmType::BRON_KERBOSCH_BITSET}) {
+                    BatchJob job;
+                    job.graphs = {&graphs[i], &graphs[j]};
+                    job.type = type;
+                    job.tag = (i + j) % 2 ? std::optional<std::string>("+")
+                                          : std::nullopt;
+                    jobs.push_back(job);
+                }
+            }
+        }
+        return jobs;
+    }
+};
+
+// Test 1: Batch results match one-at-a-time runs and arrive in job order
+TEST_F(BatchTest, MatchesSequentialRuns) {
+    const std::vector<BatchJob> jobs = all_pairs();
+    std::vector<size_t> finished;
+    const auto results = mcis_algorithm->run_batch(
+        jobs, 4, [&](const BatchResult& result) {
+            finished.push_back(result.job);
+        });
+    ASSERT_EQ(results.size(), jobs.size());
+    EXPECT_EQ(finished.size(), jobs.size());
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        EXPECT_EQ(results[i].job, i);
+        ASSERT_TRUE(results[i].graphs.has_value());
+        ASSERT_FALSE(results[i].graphs->empty());
+        auto expected = mcis_algorithm->run(jobs[i].graphs, jobs[i].type,
+                                            jobs[i].tag);
+        ASSERT_TRUE(expected.has_value());
+        EXPECT_EQ((*results[i].graphs)[0].get_num_nodes(),
+                  (*expected)[0]->get_num_nodes())
+            << i;
+        EXPECT_EQ(results[i].report.status, SearchStatus::COMPLETE);
+        EXPECT_EQ(results[i].report.best_size,
+                  (*results[i].graphs)[0].get_num_nodes());
+        EXPECT_GT(results[i].candidate_stats.total, 0u);
+        for (auto* graph : *expected) {
+            delete graph;
+        }
+    }
+}
+
+// Test 2: A failing job reports its error without stopping the others
+TEST_F(BatchTest, FailedJobsDoNotStopTheBatch) {
+    Graph empty;
+    std::vector<BatchJob> jobs(3);
+    jobs[0].graphs = {&graphs[0], &graphs[1]};
+    jobs[1].graphs = {&graphs[0], &empty};
+    jobs[2].graphs = {&graphs[2], &graphs[3]};
+    jobs[2].type = AlgorithmType::KPT;
+    const auto results = mcis_algorithm->run_batch(jobs, 2);
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(results[0].graphs.has_value());
+    ASSERT_FALSE(results[1].graphs.has_value());
+    EXPECT_EQ(results[1].graphs.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+    EXPECT_TRUE(results[2].graphs.has_value());
+
+    EXPECT_TRUE(mcis_algorithm->run_batch({}).empty());
+}
@@ -0,0 +1,191 @@
+/**
+ * @file candidate_filter_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class CandidateFilterTest : public MCISAlgorithmTest {
+ protected:
+    // Runs one algorithm and returns the node IDs of its first result
+    std::vector<std::string> run_ids(const std::vector<const Graph*>& graphs,
+                                     AlgorithmType type,
+                                     const RunOptions& options) {
+        auto result = mcis_algorithm->run(graphs, type, std::nullopt, options);
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return {};
+        }
+        std::vector<std::string> ids;
+        for (const auto& [id, node] : (*result)[0]->get_nodes()) {
+            ids.push_back(id);
+        }
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return ids;
+    }
+
+    static uint64_t pruned_sum(const CandidateFilterStats& stats) {
+        return stats.pruned_by_tag + stats.pruned_by_source_sink
+               + stats.pruned_by_degree + stats.pruned_by_level;
+    }
+
+    // Nodes named "p<i>" are tagged "+" and nodes named "m<i>" are tagged "*"
+    static Graph tagged_chain(int plus, int times) {
+        Graph g;
+        std::vector<std::string> ids;
+        for (int i = 0; i < plus; ++i) {
+            ids.push_back("p" + std::to_string(i));
+            g.add_node(ids.back());
+            g.set_node_tag(ids.back(), "+");
+        }
+        for (int i = 0; i < times; ++i) {
+            ids.push_back("m" + std::to_string(i));
+            g.add_node(ids.back());
+            g.set_node_tag(ids.back(), "*");
+        }
+        for (size_t i = 0; i + 1 < ids.size(); ++i) {
+            g.add_edge(ids[i], ids[i + 1], 0);
+        }
+        return g;
+    }
+};
+
+// Test 1: With no rules enabled every tuple is kept and results are unchanged
+TEST_F(CandidateFilterTest, DisabledFilterKeepsEveryTuple) {
+    std::mt19937 rng(3);
+    Graph g1 = random_dag(6, 0.4, rng, "u");
+    Graph g2 = random_dag(5, 0.5, rng, "v");
+    CandidateFilterStats stats;
+    RunOptions options;
+    options.candidate_stats = &stats;
+    auto with_stats = run_ids({&g1, &g2}, AlgorithmType::MAX_CLIQUE, options);
+    auto plain = run_ids({&g1, &g2}, AlgorithmType::MAX_CLIQUE, {});
+    EXPECT_EQ(stats.total, 30u);
+    EXPECT_EQ(stats.kept, 30u);
+    EXPECT_EQ(stats.pruned(), 0u);
+    EXPECT_EQ(with_stats.size(), plain.size());
+}
+
+// Test 2: Tag matching keeps only tuples of equally tagged vertices
+TEST_F(CandidateFilterTest, TagMatchingPrunesMismatchedTuples) {
+    Graph g1 = tagged_chain(3, 2);
+    Graph g2 = tagged_chain(2, 3);
+    CandidateFilterStats stats;
+    RunOptions options;
+    options.candidate_filter.match_tags = true;
+    options.candidate_stats = &stats;
+    auto ids = run_ids({&g1, &g2}, AlgorithmType::MAX_CLIQUE, options);
+    EXPECT_EQ(stats.total, 25u);
+    EXPECT_EQ(stats.kept, 3u * 2 + 2u * 3);
+    EXPECT_EQ(stats.pruned_by_tag, 13u);
+    ASSERT_FALSE(ids.empty());
+    for (const auto& id : ids) {
+        const size_t split = id.find('_');
+        ASSERT_NE(split, std::string::npos);
+        EXPECT_EQ(id[0], id[split + 1]) << id;
+    }
+}
+
+// Test 3: Every algorithm sees the same counts, and they add up
+TEST_F(CandidateFilterTest, StatsAddUpForEveryAlgorithm) {
+    std::mt19937 rng(11);
+    Graph g1 = random_dag(7, 0.4, rng, "u");
+    Graph g2 = random_dag(6, 0.4, rng, "v");
+    RunOptions options;
+    options.candidate_filter.match_sources_and_sinks = true;
+    options.candidate_filter.max_degree_difference = 1;
+    options.candidate_filter.max_level_difference = 1;
+
+    std::vector<CandidateFilterStats> all_stats;
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_SERIAL, AlgorithmType::KPT,
+          AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+        CandidateFilterStats stats;
+        options.candidate_stats = &stats;
+        run_ids({&g1, &g2}, type, options);
+        EXPECT_EQ(stats.total, 42u);
+        EXPECT_EQ(stats.kept + pruned_sum(stats), stats.total);
+        all_stats.push_back(stats);
+    }
+    for (const auto& stats : all_stats) {
+        EXPECT_EQ(stats.kept, all_stats[0].kept);
+        EXPECT_EQ(stats.pruned_by_degree, all_stats[0].pruned_by_degree);
+        EXPECT_EQ(stats.pruned_by_level, all_stats[0].pruned_by_level);
+    }
+}
+
+// Test 4: Identical graphs keep their full MCIS under the strictest rules
+TEST_F(CandidateFilterTest, IdenticalGraphsSurviveAllRules) {
+    auto fft1 = Graph::create_fft_graph_from_dimensions(4);
+    auto fft2 = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(fft1.has_value() && fft2.has_value());
+    CandidateFilterStats stats;
+    RunOptions options;
+    options.candidate_filter.match_tags = true;
+    options.candidate_filter.match_sources_and_sinks = true;
+    options.candidate_filter.max_degree_difference = 0;
+    options.candidate_filter.max_level_difference = 0;
+    options.candidate_stats = &stats;
+    auto ids = run_ids({&*fft1, &*fft2}, AlgorithmType::MAX_CLIQUE, options);
+    EXPECT_EQ(ids.size(), fft1->get_num_nodes());
+    EXPECT_LE(stats.kept * 4, stats.total);
+}
+
+// Test 5: KPT draws its hyperedges from the filtered tuples
+TEST_F(CandidateFilterTest, KPTUsesFilteredHyperedges) {
+    Graph g1 = tagged_chain(2, 2);
+    Graph g2 = tagged_chain(2, 2);
+    CandidateFilterStats stats;
+    RunOptions options;
+    options.candidate_filter.match_tags = true;
+    options.candidate_stats = &stats;
+    auto ids = run_ids({&g1, &g2}, AlgorithmType::KPT, options);
+    EXPECT_EQ(stats.kept, 8u);
+    ASSERT_FALSE(ids.empty());
+    for (const auto& id : ids) {
+        const size_t split = id.find('_');
+        ASSERT_NE(split, std::string::npos);
+        EXPECT_EQ(id[0], id[split + 1]) << id;
+    }
+}
+
+// Test 6: Vertices on a cycle have no level and are never pruned by level
+TEST_F(CandidateFilterTest, LevelRuleIgnoresCycles) {
+    Graph cycle, chain;
+    cycle.add_node("a");
+    cycle.add_node("b");
+    cycle.add_edge("a", "b", 0);
+    cycle.add_edge("b", "a", 0);
+    chain.add_node("x");
+    chain.add_node("y");
+    chain.add_node("z");
+    chain.add_edge("x", "y", 0);
+    chain.add_edge("y", "z", 0);
+    CandidateFilterStats stats;
+    RunOptions options;
+    options.candidate_filter.max_level_difference = 0;
+    options.candidate_stats = &stats;
+    run_ids({&cycle, &chain}, AlgorithmType::BRON_KERBOSCH_BITSET, options);
+    EXPECT_EQ(stats.total, 6u);
+    EXPECT_EQ(stats.kept, 6u);
+
+    run_ids({&chain, &chain}, AlgorithmType::BRON_KERBOSCH_BITSET, options);
+    EXPECT_EQ(stats.kept, 3u);
+    EXPECT_EQ(stats.pruned_by_level, 6u);
+}
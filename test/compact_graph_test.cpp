@@ -0,0 +1,319 @@
+/**
+ * @file compact_graph_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include "mcis/compact_graph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class CompactGraphTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        graph.add_node("C");
+        graph.add_node("A");
+        graph.add_node("B");
+        graph.add_node("D");
+        graph.set_node_tag("A", "+");
+        graph.set_node_tag("B", "*");
+        graph.set_node_tag("C", "+");
+        graph.add_edge("A", "B", 2);
+        graph.add_edge("A", "C", 0);
+        graph.add_edge("B", "C", 5);
+        graph.add_edge("C", "D", 0);
+    }
+
+    Graph graph;
+};
+
+// Test 1: Verifies an empty graph freezes to an empty snapshot
+TEST_F(CompactGraphTest, EmptyGraph) {
+    Graph empty;
+    CompactGraph compact = empty.freeze();
+    EXPECT_EQ(compact.get_num_nodes(), 0u);
+    EXPECT_EQ(compact.get_num_edges(), 0u);
+    EXPECT_FALSE(compact.get_index("A").has_value());
+}
+
+// Test 2: Verifies vertex IDs are dense and ordered by node ID
+TEST_F(CompactGraphTest, DenseSortedVertexIds) {
+    CompactGraph compact = graph.freeze();
+    ASSERT_EQ(compact.get_num_nodes(), 4u);
+    EXPECT_EQ(compact.get_num_edges(), 4u);
+
+    const std::vector<std::string> expected = {"A", "B", "C", "D"};
+    for (CompactGraph::VertexId v = 0; v < compact.get_num_nodes(); ++v) {
+        EXPECT_EQ(compact.get_id(v), expected[v]);
+        ASSERT_TRUE(compact.get_index(expected[v]).has_value());
+        EXPECT_EQ(*compact.get_index(expected[v]), v);
+    }
+    EXPECT_FALSE(compact.get_index("E").has_value());
+}
+
+// Test 3: Verifies out- and in-edge CSR rows, weights and degrees
+TEST_F(CompactGraphTest, CsrAdjacency) {
+    CompactGraph compact = graph.freeze();
+    const auto a = *compact.get_index("A");
+    const auto b = *compact.get_index("B");
+    const auto c = *compact.get_index("C");
+    const auto d = *compact.get_index("D");
+
+    auto a_out = compact.out_neighbors(a);
+    ASSERT_EQ(a_out.size(), 2u);
+    EXPECT_EQ(a_out[0], b);
+    EXPECT_EQ(a_out[1], c);
+    EXPECT_EQ(compact.out_edge_weights(a)[0], 2);
+    EXPECT_EQ(compact.out_edge_weights(a)[1], 0);
+
+    auto c_in = compact.in_neighbors(c);
+    ASSERT_EQ(c_in.size(), 2u);
+    EXPECT_EQ(c_in[0], a);
+    EXPECT_EQ(c_in[1], b);
+    EXPECT_EQ(compact.in_edge_weights(c)[1], 5);
+
+    EXPECT_EQ(compact.in_degree(a), 0u);
+    EXPECT_EQ(compact.out_degree(d), 0u);
+    EXPECT_EQ(compact.in_degree(d), 1u);
+
+    EXPECT_TRUE(compact.has_edge(a, b));
+    EXPECT_TRUE(compact.has_edge(c, d));
+    EXPECT_FALSE(compact.has_edge(b, a));
+    EXPECT_FALSE(compact.has_edge(a, d));
+    EXPECT_TRUE(compact.weighted());
+}
+
+// Test 4: Verifies tags are interned into a shared table
+TEST_F(CompactGraphTest, InternedTags) {
+    CompactGraph compact = graph.freeze();
+    const auto a = *compact.get_index("A");
+    const auto b = *compact.get_index("B");
+    const auto c = *compact.get_index("C");
+    const auto d = *compact.get_index("D");
+
+    EXPECT_EQ(compact.get_tag_table().size(), 3u);
+    EXPECT_EQ(compact.get_tag_id(a), compact.get_tag_id(c));
+    EXPECT_NE(compact.get_tag_id(a), compact.get_tag_id(b));
+    EXPECT_EQ(compact.get_tag(b), "*");
+    EXPECT_EQ(compact.get_tag(d), "");
+    ASSERT_TRUE(compact.find_tag("+").has_value());
+    EXPECT_EQ(*compact.find_tag("+"), compact.get_tag_id(a));
+    EXPECT_FALSE(compact.find_tag("-").has_value());
+}
+
+// Test 5: Verifies tag-filtered subgraphs match Graph::get_subgraph_with_tag
+TEST_F(CompactGraphTest, SubgraphWithTag) {
+    CompactGraph sub = graph.freeze().get_subgraph_with_tag("+");
+    ASSERT_EQ(sub.get_num_nodes(), 2u);
+    EXPECT_EQ(sub.get_id(0), "A");
+    EXPECT_EQ(sub.get_id(1), "C");
+    EXPECT_TRUE(sub.has_edge(0, 1));
+    EXPECT_EQ(sub.get_num_edges(), 1u);
+    EXPECT_EQ(sub.get_tag(0), "+");
+
+    EXPECT_EQ(graph.freeze().get_subgraph_with_tag("missing").get_num_nodes(),
+              0u);
+}
+
+// Test 6: Verifies freezing and thawing round-trips the graph
+TEST_F(CompactGraphTest, ThawRoundTrip) {
+    Graph thawed = graph.freeze().thaw();
+    EXPECT_TRUE(thawed == graph);
+    EXPECT_EQ(thawed.get_node("B")->get_tag(), "*");
+    EXPECT_TRUE(thawed.is_dag());
+}
+
+// Test 7: Verifies finders accept frozen graphs directly
+TEST_F(CompactGraphTest, FindersAcceptCompactGraphs) {
+    auto mvm = Graph::create_mvm_graph_from_dimensions(2, 2);
+    ASSERT_TRUE(mvm.has_value());
+    CompactGraph compact_mvm = mvm->freeze();
+    CompactGraph compact_graph = graph.freeze();
+
+    MCISAlgorithm mcis_algorithm;
+    std::vector<const CompactGraph*> graphs = {&compact_graph, &compact_mvm};
+    for (auto type : {AlgorithmType::BRON_KERBOSCH_SERIAL, AlgorithmType::KPT}) {
+        auto result = mcis_algorithm.run(graphs, type);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_FALSE(result->empty());
+        for (auto* g : *result) {
+            EXPECT_GT(g->get_num_nodes(), 0);
+            delete g;
+        }
+    }
+
+    CompactGraph empty;
+    std::vector<const CompactGraph*> with_empty = {&empty, &compact_mvm};
+    auto result = mcis_algorithm.run(with_empty, AlgorithmType::KPT);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+}
+
+// Test 8: Braced lists of graphs pick the Graph overloads
+TEST_F(CompactGraphTest, BracedGraphListsAreUnambiguous) {
+    Graph other = graph;
+    MCISAlgorithm mcis_algorithm;
+    auto result = mcis_algorithm.run({&graph, &other}, AlgorithmType::KPT);
+    ASSERT_TRUE(result.has_value());
+    for (auto* g : *result) {
+        delete g;
+    }
+
+    auto results = mcis_algorithm.run_many({&graph, &other},
+                                           {AlgorithmType::KPT});
+    ASSERT_TRUE(results.has_value());
+    for (auto& per_algorithm : *results) {
+        for (auto* g : per_algorithm) {
+            delete g;
+        }
+    }
+}
+
+// Test 9: Binary files round-trip IDs, tags, weights and both CSR directions
+TEST_F(CompactGraphTest, BinaryFileRoundTrip) {
+    const std::string path = ::testing::TempDir() + "compact_round_trip.bin";
+    ASSERT_EQ(graph.save_binary(path), std::nullopt);
+    auto loaded = CompactGraph::load_binary(path);
+    ASSERT_TRUE(loaded.has_value());
+    CompactGraph compact = graph.freeze();
+    EXPECT_EQ(loaded->get_num_nodes(), compact.get_num_nodes());
+    EXPECT_EQ(loaded->get_num_edges(), compact.get_num_edges());
+    EXPECT_EQ(loaded->weighted(), compact.weighted());
+    EXPECT_EQ(loaded->get_tag_table(), compact.get_tag_table());
+    for (CompactGraph::VertexId v = 0; v < compact.get_num_nodes(); ++v) {
+        EXPECT_EQ(loaded->get_id(v), compact.get_id(v));
+        EXPECT_EQ(loaded->get_tag_id(v), compact.get_tag_id(v));
+        auto in = loaded->in_neighbors(v);
+        auto expected_in = compact.in_neighbors(v);
+        EXPECT_TRUE(std::equal(in.begin(), in.end(), expected_in.begin(),
+                               expected_in.end()));
+    }
+    EXPECT_TRUE(loaded->thaw() == graph);
+
+    // Generated graphs with lazily produced IDs and an empty graph too
+    auto fft = CompactGraph::create_fft_graph_from_dimensions(64);
+    ASSERT_TRUE(fft.has_value());
+    ASSERT_EQ(fft->save_binary(path), std::nullopt);
+    auto loaded_fft = CompactGraph::load_binary(path);
+    ASSERT_TRUE(loaded_fft.has_value());
+    EXPECT_EQ(loaded_fft->get_index("s3_17"), fft->get_index("s3_17"));
+    EXPECT_TRUE(loaded_fft->thaw() == fft->thaw());
+
+    ASSERT_EQ(CompactGraph().save_binary(path), std::nullopt);
+    auto loaded_empty = CompactGraph::load_binary(path);
+    ASSERT_TRUE(loaded_empty.has_value());
+    EXPECT_EQ(loaded_empty->get_num_nodes(), 0u);
+    std::remove(path.c_str());
+}
+
+// Test 10: Damaged, foreign and missing files are rejected
+TEST_F(CompactGraphTest, BinaryFileErrors) {
+    const std::string path = ::testing::TempDir() + "compact_damaged.bin";
+    ASSERT_EQ(graph.save_binary(path), std::nullopt);
+    {
+        std::fstream file(path, std::ios::in | std::ios::out
+                                    | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('#');
+    }
+    auto damaged = CompactGraph::load_binary(path);
+    ASSERT_FALSE(damaged.has_value());
+    EXPECT_EQ(damaged.error(), mcis::GraphError::CHECKSUM_MISMATCH);
+    EXPECT_TRUE(CompactGraph::load_binary(path, false).has_value());
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << std::string(100, 'x');
+    }
+    auto foreign = CompactGraph::load_binary(path);
+    ASSERT_FALSE(foreign.has_value());
+    EXPECT_EQ(foreign.error(), mcis::GraphError::INVALID_FILE_FORMAT);
+    std::remove(path.c_str());
+
+    auto missing = CompactGraph::load_binary(path);
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), mcis::GraphError::FILE_IO_ERROR);
+}
+
+// Test 11: Corrupted indices are rejected even without the checksum
+TEST_F(CompactGraphTest, BinaryFileCorruptIndices) {
+    const std::string path = ::testing::TempDir() + "compact_corrupt.bin";
+    ASSERT_EQ(graph.freeze().get_tag_table().size(), 3u);
+    // The 64-byte header is followed by 8-byte aligned sections; with 4
+    // nodes, 4 edges and 3 tags they start at these offsets
+    constexpr std::streamoff STRING_BYTES = 32;
+    constexpr std::streamoff OUT_OFFSETS = 64;
+    constexpr std::streamoff OUT_TARGETS = 88;
+    constexpr std::streamoff IN_SOURCES = 144;
+    constexpr std::streamoff NODE_TAGS = 176;
+    constexpr std::streamoff STRING_ENDS = 192;
+    auto load_patched = [&](std::streamoff at, auto value) {
+        EXPECT_EQ(graph.save_binary(path), std::nullopt);
+        {
+            std::fstream file(path, std::ios::in | std::ios::out
+                                        | std::ios::binary);
+            file.seekp(at);
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        return CompactGraph::load_binary(path, false);
+    };
+
+    // The offsets are right, so the unpatched file loads
+    ASSERT_TRUE(load_patched(OUT_OFFSETS, uint32_t{0}).has_value());
+    for (const auto& corrupted : {
+             load_patched(OUT_OFFSETS + 4, uint32_t{4}),  // decreasing
+             load_patched(OUT_TARGETS, uint32_t{99}),     // vertex >= n
+             load_patched(IN_SOURCES, uint32_t{4}),       // vertex >= n
+             load_patched(NODE_TAGS, uint32_t{3}),        // tag >= num_tags
+             load_patched(STRING_ENDS + 8, uint64_t{0}),  // end < begin
+             load_patched(STRING_BYTES, uint64_t{1} << 62)}) {
+        ASSERT_FALSE(corrupted.has_value());
+        EXPECT_EQ(corrupted.error(), mcis::GraphError::INVALID_FILE_FORMAT);
+    }
+    std::remove(path.c_str());
+}
+
+// Test 12: Structural hashes ignore numbering and, optionally, node IDs
+TEST_F(CompactGraphTest, StructuralHash) {
+    // Same graph with its nodes renamed so they freeze in another order
+    Graph renamed;
+    for (const auto& [id, tag] : {std::pair{"w", "+"}, {"x", "*"}, {"y", "+"},
+                                  {"z", ""}}) {
+        renamed.add_node(id);
+        if (*tag != '\0') {
+            renamed.set_node_tag(id, tag);
+        }
+    }
+    renamed.add_edge("y", "x", 2);
+    renamed.add_edge("y", "w", 0);
+    renamed.add_edge("x", "w", 5);
+    renamed.add_edge("w", "z", 0);
+
+    EXPECT_EQ(graph.structural_hash(), graph.freeze().structural_hash());
+    EXPECT_NE(graph.structural_hash(), renamed.structural_hash());
+    EXPECT_EQ(graph.structural_hash(false), renamed.structural_hash(false));
+
+    Graph copy = graph;
+    copy.set_node_tag("D", "*");
+    EXPECT_NE(copy.structural_hash(false), graph.structural_hash(false));
+    copy = graph;
+    copy.add_edge("D", "A", 0);
+    EXPECT_NE(copy.structural_hash(false), graph.structural_hash(false));
+    EXPECT_NE(copy.structural_hash(), graph.structural_hash());
+}
@@ -0,0 +1,174 @@
+/**
+ * @file dense_product_graph_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/dense_product_graph.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+
+class DenseProductGraphTest : public ::testing::Test {
+ protected:
+    static constexpr size_t BUDGET = size_t{1} << 30;
+
+    static bool bit(const DenseProductGraph& product, size_t p, size_t q) {
+        return (product.row(p)[q / 64] >> (q % 64)) & 1;
+    }
+
+    static CompactGraph random_graph(int n, double p, std::mt19937& rng,
+                                     const std::string& prefix) {
+        Graph g;
+        for (int i = 0; i < n; ++i) {
+            g.add_node(prefix + std::to_string(i));
+        }
+        std::bernoulli_distribution coin(p);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i != j && coin(rng)) {
+                    g.add_edge(prefix + std::to_string(i),
+                               prefix + std::to_string(j), 0);
+                }
+            }
+        }
+        return g.freeze();
+    }
+
+    static DenseProductGraph full_product(
+        const std::vector<const CompactGraph*>& graphs,
+        DenseProductGraph::Rule rule, int num_threads) {
+        auto all = DenseProductGraph::build(graphs, CandidateFilterOptions{},
+                                            BUDGET, nullptr);
+        EXPECT_TRUE(all.has_value());
+        return DenseProductGraph::build(graphs, all->tuples, rule,
+                                        num_threads);
+    }
+
+    // Adjacency straight from the definition of each rule
+    static bool expected_adjacent(const DenseProductGraph& product,
+                                  const std::vector<const CompactGraph*>& gs,
+                                  size_t p, size_t q,
+                                  DenseProductGraph::Rule rule) {
+        int first = -1;
+        for (size_t i = 0; i < gs.size(); ++i) {
+            const auto u = product.component(p, i);
+            const auto v = product.component(q, i);
+            if (rule == DenseProductGraph::Rule::MODULAR && u == v) {
+                return false;
+            }
+            int rel = (gs[i]->has_edge(u, v) ? 1 : 0)
+                      | (gs[i]->has_edge(v, u) ? 2 : 0);
+            if (rule == DenseProductGraph::Rule::UNDIRECTED) {
+                rel = rel != 0;
+            }
+            if (first < 0) {
+                first = rel;
+            } else if (rel != first) {
+                return false;
+            }
+        }
+        return p != q;
+    }
+};
+
+// Test 1: The modular product is symmetric and matches its definition
+TEST_F(DenseProductGraphTest, ModularMatchesDefinition) {
+    std::mt19937 rng(5);
+    CompactGraph g1 = random_graph(9, 0.3, rng, "u");
+    CompactGraph g2 = random_graph(11, 0.3, rng, "v");
+    std::vector<const CompactGraph*> graphs = {&g1, &g2};
+    DenseProductGraph product
+        = full_product(graphs, DenseProductGraph::Rule::MODULAR, 0);
+    ASSERT_EQ(product.num_vertices, 99u);
+    for (size_t p = 0; p < product.num_vertices; ++p) {
+        for (size_t q = 0; q < product.num_vertices; ++q) {
+            ASSERT_EQ(bit(product, p, q),
+                      expected_adjacent(product, graphs, p, q,
+                                        DenseProductGraph::Rule::MODULAR))
+                << p << ", " << q;
+        }
+    }
+}
+
+// Test 2: The undirected rule allows repeated components
+TEST_F(DenseProductGraphTest, UndirectedMatchesDefinition) {
+    std::mt19937 rng(8);
+    CompactGraph g1 = random_graph(7, 0.3, rng, "u");
+    CompactGraph g2 = random_graph(6, 0.4, rng, "v");
+    CompactGraph g3 = random_graph(3, 0.5, rng, "w");
+    std::vector<const CompactGraph*> graphs = {&g1, &g2, &g3};
+    DenseProductGraph product
+        = full_product(graphs, DenseProductGraph::Rule::UNDIRECTED, 0);
+    ASSERT_EQ(product.num_vertices, 126u);
+    for (size_t p = 0; p < product.num_vertices; ++p) {
+        for (size_t q = 0; q < product.num_vertices; ++q) {
+            ASSERT_EQ(bit(product, p, q),
+                      expected_adjacent(product, graphs, p, q,
+                                        DenseProductGraph::Rule::UNDIRECTED))
+                << p << ", " << q;
+        }
+    }
+}
+
+// Test 3: The thread count does not change the adjacency
+TEST_F(DenseProductGraphTest, ThreadCountsAgree) {
+    std::mt19937 rng(13);
+    CompactGraph g1 = random_graph(23, 0.2, rng, "u");
+    CompactGraph g2 = random_graph(17, 0.25, rng, "v");
+    std::vector<const CompactGraph*> graphs = {&g1, &g2};
+    DenseProductGraph serial
+        = full_product(graphs, DenseProductGraph::Rule::MODULAR, 1);
+    for (int threads : {2, 3, 8}) {
+        DenseProductGraph parallel
+            = full_product(graphs, DenseProductGraph::Rule::MODULAR, threads);
+        EXPECT_EQ(parallel.adjacency, serial.adjacency) << threads;
+        EXPECT_EQ(parallel.tuples, serial.tuples) << threads;
+    }
+}
+
+// Test 4: Products past the byte budget are refused
+TEST_F(DenseProductGraphTest, BudgetIsEnforced) {
+    std::mt19937 rng(2);
+    CompactGraph g1 = random_graph(30, 0.1, rng, "u");
+    CompactGraph g2 = random_graph(30, 0.1, rng, "v");
+    std::vector<const CompactGraph*> graphs = {&g1, &g2};
+    const size_t fits = DenseProductGraph::adjacency_bytes(900);
+    EXPECT_EQ(DenseProductGraph::max_vertices(fits), 900u);
+    EXPECT_TRUE(DenseProductGraph::build(graphs, CandidateFilterOptions{},
+                                         fits, nullptr)
+                    .has_value());
+    auto refused = DenseProductGraph::build(graphs, CandidateFilterOptions{},
+                                            fits / 2, nullptr);
+    ASSERT_FALSE(refused.has_value());
+    EXPECT_EQ(refused.error(), mcis::AlgorithmError::PRODUCT_GRAPH_TOO_LARGE);
+}
+
+// Test 5: A built product can be handed to a clique routine directly
+TEST_F(DenseProductGraphTest, GreedyCliqueOnBuiltProduct) {
+    auto fft1 = Graph::create_fft_graph_from_dimensions(4);
+    auto fft2 = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(fft1.has_value() && fft2.has_value());
+    CompactGraph c1 = fft1->freeze();
+    CompactGraph c2 = fft2->freeze();
+    std::vector<const CompactGraph*> graphs = {&c1, &c2};
+    DenseProductGraph product
+        = full_product(graphs, DenseProductGraph::Rule::MODULAR, 0);
+    std::vector<uint32_t> clique = product.greedy_clique();
+    ASSERT_FALSE(clique.empty());
+    for (const auto p : clique) {
+        for (const auto q : clique) {
+            EXPECT_EQ(bit(product, p, q), p != q);
+        }
+    }
+}
@@ -8,8 +8,10 @@
  *
  * This software is licensed under the MIT License.
  */
+#include <cmath>
 #include <cstdlib>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -170,3 +172,100 @@ TEST_F(DWTTest, DWTGraphStructureCorrectness) {
     EXPECT_TRUE(s0_parent_found) << "s_0 parent not found for d^0_0";
     EXPECT_TRUE(s1_parent_found) << "s_1 parent not found for d^0_0";
 }
+
+// Test 8: The direct compact generator matches the Graph generator
+TEST_F(DWTTest, CompactGeneratorMatchesGraph) {
+    for (const auto& [d, k] :
+         std::vector<std::pair<int, int>>{{1, 1}, {2, 1}, {4, 1}, {3, 3}}) {
+        const int n = k << d;
+        auto graphs
+            = Graph::create_haar_wavelet_transform_graph_from_dimensions(n, d,
+                                                                         k);
+        auto compact
+            = CompactGraph::create_haar_wavelet_transform_graph_from_dimensions(
+                n, d, k);
+        ASSERT_TRUE(graphs.has_value() && compact.has_value());
+        ASSERT_EQ(compact->size(), 2u);
+        EXPECT_TRUE((*compact)[0].thaw() == (*graphs)[0]) << d << ", " << k;
+        EXPECT_TRUE((*compact)[1].thaw() == (*graphs)[1]) << d << ", " << k;
+    }
+    auto coeff
+        = CompactGraph::create_haar_wavelet_transform_graph_from_dimensions(
+            8, 3, 1, HaarWaveletGraph::PRUNED_COEFFICIENT);
+    ASSERT_TRUE(coeff.has_value());
+    ASSERT_EQ(coeff->size(), 1u);
+    EXPECT_TRUE(coeff->front().get_index("d^2_0").has_value());
+    EXPECT_FALSE(
+        CompactGraph::create_haar_wavelet_transform_graph_from_dimensions(6, 2)
+            .has_value());
+}
+
+// Test 9: Signal graphs keep operation labels apart from the signal values
+TEST_F(DWTTest, SignalValuesAreTagPayloads) {
+    auto dwt_graphs = Graph::create_haar_wavelet_transform_graph_from_signal(
+        {9.0, 7.0, 5.0, 3.0});
+    ASSERT_TRUE(dwt_graphs.has_value());
+    Graph& avg_graph = (*dwt_graphs)[0];
+    EXPECT_EQ(avg_graph.get_node("s_0")->get_tag_value(), 9.0);
+    EXPECT_EQ(avg_graph.get_node("s_0")->get_tag_view(), "");
+    EXPECT_EQ(avg_graph.get_node("s_0")->get_tag(), "9.000000");
+    Node* final_avg_node = avg_graph.get_node("a^1_0");
+    EXPECT_EQ(final_avg_node->get_tag_view(), "+/sqrt(2)");
+    EXPECT_NEAR(*final_avg_node->get_tag_value(), 12.0, 1e-9);
+
+    // All averaging nodes share one label despite their different values
+    EXPECT_EQ(avg_graph.get_subgraph_with_tag("+/sqrt(2)").get_num_nodes(), 3);
+    EXPECT_EQ(avg_graph.freeze().get_tag_table().size(), 2u);
+}
+
+// Test 10: Channels transformed together match one-at-a-time transforms
+TEST_F(DWTTest, MultiChannelSignalsMatchSingleSignals) {
+    // Seven channels exercise both the vector lanes and the scalar tail
+    std::vector<std::vector<double>> signals(7, std::vector<double>(16));
+    for (size_t c = 0; c < signals.size(); ++c) {
+        for (size_t i = 0; i < 16; ++i) {
+            signals[c][i] = std::sin(0.3 * static_cast<double>(i * (c + 1)))
+                            + static_cast<double>(c);
+        }
+    }
+    auto batched
+        = Graph::create_haar_wavelet_transform_graphs_from_signals(signals);
+    ASSERT_TRUE(batched.has_value());
+    ASSERT_EQ(batched->size(), signals.size());
+    for (size_t c = 0; c < signals.size(); ++c) {
+        auto single
+            = Graph::create_haar_wavelet_transform_graph_from_signal(signals[c]);
+        ASSERT_TRUE(single.has_value());
+        ASSERT_EQ((*batched)[c].size(), 2u);
+        for (size_t g = 0; g < 2; ++g) {
+            EXPECT_TRUE((*batched)[c][g] == (*single)[g]) << c << " " << g;
+            for (const auto& [id, node] : (*single)[g].get_nodes()) {
+                EXPECT_EQ((*batched)[c][g].get_node(id)->get_tag_value(),
+                          node->get_tag_value())
+                    << id;
+            }
+        }
+    }
+
+    // Averages and coefficients keep the signal's energy
+    const Graph& coeff_graph = (*batched)[3][1];
+    double energy = 0.0;
+    for (const double x : signals[3]) {
+        energy += x * x;
+    }
+    double transformed = std::pow(*coeff_graph.get_node("a^3_0")
+                                       ->get_tag_value(),
+                                  2);
+    for (const auto& [id, node] : coeff_graph.get_nodes()) {
+        if (id.starts_with("d^")) {
+            transformed += std::pow(*node->get_tag_value(), 2);
+        }
+    }
+    EXPECT_NEAR(transformed, energy, 1e-9);
+
+    EXPECT_FALSE(Graph::create_haar_wavelet_transform_graphs_from_signals({})
+                     .has_value());
+    EXPECT_FALSE(Graph::create_haar_wavelet_transform_graphs_from_signals(
+                     {{1.0, 2.0}, {1.0, 2.0, 3.0, 4.0}})
+                     .has_value());
+}
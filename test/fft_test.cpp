@@ -12,8 +12,11 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <complex>
 #include <cstdlib>
+#include <numbers>
 #include <string>
+#include <vector>
 
 #include "mcis/graph.h"
 
@@ -147,3 +150,64 @@ TEST_F(FFTGraphTest, N8_GraphStructure) {
         graph.generate_diagram_file("fft_n8");
     }
 }
+
+TEST_F(FFTGraphTest, CompactGeneratorMatchesGraph) {
+    for (int n : {1, 2, 8, 32}) {
+        auto graph = Graph::create_fft_graph_from_dimensions(n);
+        auto compact = CompactGraph::create_fft_graph_from_dimensions(n, 2);
+        ASSERT_TRUE(graph.has_value() && compact.has_value());
+        EXPECT_TRUE(compact->thaw() == *graph) << n;
+    }
+    auto compact = CompactGraph::create_fft_graph_from_dimensions(1 << 12);
+    ASSERT_TRUE(compact.has_value());
+    EXPECT_EQ(compact->get_num_nodes(), (1u << 12) * 14);
+    const auto v = compact->get_index("s3_17");
+    ASSERT_TRUE(v.has_value());
+    EXPECT_EQ(compact->get_id(*v), "s3_17");
+    EXPECT_EQ(compact->get_tag(*v), "+/-*");
+    EXPECT_FALSE(CompactGraph::create_fft_graph_from_dimensions(12));
+}
+
+TEST_F(FFTGraphTest, SignalGraphCarriesTheSpectrum) {
+    const int n = 16;
+    std::vector<std::complex<double>> signal(n);
+    for (int i = 0; i < n; ++i) {
+        signal[i] = {std::cos(0.7 * i) + 0.25 * i, std::sin(1.3 * i)};
+    }
+
+    auto topology = Graph::create_fft_graph_from_dimensions(n);
+    auto real = Graph::create_fft_graph_from_signal(signal);
+    auto imag
+        = Graph::create_fft_graph_from_signal(signal, FftComponent::IMAGINARY);
+    auto magnitude
+        = Graph::create_fft_graph_from_signal(signal, FftComponent::MAGNITUDE);
+    ASSERT_TRUE(topology && real && imag && magnitude);
+    EXPECT_TRUE(*real == *topology);
+    EXPECT_EQ(real->get_node("s2_5")->get_tag_view(), "+/-*");
+    EXPECT_EQ(real->get_node("x_3")->get_tag_value(), signal[3].real());
+    EXPECT_EQ(imag->get_node("x_3")->get_tag_value(), signal[3].imag());
+
+    // X_k must hold the direct DFT of the signal
+    for (int k = 0; k < n; ++k) {
+        std::complex<double> expected = 0;
+        for (int t = 0; t < n; ++t) {
+            expected += signal[t]
+                        * std::polar(1.0, -2.0 * std::numbers::pi * k * t / n);
+        }
+        const std::string id = "X_" + std::to_string(k);
+        EXPECT_NEAR(*real->get_node(id)->get_tag_value(), expected.real(),
+                    1e-9)
+            << id;
+        EXPECT_NEAR(*imag->get_node(id)->get_tag_value(), expected.imag(),
+                    1e-9)
+            << id;
+        EXPECT_NEAR(*magnitude->get_node(id)->get_tag_value(),
+                    std::abs(expected), 1e-9)
+            << id;
+    }
+
+    EXPECT_FALSE(Graph::create_fft_graph_from_signal(
+                     std::vector<std::complex<double>>(12))
+                     .has_value());
+    EXPECT_FALSE(Graph::create_fft_graph_from_signal({}).has_value());
+}
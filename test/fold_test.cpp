@@ -0,0 +1,164 @@
+/**
+ * @file fold_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <algorithm>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class FoldTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+
+    // prefix0 -> prefix1 -> ... with every node tagged "+"
+    static Graph chain(int n, const std::string& prefix) {
+        Graph g;
+        for (int i = 0; i < n; ++i) {
+            g.add_node(prefix + std::to_string(i));
+            g.set_node_tag(prefix + std::to_string(i), "+");
+        }
+        for (int i = 0; i + 1 < n; ++i) {
+            g.add_edge(prefix + std::to_string(i),
+                       prefix + std::to_string(i + 1), 0);
+        }
+        return g;
+    }
+
+    // Takes ownership of the results and returns the first one by value
+    static Graph take_first(
+        std::expected<std::vector<Graph*>, mcis::AlgorithmError>& result) {
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return Graph();
+        }
+        Graph first = *(*result)[0];
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return first;
+    }
+};
+
+// Test 1: Folding chains leaves the shortest chain, with one ID per input
+TEST_F(FoldTest, FoldsChainsToTheShortest) {
+    Graph a = chain(5, "a");
+    Graph b = chain(3, "b");
+    Graph c = chain(6, "c");
+    Graph d = chain(4, "d");
+    auto result = mcis_algorithm->run_folded({&a, &b, &c, &d},
+                                             AlgorithmType::MAX_CLIQUE);
+    Graph folded = take_first(result);
+    EXPECT_EQ(folded.get_num_nodes(), 3);
+    EXPECT_EQ(folded.freeze().get_num_edges(), 2u);
+    for (const auto& [id, node] : folded.get_nodes()) {
+        // Smallest graph first: b, d, a, c
+        EXPECT_EQ(id[0], 'b');
+        EXPECT_EQ(std::count(id.begin(), id.end(), '_'), 3) << id;
+    }
+}
+
+// Test 2: Two graphs fold exactly like a plain run
+TEST_F(FoldTest, TwoGraphsMatchRun) {
+    Graph a = chain(4, "a");
+    Graph b = chain(3, "b");
+    auto folded = mcis_algorithm->run_folded({&a, &b},
+                                             AlgorithmType::MAX_CLIQUE);
+    auto plain = mcis_algorithm->run({&a, &b}, AlgorithmType::MAX_CLIQUE);
+    EXPECT_TRUE(take_first(folded) == take_first(plain));
+    EXPECT_EQ(mcis_algorithm->fold_cache_size(), 0u);
+}
+
+// Test 3: Adding a graph reuses the cached folds of the others
+TEST_F(FoldTest, CachedFoldsAreReused) {
+    Graph a = chain(3, "a");
+    Graph b = chain(4, "b");
+    Graph c = chain(5, "c");
+    Graph d = chain(6, "d");
+    RunOptions options;
+    CandidateFilterStats stats;
+    options.candidate_stats = &stats;
+
+    // (a, b) then ((a, b), c)
+    auto three = mcis_algorithm->run_folded(
+        {&a, &b, &c}, AlgorithmType::BRON_KERBOSCH_BITSET, std::nullopt,
+        options);
+    EXPECT_EQ(take_first(three).get_num_nodes(), 3);
+    EXPECT_EQ(mcis_algorithm->fold_cache_size(), 2u);
+
+    // (a, b) is cached; (c, d) and ((a, b), (c, d)) are new
+    auto four = mcis_algorithm->run_folded(
+        {&d, &c, &b, &a}, AlgorithmType::BRON_KERBOSCH_BITSET, std::nullopt,
+        options);
+    EXPECT_EQ(take_first(four).get_num_nodes(), 3);
+    EXPECT_EQ(mcis_algorithm->fold_cache_size(), 4u);
+    EXPECT_EQ(stats.total, 5u * 6u + 3u * 5u);
+
+    // Everything is cached now
+    auto again = mcis_algorithm->run_folded(
+        {&a, &b, &c, &d}, AlgorithmType::BRON_KERBOSCH_BITSET, std::nullopt,
+        options);
+    EXPECT_EQ(take_first(again).get_num_nodes(), 3);
+    EXPECT_EQ(stats.total, 0u);
+
+    // A different algorithm or filter does not share entries
+    auto other = mcis_algorithm->run_folded({&a, &b, &c},
+                                            AlgorithmType::MAX_CLIQUE);
+    EXPECT_EQ(take_first(other).get_num_nodes(), 3);
+    EXPECT_EQ(mcis_algorithm->fold_cache_size(), 6u);
+
+    mcis_algorithm->clear_fold_cache();
+    EXPECT_EQ(mcis_algorithm->fold_cache_size(), 0u);
+}
+
+// Test 4: Folded nodes keep their tags, so tag matching holds across folds
+TEST_F(FoldTest, TaggedFolds) {
+    Graph a = chain(4, "a");
+    Graph b = chain(5, "b");
+    Graph c = chain(6, "c");
+    a.add_node("x");
+    a.set_node_tag("x", "*");
+    a.add_edge("a3", "x", 0);
+    RunOptions options;
+    options.candidate_filter.match_tags = true;
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+        auto result
+            = mcis_algorithm->run_folded({&a, &b, &c}, type, "+", options);
+        Graph folded = take_first(result);
+        EXPECT_EQ(folded.get_num_nodes(), 4) << static_cast<int>(type);
+        for (const auto& [id, node] : folded.get_nodes()) {
+            EXPECT_EQ(node->get_tag(), "+");
+        }
+    }
+}
+
+// Test 5: Empty inputs are reported like a plain run
+TEST_F(FoldTest, EmptyInput) {
+    Graph a = chain(3, "a");
+    Graph b = chain(3, "b");
+    Graph empty;
+    auto result = mcis_algorithm->run_folded({&a, &b, &empty},
+                                             AlgorithmType::MAX_CLIQUE);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file graph_batch_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/graph_batch.h"
+#include "mcis/reachability_index.h"
+
+class GraphBatchTest : public ::testing::Test {
+ protected:
+    // Five channels of 16 samples each
+    static std::vector<std::vector<double>> recording() {
+        std::vector<std::vector<double>> signals(5, std::vector<double>(16));
+        for (size_t c = 0; c < signals.size(); ++c) {
+            for (size_t i = 0; i < 16; ++i) {
+                signals[c][i] = std::cos(0.2 * static_cast<double>(i * c))
+                                + 0.5 * static_cast<double>(i);
+            }
+        }
+        return signals;
+    }
+};
+
+// Test 1: Every channel shares one topology and adds one value column
+TEST_F(GraphBatchTest, HaarBatchSharesTopology) {
+    const auto signals = recording();
+    auto batches
+        = GraphBatch::create_haar_wavelet_transform_batch_from_signals(signals);
+    ASSERT_TRUE(batches.has_value());
+    ASSERT_EQ(batches->size(), 2u);
+
+    const GraphBatch& averages = (*batches)[0];
+    const GraphBatch& coefficients = (*batches)[1];
+    EXPECT_EQ(averages.size(), signals.size());
+    EXPECT_EQ(averages.topology().get_num_nodes(), 31u);
+    EXPECT_EQ(coefficients.topology().get_num_nodes(), 46u);
+    EXPECT_EQ(coefficients.values(4).size(), 46u);
+
+    // The average graph's topology is the dimension-based one
+    auto dimensions = Graph::create_haar_wavelet_transform_graph_from_dimensions(
+        16, 4, 1, HaarWaveletGraph::PRUNED_AVERAGE);
+    ASSERT_TRUE(dimensions.has_value());
+    EXPECT_TRUE(averages.topology().thaw() == dimensions->front());
+
+    // Copies and instances reference the topology instead of copying it,
+    // so its analyses are built once
+    const GraphBatch copy = coefficients;
+    EXPECT_EQ(&copy.topology(), &coefficients.topology());
+    EXPECT_EQ(coefficients.instance(0).topology,
+              coefficients.instance(3).topology);
+    EXPECT_EQ(&copy.topology().reachability(),
+              &coefficients.topology().reachability());
+}
+
+// Test 2: Instances hold the values the per-channel graphs carry
+TEST_F(GraphBatchTest, HaarInstancesMatchSingleSignalGraphs) {
+    const auto signals = recording();
+    auto batches
+        = GraphBatch::create_haar_wavelet_transform_batch_from_signals(
+            signals, HaarWaveletGraph::PRUNED_COEFFICIENT, 2);
+    ASSERT_TRUE(batches.has_value());
+    ASSERT_EQ(batches->size(), 1u);
+    const GraphBatch& batch = batches->front();
+    const CompactGraph& topology = batch.topology();
+
+    for (size_t c = 0; c < signals.size(); ++c) {
+        const Graph materialized = batch.materialize(c);
+        for (CompactGraph::VertexId v = 0; v < topology.get_num_nodes(); ++v) {
+            EXPECT_EQ(materialized.get_node(topology.get_id(v))
+                          ->get_tag_value(),
+                      batch.value(c, v));
+        }
+
+        // Haar is orthonormal: the final average and the coefficients keep
+        // the signal's energy
+        double energy = 0.0;
+        for (const double x : signals[c]) {
+            energy += x * x;
+        }
+        double transformed
+            = std::pow(batch.value(c, *topology.get_index("a^3_0")), 2);
+        for (CompactGraph::VertexId v = 0; v < topology.get_num_nodes(); ++v) {
+            if (topology.get_tag(v) == "-/sqrt(2)") {
+                transformed += std::pow(batch.value(c, v), 2);
+            }
+        }
+        EXPECT_NEAR(transformed, energy, 1e-9) << c;
+    }
+
+    auto known = GraphBatch::create_haar_wavelet_transform_batch_from_signals(
+        {{9.0, 7.0, 5.0, 3.0}});
+    ASSERT_TRUE(known.has_value());
+    const GraphBatch& coeff = (*known)[1];
+    EXPECT_NEAR(coeff.value(0, *coeff.topology().get_index("a^1_0")), 12.0,
+                1e-9);
+    EXPECT_NEAR(coeff.value(0, *coeff.topology().get_index("d^1_0")), 4.0,
+                1e-9);
+    EXPECT_EQ(coeff.value(0, *coeff.topology().get_index("s_2")), 5.0);
+
+    EXPECT_FALSE(
+        GraphBatch::create_haar_wavelet_transform_batch_from_signals({{1, 2, 3}})
+            .has_value());
+}
+
+// Test 3: FFT instances hold each channel's spectrum
+TEST_F(GraphBatchTest, FFTBatchMatchesSingleSignalGraphs) {
+    std::vector<std::vector<std::complex<double>>> signals;
+    for (const auto& channel : recording()) {
+        signals.emplace_back(channel.begin(), channel.end());
+    }
+    auto batch = GraphBatch::create_fft_batch_from_signals(
+        signals, FftComponent::MAGNITUDE);
+    ASSERT_TRUE(batch.has_value());
+    EXPECT_EQ(batch->size(), signals.size());
+    EXPECT_EQ(batch->topology().get_num_nodes(), 16u * 6);
+
+    for (size_t c = 0; c < signals.size(); ++c) {
+        auto single = Graph::create_fft_graph_from_signal(
+            signals[c], FftComponent::MAGNITUDE);
+        ASSERT_TRUE(single.has_value());
+        EXPECT_TRUE(batch->materialize(c) == *single);
+        for (int k = 0; k < 16; ++k) {
+            const std::string id = "X_" + std::to_string(k);
+            EXPECT_EQ(batch->value(c, *batch->topology().get_index(id)),
+                      single->get_node(id)->get_tag_value());
+        }
+    }
+
+    EXPECT_FALSE(GraphBatch::create_fft_batch_from_signals({}).has_value());
+    EXPECT_FALSE(
+        GraphBatch::create_fft_batch_from_signals({{1.0, 2.0}, {1.0}})
+            .has_value());
+}
@@ -12,6 +12,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +34,28 @@ class GraphTest : public ::testing::Test {
 
     std::unique_ptr<Graph> graph;
     bool generate_diagrams = false;
+
+    // Upstream resource that tracks how many bytes are outstanding
+    class CountingResource : public std::pmr::memory_resource {
+     public:
+        size_t outstanding = 0;
+        size_t allocations = 0;
+
+     private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            outstanding += bytes;
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            outstanding -= bytes;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
 };
 
 // Test 1: Verifies default constructor creates empty graph with DAG property
@@ -494,3 +518,352 @@ TEST_F(GraphTest, GetSubgraphWithTag) {
     EXPECT_EQ(subgraph.get_node("C"), nullptr);
     EXPECT_TRUE(subgraph.get_node("A")->contains_edge(subgraph.get_node("B")));
 }
+
+// Test 23: Nodes come from the upstream resource and are released in bulk
+TEST_F(GraphTest, ArenaUsesUpstreamResource) {
+    CountingResource resource;
+    {
+        Graph g(&resource);
+        for (int i = 0; i < 1000; ++i) {
+            g.add_node("node_with_a_long_identifier_" + std::to_string(i));
+        }
+        for (int i = 1; i < 1000; ++i) {
+            g.add_edge("node_with_a_long_identifier_" + std::to_string(i - 1),
+                       "node_with_a_long_identifier_" + std::to_string(i), 1);
+        }
+        EXPECT_GT(resource.outstanding, 1000 * sizeof(Node));
+        // The arena asks for large blocks, not one allocation per node
+        EXPECT_LT(resource.allocations, 100u);
+
+        Graph copy(g);
+        EXPECT_TRUE(copy == g);
+        g.remove_node("node_with_a_long_identifier_0");
+        EXPECT_EQ(copy.get_num_nodes(), 1000);
+        EXPECT_EQ(g.get_num_nodes(), 999);
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
+// Test 24: Copies, assignments and moves keep tags, weights and structure
+TEST_F(GraphTest, CopyAndMoveKeepStructure) {
+    graph->add_node("A");
+    graph->add_node("B");
+    graph->add_node("C");
+    graph->set_node_tag("A", "+");
+    graph->add_edge("A", "B", 3);
+    graph->add_edge("B", "C", 0);
+
+    Graph copy(*graph);
+    EXPECT_EQ(copy.get_node("A")->get_tag(), "+");
+    EXPECT_EQ(copy.get_node("A")->get_children().at(copy.get_node("B")), 3);
+    EXPECT_EQ(copy.get_node("C")->get_num_parents(), 1);
+    EXPECT_TRUE(copy.get_node("B")->check_parent("A"));
+
+    Graph assigned;
+    assigned.add_node("stale");
+    assigned = copy;
+    EXPECT_EQ(assigned.get_node("stale"), nullptr);
+    EXPECT_TRUE(assigned == *graph);
+
+    Graph moved(std::move(copy));
+    EXPECT_TRUE(moved == *graph);
+    EXPECT_EQ(copy.get_num_nodes(), 0);
+    EXPECT_FALSE(copy.add_node("fresh").has_value());
+    EXPECT_EQ(copy.get_num_nodes(), 1);
+}
+
+// Test 25: Tagged subgraphs keep their tags and edge weights
+TEST_F(GraphTest, SubgraphKeepsTags) {
+    graph->add_node("A");
+    graph->add_node("B");
+    graph->set_node_tag("A", "*");
+    graph->set_node_tag("B", "*");
+    graph->add_edge("A", "B", 7);
+
+    Graph subgraph = graph->get_subgraph_with_tag("*");
+    ASSERT_EQ(subgraph.get_num_nodes(), 2);
+    EXPECT_EQ(subgraph.get_node("B")->get_tag(), "*");
+    EXPECT_EQ(
+        subgraph.get_node("A")->get_children().at(subgraph.get_node("B")), 7);
+    EXPECT_EQ(subgraph.get_subgraph_with_tag("*").get_num_nodes(), 2);
+}
+
+// Test 26: DOT export and import round trip tags, weights and quoting
+TEST_F(GraphTest, DotRoundTrip) {
+    graph->add_node_set({"a", "b\"q", "c d", "lone"});
+    graph->set_node_tag("a", "+");
+    graph->set_node_tag("c d", "*");
+    graph->set_node_tag("lone", "x", 0.1);
+    graph->add_edge("a", "b\"q", 3);
+    graph->add_edge("b\"q", "c d", -2);
+    graph->add_edge("a", "c d", 0);
+
+    std::stringstream dot;
+    ASSERT_FALSE(graph->write_dot(dot).has_value());
+    auto parsed = Graph::read_dot(dot);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_TRUE(*parsed == *graph);
+    EXPECT_EQ(parsed->get_node("c d")->get_tag(), "*");
+    EXPECT_EQ(parsed->get_node("lone")->get_tag_view(), "x");
+    EXPECT_EQ(parsed->get_node("lone")->get_tag_value(), 0.1);
+    EXPECT_EQ(parsed->get_node("a")->get_children().at(
+                  parsed->get_node("b\"q")),
+              3);
+}
+
+// Test 27: Edge-list export and import round trip, including isolated nodes
+TEST_F(GraphTest, EdgeListRoundTrip) {
+    graph->add_node_set({"x", "y", "z", "w"});
+    graph->add_edge("x", "y", 5);
+    graph->add_edge("y", "z", 1);
+
+    std::stringstream list;
+    ASSERT_FALSE(graph->write_edge_list(list).has_value());
+    auto parsed = Graph::read_edge_list(list);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_TRUE(*parsed == *graph);
+    EXPECT_EQ(parsed->get_num_nodes(), 4);
+
+    Graph spaced;
+    spaced.add_node("has space");
+    std::stringstream rejected;
+    EXPECT_EQ(spaced.write_edge_list(rejected),
+              mcis::GraphError::INVALID_PARAMETERS);
+}
+
+// Test 28: DOT edge chains, comments and attribute statements are accepted
+TEST_F(GraphTest, DotChainsAndComments) {
+    std::istringstream dot(
+        "strict digraph \"g\" {\n"
+        "  // line comment\n"
+        "  rankdir=LR; node [shape=box]\n"
+        "  /* block\n comment */\n"
+        "  # preprocessor-style comment\n"
+        "  a->b -> c [weight=4];\n"
+        "  d [tag=\"t\", label=<v<SUB>1</SUB>>]\n"
+        "}\n");
+    auto parsed = Graph::read_dot(dot);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->get_num_nodes(), 4);
+    EXPECT_EQ(parsed->get_node("b")->get_children().at(parsed->get_node("c")),
+              4);
+    EXPECT_EQ(parsed->get_node("d")->get_tag(), "t");
+}
+
+// Test 29: Malformed or undirected input is rejected
+TEST_F(GraphTest, ImportRejectsMalformedInput) {
+    for (const char* text :
+         {"graph G { a -- b }", "digraph G { a -> }", "digraph G { a -> b",
+          "digraph { subgraph s { a } }", "digraph { \"open }",
+          "digraph { a -- b }", "digraph { a } b"}) {
+        std::istringstream dot(text);
+        EXPECT_EQ(Graph::read_dot(dot).error(),
+                  mcis::GraphError::INVALID_FILE_FORMAT)
+            << text;
+    }
+    std::istringstream list("a b notanumber\n");
+    EXPECT_EQ(Graph::read_edge_list(list).error(),
+              mcis::GraphError::INVALID_FILE_FORMAT);
+    std::istringstream duplicate("a b 1\na b 2\n");
+    EXPECT_EQ(Graph::read_edge_list(duplicate).error(),
+              mcis::GraphError::EDGE_ALREADY_EXISTS);
+}
+
+// Test 30: Diagram files go to the requested directory without rendering
+TEST_F(GraphTest, DiagramFileWithoutRendering) {
+    graph->add_node_set({"v^1_2", "b"});
+    graph->add_edge("v^1_2", "b", 0);
+    DiagramOptions options;
+    options.dot_directory = ::testing::TempDir();
+    ASSERT_FALSE(graph->generate_diagram_file("graph_io", options).has_value());
+}
+
+// Test 31: Analyses give the topological order, levels and degree counts
+TEST_F(GraphTest, AnalysisOfDag) {
+    // a -> b -> d, a -> c -> d, a -> d, e isolated
+    graph->add_node_set({"a", "b", "c", "d", "e"});
+    graph->add_edge_set("a", {"b", "c", "d"});
+    graph->add_edge("b", "d", 0);
+    graph->add_edge("c", "d", 0);
+    graph->set_node_tag("b", "*");
+    graph->set_node_tag("c", "*");
+
+    const GraphAnalysis& analysis = graph->analysis();
+    ASSERT_TRUE(analysis.is_dag);
+    ASSERT_EQ(analysis.topological_order.size(), 5u);
+    for (const auto& [id, node] : graph->get_nodes()) {
+        for (const auto& [child, weight] : node->get_children()) {
+            EXPECT_LT(analysis.topological_index.at(node),
+                      analysis.topological_index.at(child));
+        }
+    }
+    Node* a = graph->get_node("a");
+    Node* d = graph->get_node("d");
+    Node* e = graph->get_node("e");
+    EXPECT_EQ(analysis.asap_level(a), 0u);
+    EXPECT_EQ(analysis.asap_level(d), 2u);
+    EXPECT_EQ(analysis.asap_level(e), 0u);
+    EXPECT_EQ(analysis.alap_level(a), 0u);
+    EXPECT_EQ(analysis.alap_level(e), 2u);
+    ASSERT_EQ(analysis.levels.size(), 3u);
+    EXPECT_EQ(analysis.levels[1].size(), 2u);
+
+    EXPECT_EQ(analysis.in_degree_histogram,
+              (std::vector<uint32_t>{2, 2, 0, 1}));
+    EXPECT_EQ(analysis.out_degree_histogram,
+              (std::vector<uint32_t>{2, 2, 0, 1}));
+    EXPECT_EQ(analysis.sources.size(), 2u);
+    EXPECT_EQ(analysis.sinks.size(), 2u);
+    EXPECT_EQ(analysis.tag_index.at("*").size(), 2u);
+    EXPECT_EQ(analysis.tag_index.at("").size(), 3u);
+}
+
+// Test 32: Analyses and snapshots are cached until the graph changes
+TEST_F(GraphTest, AnalysisIsCachedPerVersion) {
+    graph->add_node_set({"a", "b"});
+    graph->add_edge("a", "b", 1);
+    const GraphAnalysis* first = &graph->analysis();
+    EXPECT_EQ(&graph->analysis(), first);
+    EXPECT_EQ(first->version, graph->get_version());
+    CompactGraph frozen = graph->freeze();
+    EXPECT_EQ(graph->freeze().out_neighbors(0).data(),
+              frozen.out_neighbors(0).data());
+
+    graph->set_node_tag("a", "+");
+    EXPECT_EQ(graph->analysis().tag_index.at("+").size(), 1u);
+    EXPECT_EQ(graph->freeze().get_tag(0), "+");
+    graph->change_edge_weight("a", "b", 9);
+    EXPECT_EQ(graph->freeze().out_edge_weights(0)[0], 9);
+
+    graph->add_edge("b", "a", 0);
+    EXPECT_FALSE(graph->analysis().is_dag);
+    EXPECT_TRUE(graph->analysis().topological_order.empty());
+    EXPECT_FALSE(graph->analysis().asap_level(graph->get_node("a")));
+    EXPECT_FALSE(graph->is_dag());
+    graph->remove_edge("b", "a");
+    EXPECT_TRUE(graph->is_dag());
+}
+
+// Test 33: Incremental DAG mode rejects exactly the cycle-closing edges
+TEST_F(GraphTest, IncrementalDagRejectsCycles) {
+    constexpr int NUM_NODES = 60;
+    Graph reference;
+    ASSERT_FALSE(graph->enable_incremental_dag().has_value());
+    for (int i = 0; i < NUM_NODES; ++i) {
+        graph->add_node(std::to_string(i));
+        reference.add_node(std::to_string(i));
+    }
+    // Pseudo-random edges in both directions, checked against full rescans
+    uint32_t state = 12345;
+    for (int step = 0; step < 400; ++step) {
+        state = state * 1103515245 + 12345;
+        const std::string from = std::to_string((state >> 8) % NUM_NODES);
+        const std::string to = std::to_string((state >> 20) % NUM_NODES);
+        if (from == to) {
+            continue;
+        }
+        reference.add_edge(from, to, 0);
+        const bool acyclic = reference.is_dag();
+        if (!acyclic) {
+            reference.remove_edge(from, to);
+        }
+        const auto error = graph->add_edge(from, to, 0);
+        EXPECT_EQ(error == mcis::GraphError::CYCLE_DETECTED, !acyclic);
+    }
+    EXPECT_TRUE(*graph == reference);
+
+    const GraphAnalysis& analysis = graph->analysis();
+    ASSERT_TRUE(analysis.is_dag);
+    for (const auto& [id, node] : graph->get_nodes()) {
+        for (const auto& [child, weight] : node->get_children()) {
+            EXPECT_LT(analysis.topological_index.at(node),
+                      analysis.topological_index.at(child));
+        }
+    }
+}
+
+// Test 34: The maintained order survives removals, copies and moves
+TEST_F(GraphTest, IncrementalDagAcrossEdits) {
+    graph->add_node_set({"a", "b", "c", "d"});
+    graph->add_edge("a", "b", 0);
+    graph->add_edge("b", "a", 0);
+    EXPECT_EQ(graph->enable_incremental_dag(),
+              mcis::GraphError::CYCLE_DETECTED);
+    EXPECT_FALSE(graph->is_incremental_dag());
+    graph->remove_edge("b", "a");
+    ASSERT_FALSE(graph->enable_incremental_dag().has_value());
+
+    EXPECT_FALSE(graph->add_edge_set("c", {"d", "a"}).has_value());
+    EXPECT_EQ(graph->add_edge("b", "c", 0), mcis::GraphError::CYCLE_DETECTED);
+    EXPECT_EQ(graph->add_edge_set("d", {"c"}),
+              mcis::GraphError::CYCLE_DETECTED);
+    EXPECT_FALSE(graph->get_node("d")->get_children().count(
+        graph->get_node("c")));
+
+    Graph copy = *graph;
+    EXPECT_TRUE(copy.is_incremental_dag());
+    EXPECT_EQ(copy.add_edge("b", "c", 0), mcis::GraphError::CYCLE_DETECTED);
+    Graph moved = std::move(copy);
+    EXPECT_EQ(moved.add_edge("d", "c", 0), mcis::GraphError::CYCLE_DETECTED);
+
+    graph->remove_node("a");
+    graph->remove_nodes_bulk({"c"});
+    graph->add_node("e");
+    EXPECT_FALSE(graph->add_edge("b", "d", 0).has_value());
+    EXPECT_FALSE(graph->add_edge("e", "b", 0).has_value());
+    EXPECT_EQ(graph->add_edge("d", "e", 0), mcis::GraphError::CYCLE_DETECTED);
+    EXPECT_EQ(graph->analysis().topological_order.size(), 3u);
+
+    graph->disable_incremental_dag();
+    EXPECT_FALSE(graph->add_edge("d", "e", 0).has_value());
+    EXPECT_FALSE(graph->is_dag());
+}
+
+// Test 35: Bulk removal rewires survivors and skips unknown or repeated IDs
+TEST_F(GraphTest, RemoveNodesBulkRewiresSurvivors) {
+    // a -> b -> c -> d, a -> c, b -> d, e -> b
+    graph->add_node_set({"a", "b", "c", "d", "e"});
+    graph->add_edge_set("a", {"b", "c"});
+    graph->add_edge_set("b", {"c", "d"});
+    graph->add_edge("c", "d", 0);
+    graph->add_edge("e", "b", 0);
+
+    EXPECT_EQ(graph->remove_nodes_bulk({"b", "c", "missing", "b"}), 2);
+    ASSERT_EQ(graph->get_num_nodes(), 3);
+    Node* a = graph->get_node("a");
+    Node* d = graph->get_node("d");
+    Node* e = graph->get_node("e");
+    EXPECT_TRUE(a->get_children().empty());
+    EXPECT_EQ(a->get_num_children(), 0);
+    EXPECT_TRUE(d->get_parents().empty());
+    EXPECT_EQ(d->get_num_parents(), 0);
+    EXPECT_EQ(e->get_num_children(), 0);
+    EXPECT_EQ(graph->remove_nodes_bulk({}), 0);
+
+    EXPECT_FALSE(graph->add_edge("a", "d", 0).has_value());
+    EXPECT_FALSE(graph->remove_node("d").has_value());
+    EXPECT_EQ(a->get_num_children(), 0);
+    EXPECT_TRUE(a->get_children().empty());
+}
+
+// Test 36: Lookups take string views and node IDs can be moved in
+TEST_F(GraphTest, StringViewLookupAndMovedIds) {
+    std::string long_id(64, 'x');
+    const std::string copy = long_id;
+    EXPECT_FALSE(graph->add_node(std::move(long_id)).has_value());
+    EXPECT_EQ(graph->add_node(copy), mcis::GraphError::NODE_ALREADY_EXISTS);
+    std::vector<std::string> ids = {"a", "b"};
+    EXPECT_FALSE(graph->add_node_set(std::move(ids)).has_value());
+
+    const std::string_view a = "a";
+    EXPECT_FALSE(graph->add_edge(a, std::string_view(copy), 2).has_value());
+    EXPECT_FALSE(graph->set_node_tag(a, std::string_view("+")).has_value());
+    Node* node = graph->get_node(a);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->get_id_view(), "a");
+    EXPECT_EQ(node->get_tag_view(), "+");
+    EXPECT_TRUE(graph->get_node(copy)->check_parent(a));
+    EXPECT_EQ(graph->get_nodes().find(a)->second, node);
+    EXPECT_FALSE(graph->remove_node(a).has_value());
+    EXPECT_EQ(graph->get_node(std::string_view("a")), nullptr);
+}
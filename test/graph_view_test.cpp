@@ -0,0 +1,139 @@
+/**
+ * @file graph_view_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include "mcis/graph_view.h"
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class GraphViewTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+
+    // a(+) -> b(*) -> c(+) -> d(+), plus a -> c and b -> d
+    static Graph mixed_graph() {
+        Graph g;
+        for (const auto& [id, tag] :
+             {std::pair{"a", "+"}, {"b", "*"}, {"c", "+"}, {"d", "+"}}) {
+            g.add_node(id);
+            g.set_node_tag(id, tag);
+        }
+        g.add_edge("a", "b", 1);
+        g.add_edge("b", "c", 2);
+        g.add_edge("c", "d", 3);
+        g.add_edge("a", "c", 4);
+        g.add_edge("b", "d", 5);
+        return g;
+    }
+
+    static size_t result_size(
+        std::expected<std::vector<Graph*>, mcis::AlgorithmError>& result) {
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return 0;
+        }
+        const size_t size = (*result)[0]->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return size;
+    }
+};
+
+// Test 1: A tag view keeps parent IDs and only the tagged vertices
+TEST_F(GraphViewTest, TagViewKeepsParentIds) {
+    Graph g = mixed_graph();
+    CompactGraph c = g.freeze();
+    GraphView view(c, "+");
+    EXPECT_EQ(view.get_num_nodes(), 3u);
+    for (const auto v : view.vertices()) {
+        EXPECT_EQ(c.get_tag(v), "+");
+        EXPECT_TRUE(view.contains(v));
+    }
+    EXPECT_FALSE(view.contains(*c.get_index("b")));
+    EXPECT_EQ(GraphView(c, "missing").get_num_nodes(), 0u);
+}
+
+// Test 2: Degrees and neighbours are those of the induced subgraph
+TEST_F(GraphViewTest, DegreesAreWithinTheView) {
+    Graph g = mixed_graph();
+    CompactGraph c = g.freeze();
+    GraphView view(c, "+");
+    const auto a = *c.get_index("a");
+    const auto d = *c.get_index("d");
+    EXPECT_EQ(c.out_degree(a), 2u);
+    EXPECT_EQ(view.out_degree(a), 1u);
+    EXPECT_EQ(c.in_degree(d), 2u);
+    EXPECT_EQ(view.in_degree(d), 1u);
+    std::vector<GraphView::VertexId> seen;
+    view.for_each_out_neighbor(a, [&](auto v) { seen.push_back(v); });
+    ASSERT_EQ(seen.size(), 1u);
+    EXPECT_EQ(c.get_id(seen[0]), "c");
+
+    GraphView full(c);
+    EXPECT_EQ(full.get_num_nodes(), c.get_num_nodes());
+    EXPECT_EQ(full.out_degree(a), c.out_degree(a));
+}
+
+// Test 3: Predicate views select arbitrary vertex sets
+TEST_F(GraphViewTest, PredicateView) {
+    Graph g = mixed_graph();
+    CompactGraph c = g.freeze();
+    GraphView view(c, [&](GraphView::VertexId v) {
+        return c.get_id(v) != "c";
+    });
+    EXPECT_EQ(view.get_num_nodes(), 3u);
+    EXPECT_EQ(view.out_degree(*c.get_index("a")), 1u);
+    EXPECT_EQ(view.in_degree(*c.get_index("d")), 1u);
+}
+
+// Test 4: Materializing a tag view matches get_subgraph_with_tag on Graph
+TEST_F(GraphViewTest, MaterializeMatchesSubgraph) {
+    Graph g = mixed_graph();
+    CompactGraph c = g.freeze();
+    Graph expected = g.get_subgraph_with_tag("+");
+    Graph materialized = GraphView(c, "+").materialize().thaw();
+    EXPECT_EQ(materialized.get_num_nodes(), 3);
+    EXPECT_TRUE(materialized == expected);
+    EXPECT_EQ(GraphView(c, "+").materialize().get_num_edges(), 2u);
+}
+
+// Test 5: Tagged runs agree with runs on explicitly filtered subgraphs
+TEST_F(GraphViewTest, TaggedRunsMatchFilteredRuns) {
+    Graph g1 = mixed_graph();
+    Graph g2 = mixed_graph();
+    g2.add_edge("a", "d", 0);
+    Graph s1 = g1.get_subgraph_with_tag("+");
+    Graph s2 = g2.get_subgraph_with_tag("+");
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_SERIAL, AlgorithmType::KPT,
+          AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+        auto tagged = mcis_algorithm->run({&g1, &g2}, type, "+");
+        auto filtered = mcis_algorithm->run({&s1, &s2}, type);
+        EXPECT_EQ(result_size(tagged), result_size(filtered))
+            << static_cast<int>(type);
+    }
+}
@@ -90,3 +90,63 @@ TEST_F(KPTTest, EmptyGraphs) {
     EXPECT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), mcis::AlgorithmError::EMPTY_GRAPH);
 }
+
+// Test with chains, where every pair of hyperedges conflicts
+TEST_F(KPTTest, ChainsAllConflict) {
+    Graph g1, g2;
+    for (int i = 0; i < 4; ++i) {
+        g1.add_node("a" + std::to_string(i));
+        g2.add_node("b" + std::to_string(i));
+        if (i > 0) {
+            g1.add_edge("a" + std::to_string(i - 1), "a" + std::to_string(i),
+                        1);
+            g2.add_edge("b" + std::to_string(i - 1), "b" + std::to_string(i),
+                        1);
+        }
+    }
+
+    std::vector<const Graph*> graphs = {&g1, &g2};
+    auto result = mcis_algorithm->run(graphs, AlgorithmType::KPT);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1u);
+    EXPECT_EQ((*result)[0]->get_num_nodes(), 1);
+    for (auto* graph : *result) {
+        delete graph;
+    }
+}
+
+// Test with edgeless graphs, where only shared vertices conflict
+TEST_F(KPTTest, EdgelessGraphsMatchFully) {
+    Graph g1, g2;
+    for (int i = 0; i < 4; ++i) {
+        g1.add_node("a" + std::to_string(i));
+    }
+    for (int i = 0; i < 3; ++i) {
+        g2.add_node("b" + std::to_string(i));
+    }
+
+    std::vector<const Graph*> graphs = {&g1, &g2};
+    auto result = mcis_algorithm->run(graphs, AlgorithmType::KPT);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1u);
+    EXPECT_EQ((*result)[0]->get_num_nodes(), 3);
+    for (auto* graph : *result) {
+        delete graph;
+    }
+}
+
+// Test with larger CDAGs, which used to exhaust the stack
+TEST_F(KPTTest, LargeHyperedgeSet) {
+    auto fft = Graph::create_fft_graph_from_dimensions(16);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(4, 4);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+
+    std::vector<const Graph*> graphs = {&*fft, &*mvm};
+    auto result = mcis_algorithm->run(graphs, AlgorithmType::KPT);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1u);
+    EXPECT_GT((*result)[0]->get_num_nodes(), 0);
+    for (auto* graph : *result) {
+        delete graph;
+    }
+}
@@ -0,0 +1,181 @@
+/**
+ * @file mcis_result_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/mcis_result.h"
+
+class MCISResultTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+
+    // Checks that a result's edge list holds exactly the pairs joined in
+    // every input and that its graph agrees, and optionally that the
+    // mapping is injective
+    static void expect_consistent(const MCISResult& result,
+                                  bool injective = true) {
+        ASSERT_FALSE(result.empty());
+        for (size_t g = 0; g < result.get_num_graphs(); ++g) {
+            const auto column = result.column(g);
+            ASSERT_EQ(column.size(), result.size());
+            if (injective) {
+                EXPECT_EQ(std::set<CompactGraph::VertexId>(column.begin(),
+                                                           column.end())
+                              .size(),
+                          result.size());
+            }
+            for (const auto v : column) {
+                EXPECT_LT(v, result.input(g).get_num_nodes());
+            }
+        }
+
+        std::set<MCISResult::Edge> edges(result.edges().begin(),
+                                         result.edges().end());
+        for (uint32_t a = 0; a < result.size(); ++a) {
+            for (uint32_t b = 0; b < result.size(); ++b) {
+                bool in_every_graph = a != b;
+                for (size_t g = 0; g < result.get_num_graphs(); ++g) {
+                    in_every_graph = in_every_graph
+                                     && result.input(g).has_edge(
+                                         result.column(g)[a],
+                                         result.column(g)[b]);
+                }
+                EXPECT_EQ(edges.count({a, b}) == 1, in_every_graph);
+            }
+        }
+
+        const CompactGraph graph = result.graph().freeze();
+        ASSERT_EQ(graph.get_num_nodes(), result.size());
+        EXPECT_EQ(graph.get_num_edges(), result.edges().size());
+        for (const auto& [a, b] : result.edges()) {
+            EXPECT_TRUE(graph.has_edge(*graph.get_index(result.get_id(a)),
+                                       *graph.get_index(result.get_id(b))));
+        }
+    }
+};
+
+// Test 1: Results agree with the Graph-returning runs for every finder
+TEST_F(MCISResultTest, MatchesGraphResults) {
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(2, 2);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+    const std::vector<const Graph*> graphs = {&*fft, &*mvm};
+
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_SERIAL, AlgorithmType::KPT,
+          AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL, AlgorithmType::MCSPLIT}) {
+        auto results = mcis_algorithm->run_results(graphs, type);
+        auto legacy = mcis_algorithm->run(graphs, type);
+        ASSERT_TRUE(results.has_value() && legacy.has_value());
+        ASSERT_EQ(results->size(), legacy->size());
+        for (size_t i = 0; i < results->size(); ++i) {
+            const MCISResult& result = (*results)[i];
+            // The serial Bron-Kerbosch product lets components repeat
+            expect_consistent(result,
+                              type != AlgorithmType::BRON_KERBOSCH_SERIAL);
+            EXPECT_EQ(result.get_num_graphs(), 2u);
+            EXPECT_EQ(result.graph(), *(*legacy)[i]);
+        }
+        for (auto* graph : *legacy) {
+            delete graph;
+        }
+    }
+}
+
+// Test 2: Results own their inputs, and copies share the materialized graph
+TEST_F(MCISResultTest, OwnsInputs) {
+    std::optional<MCISResult> kept;
+    {
+        auto fft1 = Graph::create_fft_graph_from_dimensions(4);
+        auto fft2 = Graph::create_fft_graph_from_dimensions(4);
+        ASSERT_TRUE(fft1.has_value() && fft2.has_value());
+        auto results = mcis_algorithm->run_results({&*fft1, &*fft2},
+                                                   AlgorithmType::MAX_CLIQUE);
+        ASSERT_TRUE(results.has_value());
+        ASSERT_EQ(results->size(), 1u);
+        kept = results->front();
+    }
+    EXPECT_EQ(kept->size(), kept->input(0).get_num_nodes());
+    expect_consistent(*kept);
+
+    const MCISResult copy = *kept;
+    EXPECT_EQ(&copy.graph(), &kept->graph());
+    EXPECT_EQ(copy.get_id(0), kept->input(0).get_id(kept->column(0)[0]) + "_"
+                                  + kept->input(1).get_id(kept->column(1)[0]));
+}
+
+// Test 3: Tagged runs map into the full input graphs
+TEST_F(MCISResultTest, TaggedRunsUseParentIds) {
+    auto mvm = Graph::create_mvm_graph_from_dimensions(3, 3);
+    ASSERT_TRUE(mvm.has_value());
+    const CompactGraph first = mvm->freeze();
+    const CompactGraph second = mvm->freeze();
+    const std::string tag = first.get_tag(first.get_num_nodes() - 1);
+    ASSERT_FALSE(tag.empty());
+
+    for (const auto type : {AlgorithmType::KPT, AlgorithmType::MAX_CLIQUE,
+                            AlgorithmType::MCSPLIT}) {
+        const std::vector<const CompactGraph*> graphs = {&first, &second};
+        auto results = mcis_algorithm->run_results(graphs, type, tag);
+        ASSERT_TRUE(results.has_value());
+        ASSERT_FALSE(results->empty());
+        const MCISResult& result = results->front();
+        expect_consistent(result);
+        EXPECT_EQ(result.input(0).get_num_nodes(), first.get_num_nodes());
+        for (size_t g = 0; g < 2; ++g) {
+            for (const auto v : result.column(g)) {
+                EXPECT_EQ(result.input(g).get_tag(v), tag);
+            }
+        }
+    }
+}
+
+// Test 4: Empty inputs are rejected, and finders without mappings say so
+TEST_F(MCISResultTest, Errors) {
+    Graph empty, single;
+    single.add_node("a");
+    auto results = mcis_algorithm->run_results({&empty, &single},
+                                               AlgorithmType::MAX_CLIQUE);
+    ASSERT_FALSE(results.has_value());
+    EXPECT_EQ(results.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+
+    struct GraphOnlyFinder : MCISFinder {
+        std::expected<std::vector<Graph*>, mcis::AlgorithmError> find(
+            const std::vector<const Graph*>&,
+            std::optional<std::string>) override {
+            return std::vector<Graph*>{};
+        }
+    } finder;
+    const CompactGraph compact = single.freeze();
+    auto unsupported
+        = finder.find_results({GraphView(compact)}, RunOptions{});
+    ASSERT_FALSE(unsupported.has_value());
+    EXPECT_EQ(unsupported.error(), mcis::AlgorithmError::INVALID_ALGORITHM);
+
+    const MCISResult none;
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.graph().get_num_nodes(), 0);
+}
@@ -0,0 +1,214 @@
+/**
+ * @file mcsplit_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class McSplitTest : public MCISAlgorithmTest {
+ protected:
+    // Size of the MCIS; if connected is set, also checks that it is weakly
+    // connected
+    int run_size(const std::vector<const Graph*>& graphs,
+                 const RunOptions& options = {},
+                 AlgorithmType type = AlgorithmType::MCSPLIT) {
+        auto result
+            = mcis_algorithm->run(graphs, type, std::nullopt, options);
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return 0;
+        }
+        EXPECT_EQ(result->size(), 1u);
+        if (options.mcsplit.connected) {
+            EXPECT_TRUE(weakly_connected((*result)[0]->freeze()));
+        }
+        int size = (*result)[0]->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return size;
+    }
+
+    static bool weakly_connected(const CompactGraph& graph) {
+        const uint32_t n = graph.get_num_nodes();
+        if (n == 0) {
+            return true;
+        }
+        std::vector<bool> seen(n, false);
+        std::vector<uint32_t> stack = {0};
+        seen[0] = true;
+        uint32_t reached = 1;
+        while (!stack.empty()) {
+            const uint32_t v = stack.back();
+            stack.pop_back();
+            for (const auto& neighbors :
+                 {graph.out_neighbors(v), graph.in_neighbors(v)}) {
+                for (const auto u : neighbors) {
+                    if (!seen[u]) {
+                        seen[u] = true;
+                        ++reached;
+                        stack.push_back(u);
+                    }
+                }
+            }
+        }
+        return reached == n;
+    }
+};
+
+// Test 1: Empty inputs are rejected
+TEST_F(McSplitTest, EmptyGraphs) {
+    Graph empty1, empty2;
+    std::vector<const Graph*> graphs = {&empty1, &empty2};
+    auto result = mcis_algorithm->run(graphs, AlgorithmType::MCSPLIT);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+}
+
+// Test 2: Matches exhaustive search and the clique finder on random DAGs
+TEST_F(McSplitTest, MatchesBruteForce) {
+    std::mt19937 rng(42);
+    for (int trial = 0; trial < 20; ++trial) {
+        Graph g1 = random_dag(5 + trial % 2, 0.4, rng, "u");
+        Graph g2 = random_dag(5, 0.5, rng, "v");
+        const int expected = brute_force_mcis(g1, g2, true);
+        EXPECT_EQ(run_size({&g1, &g2}), expected) << "trial " << trial;
+        EXPECT_EQ(run_size({&g1, &g2}, {}, AlgorithmType::MAX_CLIQUE),
+                  expected)
+            << "trial " << trial;
+    }
+}
+
+// Test 3: Ignoring directions lets a fan-out match a fan-in
+TEST_F(McSplitTest, UndirectedMatching) {
+    Graph fan_out, fan_in;
+    for (const std::string id : {"a", "b", "c"}) {
+        fan_out.add_node(id);
+        fan_in.add_node(id);
+    }
+    fan_out.add_edge("a", "b", 0);
+    fan_out.add_edge("a", "c", 0);
+    fan_in.add_edge("b", "a", 0);
+    fan_in.add_edge("c", "a", 0);
+    EXPECT_EQ(run_size({&fan_out, &fan_in}), 2);
+
+    RunOptions undirected;
+    undirected.mcsplit.directed = false;
+    EXPECT_EQ(run_size({&fan_out, &fan_in}, undirected), 3);
+
+    std::mt19937 rng(3);
+    for (int trial = 0; trial < 10; ++trial) {
+        Graph g1 = random_dag(6, 0.4, rng, "u");
+        Graph g2 = random_dag(5, 0.4, rng, "v");
+        EXPECT_EQ(run_size({&g1, &g2}, undirected),
+                  brute_force_mcis(g1, g2, false))
+            << "trial " << trial;
+    }
+}
+
+// Test 4: A connected MCIS skips isolated matches
+TEST_F(McSplitTest, ConnectedResult) {
+    Graph g1, g2;
+    for (Graph* g : {&g1, &g2}) {
+        for (const std::string id : {"a", "b", "c", "d", "e"}) {
+            g->add_node(id);
+        }
+        g->add_edge("a", "b", 0);
+        g->add_edge("b", "c", 0);
+    }
+    // d and e are isolated in the first graph and joined in the second
+    g2.add_edge("e", "d", 0);
+    EXPECT_EQ(run_size({&g1, &g2}), 4);
+
+    RunOptions connected;
+    connected.mcsplit.connected = true;
+    EXPECT_EQ(run_size({&g1, &g2}, connected), 3);
+
+    // Connected results are never larger and always weakly connected
+    std::mt19937 rng(11);
+    for (int trial = 0; trial < 10; ++trial) {
+        Graph r1 = random_dag(7, 0.3, rng, "u");
+        Graph r2 = random_dag(7, 0.3, rng, "v");
+        EXPECT_LE(run_size({&r1, &r2}, connected), run_size({&r1, &r2}));
+    }
+}
+
+// Test 5: Tags restrict which vertices may be matched
+TEST_F(McSplitTest, MatchTags) {
+    Graph g1, g2;
+    for (Graph* g : {&g1, &g2}) {
+        g->add_node("a");
+        g->add_node("b");
+        g->add_edge("a", "b", 0);
+        g->set_node_tag("a", "x");
+    }
+    g1.set_node_tag("b", "y");
+    g2.set_node_tag("b", "x");
+    EXPECT_EQ(run_size({&g1, &g2}), 2);
+
+    RunOptions tagged;
+    tagged.mcsplit.match_tags = true;
+    EXPECT_EQ(run_size({&g1, &g2}, tagged), 1);
+
+    // The candidate filter's tag rule applies as well
+    RunOptions filtered;
+    filtered.candidate_filter.match_tags = true;
+    EXPECT_EQ(run_size({&g1, &g2}, filtered), 1);
+}
+
+// Test 6: Three-way matching and agreement on generated graphs
+TEST_F(McSplitTest, ThreeGraphsAndGenerators) {
+    std::mt19937 rng(7);
+    Graph g1 = random_dag(5, 0.5, rng, "a");
+    Graph g2 = random_dag(5, 0.5, rng, "b");
+    Graph g3 = random_dag(5, 0.5, rng, "c");
+    EXPECT_EQ(run_size({&g1, &g2, &g3}),
+              run_size({&g1, &g2, &g3}, {}, AlgorithmType::MAX_CLIQUE));
+
+    auto fft1 = Graph::create_fft_graph_from_dimensions(4);
+    auto fft2 = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(fft1.has_value() && fft2.has_value());
+    EXPECT_EQ(run_size({&*fft1, &*fft2}), fft1->get_num_nodes());
+
+    auto dwt = Graph::create_haar_wavelet_transform_graph_from_dimensions(4, 2);
+    ASSERT_TRUE(dwt.has_value());
+    const Graph& dwt_graph = (*dwt)[0];
+    EXPECT_EQ(run_size({&dwt_graph, &*fft1}),
+              run_size({&dwt_graph, &*fft1}, {}, AlgorithmType::MAX_CLIQUE));
+}
+
+// Test 7: The report proves optimality, or flags a stopped search
+TEST_F(McSplitTest, ReportsStatus) {
+    std::mt19937 rng(5);
+    Graph g1 = random_dag(8, 0.4, rng, "u");
+    Graph g2 = random_dag(8, 0.4, rng, "v");
+    RunOptions options;
+    SearchReport report;
+    options.report = &report;
+    const int size = run_size({&g1, &g2}, options);
+    EXPECT_EQ(report.status, SearchStatus::COMPLETE);
+    EXPECT_EQ(report.best_size, static_cast<size_t>(size));
+    EXPECT_EQ(report.upper_bound, report.best_size);
+
+    auto fft = Graph::create_fft_graph_from_dimensions(8);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(3, 3);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+    options.expansion_budget = 1000;
+    run_size({&*fft, &*mvm}, options);
+    EXPECT_EQ(report.status, SearchStatus::BUDGET_EXHAUSTED);
+    EXPECT_GE(report.upper_bound, report.best_size);
+    EXPECT_GT(report.best_size, 0u);
+}
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -142,3 +143,16 @@ TEST_F(MVMTest, MVMEdgeConnectivityVerification) {
     if (generate_diagrams)
         mvm_graph.generate_diagram_file("mvm_connectivity_test");
 }
+
+// Test 8: The direct compact generator matches the Graph generator
+TEST_F(MVMTest, CompactGeneratorMatchesGraph) {
+    for (const auto& [m, n] :
+         std::vector<std::pair<int, int>>{{1, 1}, {3, 1}, {1, 4}, {3, 2},
+                                          {2, 3}, {5, 7}}) {
+        auto graph = Graph::create_mvm_graph_from_dimensions(m, n);
+        auto compact = CompactGraph::create_mvm_graph_from_dimensions(m, n, 3);
+        ASSERT_TRUE(graph.has_value() && compact.has_value());
+        EXPECT_TRUE(compact->thaw() == *graph) << m << "x" << n;
+    }
+    EXPECT_FALSE(CompactGraph::create_mvm_graph_from_dimensions(0, 4));
+}
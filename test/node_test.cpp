@@ -416,3 +416,31 @@ TEST_F(NodeTest, ComprehensiveEqualityAndComparisonEdgeCases) {
     EXPECT_TRUE(empty1.same_id(empty2));
     EXPECT_FALSE(empty1 == empty2);
 }
+
+// Test 19: Tags are interned, and a numeric value rides along the label
+TEST_F(NodeTest, InternedTagsWithValues) {
+    node_a->set_tag("+/sqrt(2)");
+    node_b->set_tag("+/sqrt(2)", 12.5);
+    EXPECT_EQ(node_a->get_tag_symbol(), node_b->get_tag_symbol());
+    EXPECT_EQ(TagSymbols::find("+/sqrt(2)"), node_a->get_tag_symbol());
+    EXPECT_EQ(TagSymbols::label(node_b->get_tag_symbol()), "+/sqrt(2)");
+    EXPECT_EQ(node_b->get_tag_view(), "+/sqrt(2)");
+    EXPECT_EQ(node_b->get_tag_value(), 12.5);
+    EXPECT_EQ(node_b->get_tag(), "+/sqrt(2),12.500000");
+    EXPECT_FALSE(node_a->get_tag_value().has_value());
+
+    Node copy = *node_b;
+    EXPECT_EQ(copy.get_tag_value(), 12.5);
+    node_b->set_tag("");
+    EXPECT_EQ(node_b->get_tag_symbol(), TagSymbols::UNTAGGED);
+    EXPECT_FALSE(node_b->get_tag_value().has_value());
+    EXPECT_FALSE(TagSymbols::find("never interned label").has_value());
+}
+
+// Test 20: A value without a label reads as the value alone
+TEST_F(NodeTest, UnlabelledTagValue) {
+    node_a->set_tag("", 9.0);
+    EXPECT_EQ(node_a->get_tag(), "9.000000");
+    EXPECT_EQ(node_a->get_tag_view(), "");
+    EXPECT_EQ(node_a->get_tag_value(), 9.0);
+}
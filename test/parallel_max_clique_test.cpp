@@ -0,0 +1,149 @@
+/**
+ * @file parallel_max_clique_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class ParallelMaxCliqueTest : public MCISAlgorithmTest {
+ protected:
+    int run_size(const std::vector<const Graph*>& graphs,
+                 AlgorithmType type = AlgorithmType::MAX_CLIQUE_PARALLEL,
+                 int num_threads = 4) {
+        RunOptions options;
+        options.num_threads = num_threads;
+        auto result = mcis_algorithm->run(graphs, type, std::nullopt, options);
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return 0;
+        }
+        if (type == AlgorithmType::MAX_CLIQUE_PARALLEL) {
+            EXPECT_EQ(result->size(), 1u);
+        }
+        int size = (*result)[0]->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return size;
+    }
+};
+
+// Test 1: Identical triangles share all three nodes
+TEST_F(ParallelMaxCliqueTest, IdenticalTriangles) {
+    Graph g1, g2;
+    for (Graph* g : {&g1, &g2}) {
+        g->add_node("A");
+        g->add_node("B");
+        g->add_node("C");
+        g->add_edge("A", "B", 1);
+        g->add_edge("B", "C", 1);
+        g->add_edge("A", "C", 1);
+    }
+    EXPECT_EQ(run_size({&g1, &g2}), 3);
+}
+
+// Test 2: Empty inputs are rejected
+TEST_F(ParallelMaxCliqueTest, EmptyGraphs) {
+    Graph empty1, empty2;
+    std::vector<const Graph*> graphs = {&empty1, &empty2};
+    auto result
+        = mcis_algorithm->run(graphs, AlgorithmType::MAX_CLIQUE_PARALLEL);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), mcis::AlgorithmError::EMPTY_GRAPH);
+}
+
+// Test 3: The 3-star is the MCIS of a 3-star and a 5-star
+TEST_F(ParallelMaxCliqueTest, StarGraphs) {
+    Graph star3, star5;
+    star3.add_node("c");
+    star5.add_node("c");
+    for (int i = 0; i < 5; ++i) {
+        if (i < 3) {
+            star3.add_node("l" + std::to_string(i));
+            star3.add_edge("c", "l" + std::to_string(i), 1);
+        }
+        star5.add_node("l" + std::to_string(i));
+        star5.add_edge("c", "l" + std::to_string(i), 1);
+    }
+    EXPECT_EQ(run_size({&star3, &star5}), 4);
+}
+
+// Test 4: Edge direction is part of the induced structure
+TEST_F(ParallelMaxCliqueTest, DirectionMatters) {
+    Graph fan_out, fan_in;
+    for (const std::string id : {"a", "b", "c"}) {
+        fan_out.add_node(id);
+        fan_in.add_node(id);
+    }
+    fan_out.add_edge("a", "b", 0);
+    fan_out.add_edge("a", "c", 0);
+    fan_in.add_edge("b", "a", 0);
+    fan_in.add_edge("c", "a", 0);
+    EXPECT_EQ(run_size({&fan_out, &fan_in}), 2);
+}
+
+// Test 5: Matches exhaustive search on random small DAGs for any thread count
+TEST_F(ParallelMaxCliqueTest, MatchesBruteForce) {
+    std::mt19937 rng(42);
+    for (int trial = 0; trial < 20; ++trial) {
+        Graph g1 = random_dag(5 + trial % 2, 0.4, rng, "u");
+        Graph g2 = random_dag(5, 0.5, rng, "v");
+        const int expected = brute_force_mcis(g1, g2);
+        for (int threads : {1, 2, 4}) {
+            EXPECT_EQ(run_size({&g1, &g2}, AlgorithmType::MAX_CLIQUE_PARALLEL,
+                               threads),
+                      expected)
+                << "trial " << trial << ", " << threads << " threads";
+        }
+    }
+}
+
+// Test 6: Identical FFT graphs are found in full
+TEST_F(ParallelMaxCliqueTest, IdenticalFFTGraphs) {
+    auto fft1 = Graph::create_fft_graph_from_dimensions(4);
+    auto fft2 = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(fft1.has_value() && fft2.has_value());
+    EXPECT_EQ(run_size({&*fft1, &*fft2}), fft1->get_num_nodes());
+}
+
+// Test 7: Agrees with the serial search on a DWT vs FFT pair
+TEST_F(ParallelMaxCliqueTest, MatchesSerialOnDWTvsFFT) {
+    auto dwt = Graph::create_haar_wavelet_transform_graph_from_dimensions(4, 2);
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(dwt.has_value() && fft.has_value());
+    const Graph& dwt_graph = (*dwt)[0];
+    EXPECT_EQ(run_size({&dwt_graph, &*fft}),
+              run_size({&dwt_graph, &*fft}, AlgorithmType::MAX_CLIQUE));
+}
+
+// Test 8: Three-way products are supported
+TEST_F(ParallelMaxCliqueTest, ThreeGraphs) {
+    std::mt19937 rng(7);
+    Graph g1 = random_dag(5, 0.5, rng, "a");
+    Graph g2 = random_dag(5, 0.5, rng, "b");
+    Graph g3 = random_dag(5, 0.5, rng, "c");
+    EXPECT_EQ(run_size({&g1, &g2, &g3}),
+              run_size({&g1, &g2, &g3}, AlgorithmType::MAX_CLIQUE));
+}
+
+// Test 9: Large top-level branches are split into second-level tasks
+TEST_F(ParallelMaxCliqueTest, SplitsLargeBranches) {
+    auto fft = Graph::create_fft_graph_from_dimensions(8);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(3, 3);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+    ASSERT_GT(fft->get_num_nodes() * mvm->get_num_nodes(), 1000);
+    EXPECT_GE(run_size({&*fft, &*mvm}), 2);
+}
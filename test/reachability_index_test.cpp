@@ -0,0 +1,185 @@
+/**
+ * @file reachability_index_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+#include "mcis/reachability_index.h"
+
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class ReachabilityIndexTest : public ::testing::Test {
+ protected:
+    static bool bfs_reachable(const CompactGraph& g, CompactGraph::VertexId s,
+                              CompactGraph::VertexId t) {
+        std::vector<bool> visited(g.get_num_nodes(), false);
+        std::queue<CompactGraph::VertexId> q;
+        q.push(s);
+        visited[s] = true;
+        while (!q.empty()) {
+            auto u = q.front();
+            q.pop();
+            if (u == t) return true;
+            for (auto v : g.out_neighbors(u)) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    q.push(v);
+                }
+            }
+        }
+        return false;
+    }
+
+    static Graph random_graph(int n, double p, bool acyclic,
+                              std::mt19937& rng) {
+        Graph g;
+        for (int i = 0; i < n; ++i) {
+            g.add_node("v" + std::to_string(i));
+        }
+        std::bernoulli_distribution coin(p);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i != j && (!acyclic || i < j) && coin(rng)) {
+                    g.add_edge("v" + std::to_string(i),
+                               "v" + std::to_string(j), 0);
+                }
+            }
+        }
+        return g;
+    }
+
+    static void expect_matches_bfs(const CompactGraph& g,
+                                   const ReachabilityIndex& index) {
+        for (CompactGraph::VertexId s = 0; s < g.get_num_nodes(); ++s) {
+            for (CompactGraph::VertexId t = 0; t < g.get_num_nodes(); ++t) {
+                ASSERT_EQ(index.reachable(s, t), bfs_reachable(g, s, t))
+                    << g.get_id(s) << " -> " << g.get_id(t);
+            }
+        }
+    }
+};
+
+// Test 1: Paths, non-paths and reflexivity on a diamond
+TEST_F(ReachabilityIndexTest, Diamond) {
+    Graph g;
+    for (const std::string id : {"a", "b", "c", "d", "e"}) {
+        g.add_node(id);
+    }
+    g.add_edge("a", "b", 0);
+    g.add_edge("a", "c", 0);
+    g.add_edge("b", "d", 0);
+    g.add_edge("c", "d", 0);
+    CompactGraph compact = g.freeze();
+    const ReachabilityIndex& index = compact.reachability();
+    auto id = [&](const std::string& name) {
+        return *compact.get_index(name);
+    };
+
+    EXPECT_TRUE(index.is_dense());
+    EXPECT_TRUE(index.reachable(id("a"), id("d")));
+    EXPECT_TRUE(index.reachable(id("b"), id("b")));
+    EXPECT_FALSE(index.reachable(id("d"), id("a")));
+    EXPECT_FALSE(index.reachable(id("b"), id("c")));
+    EXPECT_FALSE(index.reachable(id("a"), id("e")));
+}
+
+// Test 2: Cycles collapse into one component
+TEST_F(ReachabilityIndexTest, CyclesFormComponents) {
+    Graph g;
+    for (const std::string id : {"a", "b", "c", "d"}) {
+        g.add_node(id);
+    }
+    g.add_edge("a", "b", 0);
+    g.add_edge("b", "c", 0);
+    g.add_edge("c", "a", 0);
+    g.add_edge("c", "d", 0);
+    CompactGraph compact = g.freeze();
+    ReachabilityIndex index(compact);
+    EXPECT_EQ(index.get_num_components(), 2u);
+    expect_matches_bfs(compact, index);
+}
+
+// Test 3: The dense closure agrees with BFS on random graphs
+TEST_F(ReachabilityIndexTest, DenseClosureMatchesBFS) {
+    std::mt19937 rng(1);
+    for (int trial = 0; trial < 10; ++trial) {
+        CompactGraph compact
+            = random_graph(30, 0.08, trial % 2 == 0, rng).freeze();
+        ReachabilityIndex index(compact);
+        ASSERT_TRUE(index.is_dense());
+        expect_matches_bfs(compact, index);
+    }
+}
+
+// Test 4: Interval labels agree with BFS on random graphs
+TEST_F(ReachabilityIndexTest, IntervalLabelsMatchBFS) {
+    std::mt19937 rng(2);
+    for (int trial = 0; trial < 10; ++trial) {
+        CompactGraph compact
+            = random_graph(30, 0.08, trial % 2 == 0, rng).freeze();
+        ReachabilityIndex index(compact, 0);
+        ASSERT_FALSE(index.is_dense());
+        expect_matches_bfs(compact, index);
+    }
+}
+
+// Test 5: Generated CDAGs are indexed in both modes
+TEST_F(ReachabilityIndexTest, FFTGraph) {
+    auto fft = Graph::create_fft_graph_from_dimensions(8);
+    ASSERT_TRUE(fft.has_value());
+    CompactGraph compact = fft->freeze();
+    EXPECT_EQ(compact.reachability().get_num_components(),
+              compact.get_num_nodes());
+    expect_matches_bfs(compact, compact.reachability());
+    expect_matches_bfs(compact, ReachabilityIndex(compact, 0));
+}
+
+// Test 6: Copies of a snapshot share one index
+TEST_F(ReachabilityIndexTest, SharedBetweenCopies) {
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    ASSERT_TRUE(fft.has_value());
+    CompactGraph compact = fft->freeze();
+    CompactGraph copy = compact;
+    EXPECT_EQ(&compact.reachability(), &copy.reachability());
+}
+
+// Test 7: run_many on frozen graphs reuses the snapshots for KPT
+TEST_F(ReachabilityIndexTest, RunManyOnFrozenGraphs) {
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(2, 2);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+    CompactGraph c1 = fft->freeze();
+    CompactGraph c2 = mvm->freeze();
+    std::vector<const CompactGraph*> graphs = {&c1, &c2};
+
+    MCISAlgorithm mcis_algorithm;
+    const ReachabilityIndex* first = nullptr;
+    for (int run = 0; run < 2; ++run) {
+        auto results = mcis_algorithm.run_many(
+            graphs, {AlgorithmType::KPT, AlgorithmType::KPT});
+        ASSERT_TRUE(results.has_value());
+        ASSERT_EQ(results->size(), 2u);
+        EXPECT_EQ((*results)[0][0]->get_num_nodes(),
+                  (*results)[1][0]->get_num_nodes());
+        for (auto& result : *results) {
+            for (auto* g : result) {
+                delete g;
+            }
+        }
+        if (first == nullptr) {
+            first = &c1.reachability();
+        }
+        EXPECT_EQ(&c1.reachability(), first);
+    }
+}
@@ -0,0 +1,189 @@
+/**
+ * @file result_cache_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class ResultCacheTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+        for (const auto& id : {"a", "b", "c", "d"}) {
+            g1.add_node(id);
+            g2.add_node(id);
+            g1.set_node_tag(id, "+");
+            g2.set_node_tag(id, "+");
+        }
+        g1.add_edge("a", "b", 0);
+        g1.add_edge("b", "c", 0);
+        g1.add_edge("c", "d", 0);
+        g2.add_edge("a", "b", 0);
+        g2.add_edge("b", "c", 0);
+        g2.add_edge("a", "d", 0);
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+    Graph g1;
+    Graph g2;
+
+    // Takes ownership of the results
+    static std::vector<Graph> take(
+        std::expected<std::vector<Graph*>, mcis::AlgorithmError>& result) {
+        EXPECT_TRUE(result.has_value());
+        std::vector<Graph> graphs;
+        if (result.has_value()) {
+            for (auto* graph : *result) {
+                graphs.push_back(*graph);
+                delete graph;
+            }
+        }
+        return graphs;
+    }
+};
+
+// Test 1: Repeated runs are served from memory
+TEST_F(ResultCacheTest, RepeatedRunsHit) {
+    mcis_algorithm->enable_result_cache();
+    auto first = mcis_algorithm->run({&g1, &g2}, AlgorithmType::MAX_CLIQUE);
+    std::vector<Graph> computed = take(first);
+    ASSERT_FALSE(computed.empty());
+
+    // An equal graph built separately hits as well
+    Graph copy = g2;
+    auto second = mcis_algorithm->run({&g1, &copy}, AlgorithmType::MAX_CLIQUE);
+    std::vector<Graph> cached = take(second);
+    ASSERT_EQ(cached.size(), computed.size());
+    for (size_t i = 0; i < cached.size(); ++i) {
+        EXPECT_TRUE(cached[i] == computed[i]);
+    }
+    ResultCacheStats stats = mcis_algorithm->result_cache_stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+
+    // Another tag, algorithm, filter or input is a different entry
+    auto tagged = mcis_algorithm->run({&g1, &g2}, AlgorithmType::MAX_CLIQUE,
+                                      "+");
+    take(tagged);
+    RunOptions options;
+    options.candidate_filter.max_degree_difference = 0;
+    auto filtered = mcis_algorithm->run({&g1, &g2}, AlgorithmType::MAX_CLIQUE,
+                                        std::nullopt, options);
+    take(filtered);
+    copy.add_edge("c", "d", 0);
+    auto changed = mcis_algorithm->run({&g1, &copy},
+                                       AlgorithmType::MAX_CLIQUE);
+    take(changed);
+    auto many = mcis_algorithm->run_many(
+        {&g1, &g2},
+        {AlgorithmType::MAX_CLIQUE, AlgorithmType::BRON_KERBOSCH_BITSET});
+    ASSERT_TRUE(many.has_value());
+    for (auto& results : *many) {
+        for (auto* graph : results) {
+            delete graph;
+        }
+    }
+    stats = mcis_algorithm->result_cache_stats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 5u);
+    EXPECT_EQ(stats.entries, 5u);
+
+    mcis_algorithm->clear_result_cache();
+    EXPECT_EQ(mcis_algorithm->result_cache_stats().entries, 0u);
+    mcis_algorithm->disable_result_cache();
+    auto uncached = mcis_algorithm->run({&g1, &g2}, AlgorithmType::MAX_CLIQUE);
+    take(uncached);
+    EXPECT_EQ(mcis_algorithm->result_cache_stats().misses, 0u);
+}
+
+// Test 2: Results written to the cache directory survive the instance
+TEST_F(ResultCacheTest, DirectoryPersists) {
+    const std::string directory = ::testing::TempDir() + "mcis_result_cache";
+    std::filesystem::remove_all(directory);
+    mcis_algorithm->enable_result_cache(directory);
+    auto first = mcis_algorithm->run({&g1, &g2}, AlgorithmType::MAX_CLIQUE);
+    std::vector<Graph> computed = take(first);
+
+    MCISAlgorithm fresh;
+    fresh.enable_result_cache(directory);
+    auto loaded = fresh.run({&g1, &g2}, AlgorithmType::MAX_CLIQUE);
+    std::vector<Graph> cached = take(loaded);
+    ASSERT_EQ(cached.size(), computed.size());
+    for (size_t i = 0; i < cached.size(); ++i) {
+        EXPECT_TRUE(cached[i] == computed[i]);
+    }
+    EXPECT_EQ(fresh.result_cache_stats().hits, 1u);
+    EXPECT_EQ(fresh.result_cache_stats().misses, 0u);
+    std::filesystem::remove_all(directory);
+}
+
+// Test 3: Stopped searches are not cached, and hits report a complete search
+TEST_F(ResultCacheTest, StoppedSearchesAreNotCached) {
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(2, 3);
+    ASSERT_TRUE(fft.has_value() && mvm.has_value());
+    auto size_of = [](std::vector<Graph> graphs) {
+        return graphs.empty() ? 0 : graphs.front().get_num_nodes();
+    };
+    auto uncached = mcis_algorithm->run({&*fft, &*mvm},
+                                        AlgorithmType::MAX_CLIQUE);
+    const int optimum = size_of(take(uncached));
+    ASSERT_GT(optimum, 0);
+
+    mcis_algorithm->enable_result_cache();
+    std::stop_source stop;
+    stop.request_stop();
+    SearchReport report;
+    RunOptions cancelled;
+    cancelled.stop_token = stop.get_token();
+    cancelled.report = &report;
+    auto partial = mcis_algorithm->run({&*fft, &*mvm},
+                                       AlgorithmType::MAX_CLIQUE,
+                                       std::nullopt, cancelled);
+    EXPECT_LT(size_of(take(partial)), optimum);
+    EXPECT_EQ(report.status, SearchStatus::CANCELLED);
+    EXPECT_EQ(mcis_algorithm->result_cache_stats().entries, 0u);
+
+    // A run with the default limits searches again rather than getting the
+    // cancelled result back
+    RunOptions defaults;
+    defaults.report = &report;
+    auto complete = mcis_algorithm->run({&*fft, &*mvm},
+                                        AlgorithmType::MAX_CLIQUE,
+                                        std::nullopt, defaults);
+    EXPECT_EQ(size_of(take(complete)), optimum);
+    EXPECT_EQ(report.status, SearchStatus::COMPLETE);
+    ResultCacheStats stats = mcis_algorithm->result_cache_stats();
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.entries, 1u);
+
+    // The completed result is cached, and a hit fills the report
+    report = SearchReport{};
+    report.status = SearchStatus::CANCELLED;
+    auto hit = mcis_algorithm->run({&*fft, &*mvm}, AlgorithmType::MAX_CLIQUE,
+                                   std::nullopt, defaults);
+    EXPECT_EQ(size_of(take(hit)), optimum);
+    EXPECT_EQ(mcis_algorithm->result_cache_stats().hits, 1u);
+    EXPECT_EQ(report.status, SearchStatus::COMPLETE);
+    EXPECT_EQ(report.best_size, static_cast<size_t>(optimum));
+    EXPECT_EQ(report.upper_bound, static_cast<size_t>(optimum));
+}
@@ -0,0 +1,135 @@
+/**
+ * @file search_control_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <chrono>
+#include <expected>
+#include <random>
+#include <stop_token>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class SearchControlTest : public MCISAlgorithmTest {
+ protected:
+    void SetUp() override {
+        MCISAlgorithmTest::SetUp();
+        std::mt19937 rng(7);
+        g1 = random_dag(18, 0.5, rng, "a");
+        g2 = random_dag(18, 0.5, rng, "b");
+    }
+
+    Graph g1;
+    Graph g2;
+
+    // Runs one algorithm and returns the size of its first result
+    size_t run_size(AlgorithmType type, const RunOptions& options) {
+        auto result = mcis_algorithm->run({&g1, &g2}, type, std::nullopt,
+                                          options);
+        EXPECT_TRUE(result.has_value());
+        if (!result.has_value() || result->empty()) {
+            return 0;
+        }
+        const size_t size = (*result)[0]->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return size;
+    }
+};
+
+// Test 1: Exact finders that complete prove their result optimal
+TEST_F(SearchControlTest, CompleteSearchesHaveNoGap) {
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+        SearchReport report;
+        RunOptions options;
+        options.report = &report;
+        options.time_limit = std::chrono::seconds(60);
+        const size_t size = run_size(type, options);
+        EXPECT_EQ(report.status, SearchStatus::COMPLETE)
+            << static_cast<int>(type);
+        EXPECT_EQ(report.best_size, size);
+        EXPECT_EQ(report.upper_bound, size);
+        EXPECT_EQ(report.gap(), 0.0);
+        EXPECT_GT(report.expansions, 0u);
+    }
+
+    // KPT is an approximation: its bound only caps the result
+    SearchReport report;
+    RunOptions options;
+    options.report = &report;
+    const size_t size = run_size(AlgorithmType::KPT, options);
+    EXPECT_EQ(report.status, SearchStatus::COMPLETE);
+    EXPECT_EQ(report.best_size, size);
+    EXPECT_GE(report.upper_bound, size);
+    EXPECT_LE(report.upper_bound, 18u);
+}
+
+// Test 2: A stopped search still returns its incumbent and a valid bound
+TEST_F(SearchControlTest, StoppedSearchesReturnTheIncumbent) {
+    RunOptions exact;
+    const size_t optimum = run_size(AlgorithmType::MAX_CLIQUE, exact);
+
+    std::stop_source source;
+    source.request_stop();
+    RunOptions budget;
+    budget.expansion_budget = 2000;
+    RunOptions cancelled;
+    cancelled.stop_token = source.get_token();
+    RunOptions expired;
+    expired.deadline
+        = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    for (auto [options, status] :
+         {std::pair{budget, SearchStatus::BUDGET_EXHAUSTED},
+          {cancelled, SearchStatus::CANCELLED},
+          {expired, SearchStatus::TIME_LIMIT}}) {
+        for (const auto type :
+             {AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+              AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+            SearchReport report;
+            options.report = &report;
+            const size_t size = run_size(type, options);
+            EXPECT_EQ(report.status, status) << static_cast<int>(type);
+            EXPECT_GT(size, 0u);
+            EXPECT_LE(size, optimum);
+            EXPECT_EQ(report.best_size, size);
+            EXPECT_GE(report.upper_bound, optimum);
+            EXPECT_LT(report.expansions, 20000u);
+        }
+    }
+}
+
+// Test 3: Progress reports end with the final incumbent and bound
+TEST_F(SearchControlTest, ProgressCallback) {
+    std::vector<SearchProgress> reports;
+    RunOptions options;
+    options.progress_interval = std::chrono::milliseconds(0);
+    options.progress = [&](const SearchProgress& progress) {
+        reports.push_back(progress);
+    };
+    const size_t size = run_size(AlgorithmType::MAX_CLIQUE, options);
+    ASSERT_GE(reports.size(), 2u);
+    for (const auto& progress : reports) {
+        EXPECT_LE(progress.incumbent_size, size);
+        EXPECT_GE(progress.upper_bound, progress.incumbent_size);
+    }
+    EXPECT_EQ(reports.back().incumbent_size, size);
+    EXPECT_EQ(reports.back().upper_bound, size);
+    for (size_t i = 1; i < reports.size(); ++i) {
+        EXPECT_GE(reports[i].expansions, reports[i - 1].expansions);
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file search_metrics_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "./test_helpers.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/search_metrics.h"
+
+class SearchMetricsTest : public MCISAlgorithmTest {
+ protected:
+    void SetUp() override {
+        MCISAlgorithmTest::SetUp();
+        std::mt19937 rng(11);
+        g1 = random_dag(14, 0.4, rng, "a");
+        g2 = random_dag(14, 0.4, rng, "b");
+    }
+
+    Graph g1;
+    Graph g2;
+
+    void run(AlgorithmType type, SearchMetrics& metrics) {
+        RunOptions options;
+        options.metrics = &metrics;
+        auto result = mcis_algorithm->run({&g1, &g2}, type, std::nullopt,
+                                          options);
+        ASSERT_TRUE(result.has_value());
+        for (auto* graph : *result) {
+            delete graph;
+        }
+    }
+};
+
+// Test 1: Every clique finder times its phases and counts its search
+TEST_F(SearchMetricsTest, CliqueFindersRecordPhasesAndCounters) {
+    for (const auto type :
+         {AlgorithmType::BRON_KERBOSCH_SERIAL,
+          AlgorithmType::BRON_KERBOSCH_BITSET, AlgorithmType::MAX_CLIQUE,
+          AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+        SearchMetrics metrics;
+        run(type, metrics);
+        if (!SearchMetrics::ENABLED) {
+            EXPECT_TRUE(metrics.phases.empty());
+            EXPECT_EQ(metrics.search_nodes, 0u);
+            continue;
+        }
+        for (const char* name :
+             {"product_graph", "search", "result_conversion"}) {
+            const PhaseMetrics* phase = metrics.phase(name);
+            ASSERT_NE(phase, nullptr) << name << " " << static_cast<int>(type);
+            EXPECT_EQ(phase->calls, 1u);
+        }
+        EXPECT_GT(metrics.search_nodes, 0u) << static_cast<int>(type);
+        EXPECT_GT(metrics.set_intersections, 0u);
+        EXPECT_GT(metrics.peak_frontier, 0u);
+        EXPECT_EQ(metrics.conflict_checks, 0u);
+        EXPECT_EQ(metrics.phase("conflicts"), nullptr);
+    }
+}
+
+// Test 2: KPT counts its conflict checks
+TEST_F(SearchMetricsTest, KPTCountsConflictChecks) {
+    SearchMetrics metrics;
+    run(AlgorithmType::KPT, metrics);
+    if (!SearchMetrics::ENABLED) {
+        GTEST_SKIP() << "metrics are compiled out";
+    }
+    EXPECT_NE(metrics.phase("conflicts"), nullptr);
+    EXPECT_NE(metrics.phase("matching"), nullptr);
+    EXPECT_GT(metrics.conflict_checks, 0u);
+    EXPECT_EQ(metrics.search_nodes, 0u);
+}
+
+// Test 3: Metrics accumulate over the calls they are given to
+TEST_F(SearchMetricsTest, MetricsAccumulate) {
+    SearchMetrics once;
+    run(AlgorithmType::MAX_CLIQUE, once);
+    SearchMetrics twice;
+    run(AlgorithmType::MAX_CLIQUE, twice);
+    run(AlgorithmType::MAX_CLIQUE, twice);
+    if (!SearchMetrics::ENABLED) {
+        GTEST_SKIP() << "metrics are compiled out";
+    }
+    EXPECT_EQ(twice.phase("search")->calls, 2u);
+    EXPECT_EQ(twice.search_nodes, 2 * once.search_nodes);
+    EXPECT_EQ(twice.peak_frontier, once.peak_frontier);
+    EXPECT_TRUE(twice.trace.empty());
+}
+
+// Test 4: Recorded phases are written as Chrome trace events
+TEST_F(SearchMetricsTest, ChromeTrace) {
+    SearchMetrics metrics;
+    metrics.record_trace = true;
+    run(AlgorithmType::BRON_KERBOSCH_BITSET, metrics);
+    if (!SearchMetrics::ENABLED) {
+        GTEST_SKIP() << "metrics are compiled out";
+    }
+    ASSERT_EQ(metrics.trace.size(), 3u);
+    for (const auto& event : metrics.trace) {
+        EXPECT_GE(event.duration_us, 0);
+    }
+
+    std::ostringstream out;
+    metrics.write_chrome_trace(out);
+    const std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0),
+              0u);
+    EXPECT_NE(json.find("\"name\":\"search\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+
+    const std::string path
+        = (std::filesystem::temp_directory_path() / "mcis_trace_test.json")
+              .string();
+    EXPECT_FALSE(metrics.write_chrome_trace(path).has_value());
+    std::ifstream file(path);
+    std::stringstream written;
+    written << file.rdbuf();
+    EXPECT_EQ(written.str(), json);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(metrics.write_chrome_trace("/nonexistent/dir/trace.json"),
+              mcis::GraphError::FILE_IO_ERROR);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file test_helpers.h
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Graph generators, an exhaustive reference solver and the MCISAlgorithm
+ * fixture shared by the finder tests.
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#ifndef TEST_TEST_HELPERS_H_
+#define TEST_TEST_HELPERS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+/**
+ * @brief Builds a random DAG on nodes prefix0 .. prefix<n-1>, with an edge
+ * i -> j for each i < j with probability p.
+ */
+inline Graph random_dag(int n, double p, std::mt19937& rng,
+                        const std::string& prefix) {
+    Graph g;
+    for (int i = 0; i < n; ++i) {
+        g.add_node(prefix + std::to_string(i));
+    }
+    std::bernoulli_distribution coin(p);
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            if (coin(rng)) {
+                g.add_edge(prefix + std::to_string(i),
+                           prefix + std::to_string(j), 0);
+            }
+        }
+    }
+    return g;
+}
+
+/**
+ * @brief Exhaustive maximum common induced subgraph size of two small
+ * graphs, optionally ignoring edge directions.
+ */
+inline int brute_force_mcis(const Graph& g1, const Graph& g2,
+                            bool directed = true) {
+    CompactGraph c1 = g1.freeze();
+    CompactGraph c2 = g2.freeze();
+    std::vector<int> mapping(c1.get_num_nodes(), -1);
+    std::vector<bool> used(c2.get_num_nodes(), false);
+    int best = 0;
+    auto relation = [&](const CompactGraph& g, uint32_t x, uint32_t y) {
+        const int out = g.has_edge(x, y) ? 1 : 0;
+        const int in = g.has_edge(y, x) ? 1 : 0;
+        return directed ? out * 2 + in : out | in;
+    };
+    auto consistent = [&](uint32_t a, uint32_t b) {
+        for (uint32_t x = 0; x < a; ++x) {
+            if (mapping[x] < 0) continue;
+            uint32_t y = static_cast<uint32_t>(mapping[x]);
+            if (relation(c1, a, x) != relation(c2, b, y)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto recurse = [&](auto&& self, uint32_t a, int size) -> void {
+        if (a == c1.get_num_nodes()) {
+            best = std::max(best, size);
+            return;
+        }
+        for (uint32_t b = 0; b < c2.get_num_nodes(); ++b) {
+            if (!used[b] && consistent(a, b)) {
+                used[b] = true;
+                mapping[a] = static_cast<int>(b);
+                self(self, a + 1, size + 1);
+                mapping[a] = -1;
+                used[b] = false;
+            }
+        }
+        self(self, a + 1, size);
+    };
+    recurse(recurse, 0, 0);
+    return best;
+}
+
+/**
+ * @class MCISAlgorithmTest
+ * @brief Fixture that gives each test a fresh MCISAlgorithm. Fixtures that
+ * override SetUp call this one's first.
+ */
+class MCISAlgorithmTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+};
+
+#endif  // TEST_TEST_HELPERS_H_
@@ -0,0 +1,210 @@
+/**
+ * @file vertex_orbits_test.cpp
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ *
+ * Copyright (c) 2025 Bryan SebaRaj
+ *
+ * This software is licensed under the MIT License.
+ */
+
+#include <memory>
+#include <set>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compact_graph.h"
+#include "mcis/graph.h"
+#include "mcis/graph_view.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/search_metrics.h"
+#include "mcis/vertex_orbits.h"
+
+class VertexOrbitsTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        mcis_algorithm = std::make_unique<MCISAlgorithm>();
+    }
+
+    void TearDown() override { mcis_algorithm.reset(); }
+
+    std::unique_ptr<MCISAlgorithm> mcis_algorithm;
+
+    size_t mcis_size(const std::vector<const Graph*>& graphs,
+                     AlgorithmType type, const RunOptions& options) {
+        auto result = mcis_algorithm->run(graphs, type, std::nullopt, options);
+        EXPECT_TRUE(result.has_value());
+        if (!result || result->empty()) {
+            return 0;
+        }
+        const size_t size = result->front()->get_num_nodes();
+        for (auto* graph : *result) {
+            delete graph;
+        }
+        return size;
+    }
+};
+
+// Test 1: Butterflies of one FFT stage are interchangeable
+TEST_F(VertexOrbitsTest, FFTStagesAreOrbits) {
+    auto fft = CompactGraph::create_fft_graph_from_dimensions(8);
+    ASSERT_TRUE(fft.has_value());
+    const VertexOrbits orbits{GraphView(*fft)};
+    EXPECT_FALSE(orbits.trivial());
+
+    // Vertices of one orbit keep their degrees and tag, and the stages of
+    // the transform are whole orbits: XOR translations of the indices act
+    // transitively on each one
+    std::set<uint32_t> ids;
+    for (CompactGraph::VertexId v = 0; v < fft->get_num_nodes(); ++v) {
+        const uint32_t o = orbits.orbit(v);
+        ASSERT_LT(o, orbits.get_num_orbits());
+        ids.insert(o);
+        for (CompactGraph::VertexId u = 0; u < v; ++u) {
+            if (orbits.orbit(u) == o) {
+                EXPECT_EQ(fft->get_tag(u), fft->get_tag(v));
+                EXPECT_EQ(fft->out_neighbors(u).size(),
+                          fft->out_neighbors(v).size());
+                EXPECT_EQ(fft->in_neighbors(u).size(),
+                          fft->in_neighbors(v).size());
+            }
+        }
+    }
+    EXPECT_EQ(ids.size(), orbits.get_num_orbits());
+    EXPECT_LE(orbits.get_num_orbits(), fft->get_num_nodes() / 8);
+    EXPECT_TRUE(orbits.complete());
+
+    // Fixing a vertex leaves it on its own and splits the other orbits
+    const std::vector<CompactGraph::VertexId> fixed = {0};
+    const VertexOrbits stabilizer(GraphView(*fft), fixed);
+    EXPECT_GT(stabilizer.get_num_orbits(), orbits.get_num_orbits());
+    EXPECT_FALSE(stabilizer.trivial());
+    for (CompactGraph::VertexId v = 1; v < fft->get_num_nodes(); ++v) {
+        EXPECT_NE(stabilizer.orbit(v), stabilizer.orbit(0));
+        for (CompactGraph::VertexId u = 1; u < v; ++u) {
+            if (stabilizer.orbit(u) == stabilizer.orbit(v)) {
+                EXPECT_EQ(orbits.orbit(u), orbits.orbit(v));
+            }
+        }
+    }
+
+    // A path has no symmetry, and vertices outside a view have no orbit
+    Graph path;
+    for (const std::string id : {"a", "b", "c"}) {
+        path.add_node(id);
+    }
+    path.add_edge("a", "b", 0);
+    path.add_edge("b", "c", 0);
+    const CompactGraph compact = path.freeze();
+    const VertexOrbits path_orbits{GraphView(
+        compact, [](CompactGraph::VertexId v) { return v != 2; })};
+    EXPECT_TRUE(path_orbits.trivial());
+    EXPECT_EQ(path_orbits.get_num_orbits(), 2u);
+    EXPECT_EQ(path_orbits.orbit(2), VertexOrbits::NO_ORBIT);
+}
+
+// Test 2: Rows of an MVM are interchangeable, and tags split orbits
+TEST_F(VertexOrbitsTest, MVMRowsShareOrbits) {
+    auto mvm = Graph::create_mvm_graph_from_dimensions(4, 3);
+    ASSERT_TRUE(mvm.has_value());
+    const CompactGraph compact = mvm->freeze();
+    const VertexOrbits orbits{GraphView(compact)};
+    EXPECT_FALSE(orbits.trivial());
+    EXPECT_LT(orbits.get_num_orbits(), compact.get_num_nodes());
+
+    // Retagging one vertex breaks the symmetries that move it
+    Graph retagged = *mvm;
+    const CompactGraph::VertexId fixed = 0;
+    EXPECT_FALSE(retagged.set_node_tag(compact.get_id(fixed), "marked"));
+    const CompactGraph marked = retagged.freeze();
+    const VertexOrbits marked_orbits{GraphView(marked)};
+    const auto v = *marked.get_index(compact.get_id(fixed));
+    for (CompactGraph::VertexId u = 0; u < marked.get_num_nodes(); ++u) {
+        if (u != v) {
+            EXPECT_NE(marked_orbits.orbit(u), marked_orbits.orbit(v));
+        }
+    }
+    EXPECT_GT(marked_orbits.get_num_orbits(), orbits.get_num_orbits());
+
+    // A zero budget finds nothing, which leaves every vertex on its own
+    const VertexOrbits unsearched(GraphView(compact), {}, 0);
+    EXPECT_TRUE(unsearched.trivial());
+    EXPECT_EQ(unsearched.get_num_orbits(), compact.get_num_nodes());
+}
+
+// Test 3: Symmetry breaking keeps the MCIS size
+TEST_F(VertexOrbitsTest, SymmetryBreakingKeepsMaximumSize) {
+    auto fft = Graph::create_fft_graph_from_dimensions(4);
+    auto mvm = Graph::create_mvm_graph_from_dimensions(3, 3);
+    ASSERT_TRUE(fft.has_value());
+    ASSERT_TRUE(mvm.has_value());
+    const std::vector<std::vector<const Graph*>> pairs
+        = {{&*fft, &*mvm}, {&*fft, &*fft}, {&*mvm, &*mvm}};
+
+    for (const auto& graphs : pairs) {
+        for (const auto type :
+             {AlgorithmType::MAX_CLIQUE, AlgorithmType::MAX_CLIQUE_PARALLEL}) {
+            RunOptions plain;
+            plain.num_threads = 2;
+            SearchMetrics plain_metrics;
+            plain.metrics = &plain_metrics;
+            RunOptions broken = plain;
+            SearchMetrics broken_metrics;
+            broken.metrics = &broken_metrics;
+            broken.symmetry_breaking = true;
+
+            EXPECT_EQ(mcis_size(graphs, type, broken),
+                      mcis_size(graphs, type, plain));
+            if (SearchMetrics::ENABLED) {
+                EXPECT_NE(broken_metrics.phase("symmetry"), nullptr);
+                EXPECT_EQ(plain_metrics.phase("symmetry"), nullptr);
+            }
+        }
+    }
+}
+
+// Test 4: One equitable color holding several orbits is split exactly
+TEST_F(VertexOrbitsTest, SeveralOrbitsInOneColor) {
+    // A directed 6-cycle and two directed triangles: every vertex has one
+    // in- and one out-neighbour, so refinement leaves a single color
+    Graph graph;
+    auto add_cycle = [&](const std::string& prefix, int length) {
+        for (int i = 0; i < length; ++i) {
+            graph.add_node(prefix + std::to_string(i));
+        }
+        for (int i = 0; i < length; ++i) {
+            graph.add_edge(prefix + std::to_string(i),
+                           prefix + std::to_string((i + 1) % length), 0);
+        }
+    };
+    add_cycle("a", 6);
+    add_cycle("b", 3);
+    add_cycle("c", 3);
+    const CompactGraph compact = graph.freeze();
+    auto orbit = [&](const VertexOrbits& orbits, const std::string& id) {
+        return orbits.orbit(*compact.get_index(id));
+    };
+
+    // The hexagon's rotations and the triangles' rotations and swap give
+    // two orbits
+    const VertexOrbits orbits{GraphView(compact)};
+    EXPECT_TRUE(orbits.complete());
+    EXPECT_EQ(orbits.get_num_orbits(), 2u);
+    EXPECT_NE(orbit(orbits, "a0"), orbit(orbits, "b0"));
+    for (const std::string id : {"b1", "b2", "c0", "c1", "c2"}) {
+        EXPECT_EQ(orbit(orbits, id), orbit(orbits, "b0")) << id;
+    }
+
+    // Fixing b0 fixes its whole triangle; the hexagon and the other
+    // triangle still rotate, and stay apart although they share a color
+    const auto b0 = *compact.get_index("b0");
+    const VertexOrbits stabilized(GraphView(compact), std::span(&b0, 1));
+    EXPECT_TRUE(stabilized.complete());
+    EXPECT_EQ(stabilized.get_num_orbits(), 5u);
+    EXPECT_NE(orbit(stabilized, "a0"), orbit(stabilized, "c0"));
+    EXPECT_EQ(orbit(stabilized, "c0"), orbit(stabilized, "c2"));
+    EXPECT_NE(orbit(stabilized, "b1"), orbit(stabilized, "b2"));
+}